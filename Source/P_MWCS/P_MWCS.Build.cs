@@ -15,7 +15,8 @@ public class P_MWCS : ModuleRules
                 "UMG",
                 "Json",
                 "JsonUtilities",
-                "P_MWCS_Runtime"
+                "P_MWCS_Runtime",
+                "P_MWCS_Core"
             }
         );
 
@@ -25,6 +26,7 @@ public class P_MWCS : ModuleRules
                 "ApplicationCore",
                 "Slate",
                 "SlateCore",
+                "SlateNullRenderer",
                 "ToolMenus",
                 "Settings",
                 "DeveloperSettings",
@@ -34,7 +36,12 @@ public class P_MWCS : ModuleRules
                 "KismetCompiler",
                 "BlueprintGraph",
                 "UMGEditor",
-                "Blutility"
+                "Blutility",
+                "ContentBrowser",
+                "Sockets",
+                "Networking",
+                "DirectoryWatcher",
+                "Projects"
             }
         );
     }
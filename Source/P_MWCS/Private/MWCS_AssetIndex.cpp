@@ -0,0 +1,211 @@
+#include "MWCS_AssetIndex.h"
+
+#include "Dom/JsonObject.h"
+#include "HAL/FileManager.h"
+#include "Misc/DateTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+
+static bool MWCS_ReadIndexFile(const FString &Path, TMap<FString, FMWCS_AssetIndexEntry> &OutEntries)
+{
+    FString Json;
+    if (!FFileHelper::LoadFileToString(Json, *Path))
+    {
+        return false;
+    }
+
+    TSharedPtr<FJsonObject> Root;
+    TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Json);
+    if (!FJsonSerializer::Deserialize(Reader, Root) || !Root.IsValid())
+    {
+        UE_LOG(LogTemp, Warning, TEXT("MWCS: ignoring unreadable asset index %s"), *Path);
+        return false;
+    }
+
+    const TArray<TSharedPtr<FJsonValue>> *Assets = nullptr;
+    if (!Root->TryGetArrayField(TEXT("Assets"), Assets))
+    {
+        return true;
+    }
+    for (const TSharedPtr<FJsonValue> &Value : *Assets)
+    {
+        const TSharedPtr<FJsonObject> Obj = Value.IsValid() ? Value->AsObject() : nullptr;
+        if (!Obj.IsValid())
+        {
+            continue;
+        }
+        FMWCS_AssetIndexEntry Entry;
+        Obj->TryGetStringField(TEXT("Asset"), Entry.AssetPath);
+        Obj->TryGetStringField(TEXT("Provider"), Entry.ProviderPath);
+        FString Name;
+        Obj->TryGetStringField(TEXT("BlueprintName"), Name);
+        Entry.BlueprintName = FName(*Name);
+        Obj->TryGetStringField(TEXT("SpecHash"), Entry.SpecHash);
+        Obj->TryGetStringField(TEXT("BuiltUtc"), Entry.BuiltUtc);
+        if (!Entry.AssetPath.IsEmpty())
+        {
+            OutEntries.Add(Entry.AssetPath, MoveTemp(Entry));
+        }
+    }
+    return true;
+}
+
+// Written next to the target and moved over it, so readers never see a half-written index.
+static bool MWCS_WriteIndexFile(const FString &Path, const TMap<FString, FMWCS_AssetIndexEntry> &Entries)
+{
+    TArray<FString> Keys;
+    Entries.GetKeys(Keys);
+    Keys.Sort();
+
+    TArray<TSharedPtr<FJsonValue>> Assets;
+    Assets.Reserve(Keys.Num());
+    for (const FString &Key : Keys)
+    {
+        const FMWCS_AssetIndexEntry &Entry = Entries[Key];
+        TSharedRef<FJsonObject> Obj = MakeShared<FJsonObject>();
+        Obj->SetStringField(TEXT("Asset"), Entry.AssetPath);
+        Obj->SetStringField(TEXT("Provider"), Entry.ProviderPath);
+        Obj->SetStringField(TEXT("BlueprintName"), Entry.BlueprintName.ToString());
+        Obj->SetStringField(TEXT("SpecHash"), Entry.SpecHash);
+        Obj->SetStringField(TEXT("BuiltUtc"), Entry.BuiltUtc);
+        Assets.Add(MakeShared<FJsonValueObject>(Obj));
+    }
+
+    TSharedRef<FJsonObject> Root = MakeShared<FJsonObject>();
+    Root->SetNumberField(TEXT("Version"), 1);
+    Root->SetArrayField(TEXT("Assets"), Assets);
+
+    FString Json;
+    TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&Json);
+    FJsonSerializer::Serialize(Root, Writer);
+
+    const FString TempPath = FString::Printf(TEXT("%s.%s.tmp"), *Path, *FGuid::NewGuid().ToString(EGuidFormats::Digits));
+    if (!FFileHelper::SaveStringToFile(Json, *TempPath) || !IFileManager::Get().Move(*Path, *TempPath, /*bReplace*/ true))
+    {
+        IFileManager::Get().Delete(*TempPath, /*RequireExists*/ false, /*EvenReadOnly*/ true, /*Quiet*/ true);
+        UE_LOG(LogTemp, Warning, TEXT("MWCS: failed to write asset index %s"), *Path);
+        return false;
+    }
+    return true;
+}
+
+FMWCS_AssetIndex &FMWCS_AssetIndex::Get()
+{
+    static FMWCS_AssetIndex Instance;
+    return Instance;
+}
+
+FString FMWCS_AssetIndex::GetIndexFilePath()
+{
+    return FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("MWCS"), TEXT("AssetIndex.json"));
+}
+
+const FMWCS_AssetIndexEntry *FMWCS_AssetIndex::Find(const FString &AssetPath) const
+{
+    const_cast<FMWCS_AssetIndex *>(this)->EnsureLoaded();
+    return Entries.Find(AssetPath);
+}
+
+void FMWCS_AssetIndex::Record(const FString &AssetPath, const FMWCS_WidgetSpec &Spec)
+{
+    EnsureLoaded();
+
+    FMWCS_AssetIndexEntry &Entry = Entries.FindOrAdd(AssetPath);
+    Entry.AssetPath = AssetPath;
+    Entry.ProviderPath = Spec.ProviderPath;
+    Entry.BlueprintName = Spec.BlueprintName;
+    Entry.SpecHash = Spec.SpecHash;
+    Entry.BuiltUtc = FDateTime::UtcNow().ToIso8601();
+    Recorded.Add(AssetPath);
+    bDirty = true;
+}
+
+void FMWCS_AssetIndex::RecordExisting(const FString &AssetPath, const FMWCS_WidgetSpec &Spec)
+{
+    EnsureLoaded();
+    if (Entries.Contains(AssetPath))
+    {
+        return;
+    }
+
+    // No SpecHash: nothing is known about what the asset was built from, so it never counts as up to date.
+    FMWCS_AssetIndexEntry &Entry = Entries.Add(AssetPath);
+    Entry.AssetPath = AssetPath;
+    Entry.ProviderPath = Spec.ProviderPath;
+    Entry.BlueprintName = Spec.BlueprintName;
+    Recorded.Add(AssetPath);
+    bDirty = true;
+}
+
+bool FMWCS_AssetIndex::SaveIfDirty()
+{
+    if (!bDirty)
+    {
+        return true;
+    }
+
+    TMap<FString, FMWCS_AssetIndexEntry> ToWrite;
+    FString Path = FragmentPath;
+    if (Path.IsEmpty())
+    {
+        // Another process (editor, server, earlier shard) may have saved since this one loaded; keep its entries.
+        Path = GetIndexFilePath();
+        MWCS_ReadIndexFile(Path, ToWrite);
+    }
+    for (const FString &AssetPath : Recorded)
+    {
+        if (const FMWCS_AssetIndexEntry *Entry = Entries.Find(AssetPath))
+        {
+            ToWrite.Add(AssetPath, *Entry);
+        }
+    }
+
+    if (!MWCS_WriteIndexFile(Path, ToWrite))
+    {
+        return false;
+    }
+    // A fragment is rewritten whole on every save, so it keeps everything this process recorded.
+    if (FragmentPath.IsEmpty())
+    {
+        Entries = MoveTemp(ToWrite);
+        Recorded.Reset();
+    }
+    bDirty = false;
+    return true;
+}
+
+void FMWCS_AssetIndex::SetFragmentPath(const FString &Path)
+{
+    FragmentPath = Path;
+}
+
+bool FMWCS_AssetIndex::MergeFragment(const FString &Path)
+{
+    EnsureLoaded();
+
+    TMap<FString, FMWCS_AssetIndexEntry> Fragment;
+    if (!MWCS_ReadIndexFile(Path, Fragment))
+    {
+        return false;
+    }
+    for (TPair<FString, FMWCS_AssetIndexEntry> &Pair : Fragment)
+    {
+        Recorded.Add(Pair.Key);
+        Entries.Add(Pair.Key, MoveTemp(Pair.Value));
+    }
+    bDirty |= Fragment.Num() > 0;
+    return true;
+}
+
+void FMWCS_AssetIndex::EnsureLoaded()
+{
+    if (bLoaded)
+    {
+        return;
+    }
+    bLoaded = true;
+    MWCS_ReadIndexFile(GetIndexFilePath(), Entries);
+}
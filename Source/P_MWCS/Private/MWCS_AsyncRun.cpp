@@ -0,0 +1,82 @@
+#include "MWCS_AsyncRun.h"
+
+#include "MWCS_AssetIndex.h"
+#include "MWCS_Service.h"
+#include "MWCS_Settings.h"
+
+#include "MWCS_Utilities.h"
+using namespace MWCS_Utilities;
+
+#include "HAL/PlatformTime.h"
+
+FMWCS_AsyncRun::FMWCS_AsyncRun(const FString &InLabel, TArray<FMWCS_WidgetSpec> &&InSpecs, FMWCS_Report &&InReport, FStepFunction &&InStep)
+    : Label(InLabel), Specs(MoveTemp(InSpecs)), Report(MoveTemp(InReport)), Step(MoveTemp(InStep))
+{
+}
+
+FMWCS_AsyncRun::~FMWCS_AsyncRun()
+{
+    if (TickerHandle.IsValid())
+    {
+        FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+    }
+}
+
+FString FMWCS_AsyncRun::GetCurrentSpecName() const
+{
+    return Specs.IsValidIndex(NextSpec) ? Specs[NextSpec].BlueprintName.ToString() : FString();
+}
+
+void FMWCS_AsyncRun::Start()
+{
+    // FMWCS_Service owns the run until it finishes, so it completes even if the UI that started it goes away.
+    TickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateSP(AsShared(), &FMWCS_AsyncRun::Tick));
+}
+
+bool FMWCS_AsyncRun::Tick(float DeltaTime)
+{
+    const UMWCS_Settings *Settings = UMWCS_Settings::Get();
+    const double SliceSeconds = FMath::Max(1, Settings ? Settings->AsyncTimeSliceMs : 30) / 1000.0;
+    const double Start = FPlatformTime::Seconds();
+
+    // At least one spec per tick, even when a single build exceeds the slice.
+    do
+    {
+        if (bCancelRequested)
+        {
+            bCancelled = true;
+            AddIssue(Report, EMWCS_IssueSeverity::Warning, TEXT("Run.Cancelled"),
+                     FString::Printf(TEXT("Cancelled after %d of %d spec(s)."), NextSpec, Specs.Num()), Label);
+            break;
+        }
+        if (!Specs.IsValidIndex(NextSpec))
+        {
+            break;
+        }
+        Step(Specs[NextSpec], Report);
+        ++NextSpec;
+    } while (FPlatformTime::Seconds() - Start < SliceSeconds);
+
+    if (bCancelled || NextSpec >= Specs.Num())
+    {
+        Finish();
+        return false;
+    }
+    return true;
+}
+
+void FMWCS_AsyncRun::Finish()
+{
+    TickerHandle.Reset();
+    FMWCS_AssetIndex::Get().SaveIfDirty();
+    FMWCS_Service::Get().SaveReportJson(Report, Label);
+
+    // Keep this alive while listeners run; they commonly drop their reference to the handle.
+    TSharedRef<FMWCS_AsyncRun> KeepAlive = AsShared();
+    FMWCS_Service &Service = FMWCS_Service::Get();
+    if (Service.ActiveRun == KeepAlive)
+    {
+        Service.ActiveRun.Reset();
+    }
+    OnFinished.ExecuteIfBound(Report);
+}
@@ -0,0 +1,332 @@
+#include "MWCS_Benchmark.h"
+
+#include "MWCS_CanonicalJson.h"
+#include "MWCS_Service.h"
+#include "MWCS_Settings.h"
+#include "MWCS_SpecFilter.h"
+#include "MWCS_WidgetExtractor.h"
+#include "MWCS_WidgetRegistry.h"
+
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "Dom/JsonObject.h"
+#include "HAL/PlatformMemory.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "UObject/UObjectGlobals.h"
+#include "WidgetBlueprint.h"
+
+#include "MWCS_Utilities.h"
+
+using namespace MWCS_Utilities;
+
+static const TCHAR *GMWCS_BaselineFormat = TEXT("MWCS.BenchmarkBaseline");
+
+static double MWCS_BytesToMB(uint64 Bytes)
+{
+    return static_cast<double>(Bytes) / (1024.0 * 1024.0);
+}
+
+static const TCHAR *MWCS_ModeToString(EMWCS_BuildMode Mode)
+{
+    switch (Mode)
+    {
+    case EMWCS_BuildMode::Repair:
+        return TEXT("Repair");
+    case EMWCS_BuildMode::ForceRecreate:
+        return TEXT("ForceRecreate");
+    default:
+        return TEXT("CreateMissing");
+    }
+}
+
+// Garbage-collects, then times Body and adds a sample, memory and the issues it produced to Stage.
+static void MWCS_RunStage(FMWCS_BenchmarkStage &Stage, FMWCS_Report &Report, TFunctionRef<void(FMWCS_Report &)> Body)
+{
+    CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+    const uint64 UsedBefore = FPlatformMemory::GetStats().UsedPhysical;
+
+    FMWCS_Report StageReport;
+    const double Start = FPlatformTime::Seconds();
+    Body(StageReport);
+    Stage.SamplesMs.Add((FPlatformTime::Seconds() - Start) * 1000.0);
+
+    const FPlatformMemoryStats Stats = FPlatformMemory::GetStats();
+    Stage.UsedMB = MWCS_BytesToMB(Stats.UsedPhysical);
+    Stage.DeltaMB = FMath::Max(Stage.DeltaMB, Stage.UsedMB - MWCS_BytesToMB(UsedBefore));
+    Stage.PeakMB = MWCS_BytesToMB(Stats.PeakUsedPhysical);
+    Stage.Errors += StageReport.NumErrors();
+    Stage.Warnings += StageReport.NumWarnings();
+    Report.Append(StageReport);
+}
+
+const FMWCS_BenchmarkStage *FMWCS_BenchmarkResult::FindStage(const FString &Name) const
+{
+    return Stages.FindByPredicate([&Name](const FMWCS_BenchmarkStage &Stage)
+                                  { return Stage.Name == Name; });
+}
+
+double FMWCS_Benchmark::Median(TArray<double> Samples)
+{
+    if (Samples.Num() == 0)
+    {
+        return 0.0;
+    }
+    Samples.Sort();
+    const int32 Mid = Samples.Num() / 2;
+    return Samples.Num() % 2 ? Samples[Mid] : (Samples[Mid - 1] + Samples[Mid]) * 0.5;
+}
+
+void FMWCS_Benchmark::Run(const FMWCS_BenchmarkOptions &Options, FMWCS_BenchmarkResult &OutResult, FMWCS_Report &InOutReport)
+{
+    const FMWCS_SpecGeneratorOptions &Corpus = Options.Corpus;
+    const FString CorpusDir = Options.CorpusDir.IsEmpty() ? FMWCS_SpecGenerator::GetDefaultCorpusDir() : Options.CorpusDir;
+
+    OutResult = FMWCS_BenchmarkResult();
+    OutResult.NumSpecs = Corpus.NumSpecs;
+    OutResult.NodesPerSpec = Corpus.NodesPerSpec;
+    OutResult.Seed = Corpus.Seed;
+    OutResult.Iterations = FMath::Max(1, Options.Iterations);
+    OutResult.Mode = Options.Mode;
+    for (const TCHAR *Name : {TEXT("Generate"), TEXT("CollectSpecs"), TEXT("BuildAll"), TEXT("ValidateAll"), TEXT("Extract")})
+    {
+        OutResult.Stages.AddDefaulted_GetRef().Name = Name;
+    }
+
+    // Point discovery and output at the corpus for this process only; the config file is not touched.
+    UMWCS_Settings *Settings = GetMutableDefault<UMWCS_Settings>();
+    const TArray<FSoftClassPath> SavedProviders = Settings->SpecProviderClasses;
+    const TArray<FDirectoryPath> SavedDirectories = Settings->SpecDirectories;
+    const FString SavedOutputRoot = Settings->OutputRootPath;
+    Settings->SpecProviderClasses.Reset();
+    Settings->SpecDirectories.Reset();
+    Settings->SpecDirectories.AddDefaulted_GetRef().Path = CorpusDir;
+    Settings->OutputRootPath = Corpus.OutputRootPath;
+
+    const FMWCS_SpecFilter Filter;
+    bool bCorpusWritten = false;
+    MWCS_RunStage(OutResult.Stages[0], InOutReport, [&](FMWCS_Report &Report)
+                  { bCorpusWritten = FMWCS_SpecGenerator::WriteCorpus(Corpus, CorpusDir, Report); });
+
+    // Without a corpus the other stages would collect whatever else is in CorpusDir.
+    for (int32 Iteration = 0; bCorpusWritten && Iteration < OutResult.Iterations; ++Iteration)
+    {
+        MWCS_RunStage(OutResult.Stages[1], InOutReport, [&](FMWCS_Report &Report)
+                      {
+                          TArray<FMWCS_WidgetSpec> Specs;
+                          FMWCS_WidgetRegistry::CollectSpecs(Specs, Report);
+                          OutResult.SpecsCollected = Specs.Num(); });
+
+        MWCS_RunStage(OutResult.Stages[2], InOutReport, [&](FMWCS_Report &Report)
+                      { Report = FMWCS_Service::Get().BuildAll(Options.Mode, Filter); });
+
+        MWCS_RunStage(OutResult.Stages[3], InOutReport, [&](FMWCS_Report &Report)
+                      { Report = FMWCS_Service::Get().ValidateAll(Filter); });
+
+        MWCS_RunStage(OutResult.Stages[4], InOutReport, [&](FMWCS_Report &Report)
+                      {
+                          IAssetRegistry &AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry")).Get();
+                          FARFilter ARFilter;
+                          ARFilter.PackagePaths.Add(FName(*Corpus.OutputRootPath));
+                          ARFilter.bRecursivePaths = true;
+                          ARFilter.ClassPaths.Add(UWidgetBlueprint::StaticClass()->GetClassPathName());
+                          ARFilter.bRecursiveClasses = true;
+                          TArray<FAssetData> Assets;
+                          AssetRegistry.GetAssets(ARFilter, Assets);
+                          Assets.Sort([](const FAssetData &A, const FAssetData &B)
+                                      { return A.PackageName.LexicalLess(B.PackageName); });
+
+                          FMWCS_ExtractBatchOptions BatchOptions;
+                          BatchOptions.OutputDir = FPaths::Combine(FPaths::GetPath(CorpusDir), TEXT("Extracted"));
+                          BatchOptions.bForce = true;
+                          FMWCS_WidgetExtractor::ExtractAssets(Assets, FMWCS_ExtractOptions(), BatchOptions, Report); });
+    }
+
+    Settings->SpecProviderClasses = SavedProviders;
+    Settings->SpecDirectories = SavedDirectories;
+    Settings->OutputRootPath = SavedOutputRoot;
+
+    for (FMWCS_BenchmarkStage &Stage : OutResult.Stages)
+    {
+        Stage.MedianMs = Median(Stage.SamplesMs);
+    }
+}
+
+FString FMWCS_Benchmark::ToJson(const FMWCS_BenchmarkResult &Result)
+{
+    const int64 TotalNodes = static_cast<int64>(Result.NumSpecs) * Result.NodesPerSpec;
+    FMWCS_CanonicalJsonWriter Writer;
+    Writer.BeginObject();
+    Writer.Write(TEXT("Specs"), Result.NumSpecs);
+    Writer.Write(TEXT("NodesPerSpec"), Result.NodesPerSpec);
+    Writer.Write(TEXT("Seed"), Result.Seed);
+    Writer.Write(TEXT("Iterations"), Result.Iterations);
+    Writer.Write(TEXT("SpecsCollected"), Result.SpecsCollected);
+    Writer.Write(TEXT("Mode"), MWCS_ModeToString(Result.Mode));
+    Writer.BeginArray(TEXT("Stages"));
+    for (const FMWCS_BenchmarkStage &Stage : Result.Stages)
+    {
+        Writer.BeginObject();
+        Writer.Write(TEXT("Stage"), Stage.Name);
+        Writer.BeginArray(TEXT("SamplesMs"));
+        for (const double Sample : Stage.SamplesMs)
+        {
+            Writer.WriteElement(Sample);
+        }
+        Writer.EndArray();
+        Writer.Write(TEXT("MedianMs"), Stage.MedianMs);
+        Writer.Write(TEXT("MsPerSpec"), Result.NumSpecs > 0 ? Stage.MedianMs / Result.NumSpecs : 0.0);
+        Writer.Write(TEXT("NodesPerSecond"), Stage.MedianMs > 0.0 ? TotalNodes * 1000.0 / Stage.MedianMs : 0.0);
+        Writer.Write(TEXT("UsedPhysicalMB"), Stage.UsedMB);
+        Writer.Write(TEXT("DeltaPhysicalMB"), Stage.DeltaMB);
+        Writer.Write(TEXT("PeakUsedPhysicalMB"), Stage.PeakMB);
+        Writer.Write(TEXT("Errors"), Stage.Errors);
+        Writer.Write(TEXT("Warnings"), Stage.Warnings);
+        Writer.EndObject();
+    }
+    Writer.EndArray();
+    Writer.EndObject();
+    return Writer.GetOutput();
+}
+
+FString FMWCS_Benchmark::ToBaselineJson(const FMWCS_BenchmarkResult &Result, const TMap<FString, double> &Thresholds)
+{
+    FMWCS_CanonicalJsonWriter Writer;
+    Writer.BeginObject();
+    Writer.Write(TEXT("Format"), GMWCS_BaselineFormat);
+    Writer.Write(TEXT("Version"), 2);
+    Writer.Write(TEXT("Specs"), Result.NumSpecs);
+    Writer.Write(TEXT("NodesPerSpec"), Result.NodesPerSpec);
+    Writer.Write(TEXT("Seed"), Result.Seed);
+    Writer.Write(TEXT("Mode"), MWCS_ModeToString(Result.Mode));
+    Writer.Write(TEXT("Iterations"), Result.Iterations);
+    Writer.BeginObject(TEXT("Stages"));
+    for (const FMWCS_BenchmarkStage &Stage : Result.Stages)
+    {
+        Writer.BeginObject(Stage.Name);
+        Writer.Write(TEXT("MedianMs"), Stage.MedianMs);
+        Writer.EndObject();
+    }
+    Writer.EndObject();
+    Writer.BeginObject(TEXT("Thresholds"));
+    for (const TPair<FString, double> &Threshold : Thresholds)
+    {
+        Writer.Write(Threshold.Key, Threshold.Value);
+    }
+    Writer.EndObject(true);
+    Writer.EndObject();
+    return Writer.GetOutput();
+}
+
+bool FMWCS_Benchmark::LoadBaseline(const FString &Path, FMWCS_BenchmarkBaseline &OutBaseline, FMWCS_Report &InOutReport)
+{
+    OutBaseline = FMWCS_BenchmarkBaseline();
+
+    FString Json;
+    if (!FFileHelper::LoadFileToString(Json, *Path))
+    {
+        AddIssue(InOutReport, EMWCS_IssueSeverity::Error, TEXT("Benchmark.BaselineInvalid"), TEXT("Baseline file not found or unreadable."), Path);
+        return false;
+    }
+
+    TSharedPtr<FJsonObject> Root;
+    const TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Json);
+    FString Format;
+    const TSharedPtr<FJsonObject> *Stages = nullptr;
+    if (!FJsonSerializer::Deserialize(Reader, Root) || !Root.IsValid() || !Root->TryGetStringField(TEXT("Format"), Format) || Format != GMWCS_BaselineFormat || !Root->TryGetObjectField(TEXT("Stages"), Stages) || !Stages || !Stages->IsValid())
+    {
+        AddIssue(InOutReport, EMWCS_IssueSeverity::Error, TEXT("Benchmark.BaselineInvalid"),
+                 FString::Printf(TEXT("Expected a JSON object with \"Format\": \"%s\" and a \"Stages\" object."), GMWCS_BaselineFormat), Path);
+        return false;
+    }
+
+    Root->TryGetNumberField(TEXT("Specs"), OutBaseline.NumSpecs);
+    Root->TryGetNumberField(TEXT("NodesPerSpec"), OutBaseline.NodesPerSpec);
+    Root->TryGetNumberField(TEXT("Seed"), OutBaseline.Seed);
+    Root->TryGetStringField(TEXT("Mode"), OutBaseline.Mode);
+    Root->TryGetNumberField(TEXT("Iterations"), OutBaseline.Iterations);
+    for (const TPair<FString, TSharedPtr<FJsonValue>> &Stage : (*Stages)->Values)
+    {
+        const TSharedPtr<FJsonObject> *StageObj = nullptr;
+        double MedianMs = 0.0;
+        if (Stage.Value.IsValid() && Stage.Value->TryGetObject(StageObj) && StageObj && (*StageObj)->TryGetNumberField(TEXT("MedianMs"), MedianMs))
+        {
+            OutBaseline.MedianMs.Add(Stage.Key, MedianMs);
+        }
+    }
+
+    const TSharedPtr<FJsonObject> *Thresholds = nullptr;
+    if (Root->TryGetObjectField(TEXT("Thresholds"), Thresholds) && Thresholds && Thresholds->IsValid())
+    {
+        for (const TPair<FString, TSharedPtr<FJsonValue>> &Threshold : (*Thresholds)->Values)
+        {
+            double Value = 0.0;
+            if (Threshold.Value.IsValid() && Threshold.Value->TryGetNumber(Value))
+            {
+                OutBaseline.Thresholds.Add(Threshold.Key, Value);
+            }
+        }
+    }
+    return true;
+}
+
+bool FMWCS_Benchmark::Compare(const FMWCS_BenchmarkResult &Result, const FMWCS_BenchmarkBaseline &Baseline, const FMWCS_BenchmarkGateOptions &Gate,
+                              TArray<FMWCS_BenchmarkDiffRow> &OutRows, FMWCS_Report &InOutReport)
+{
+    OutRows.Reset();
+    bool bPassed = true;
+
+    // Mode decides what BuildAll does (ForceRecreate vs Repair), and a median of 1 sample is not comparable with a
+    // median of 5, so both count as part of the corpus. Version 1 baselines did not record them and cannot be gated.
+    const FString Mode = MWCS_ModeToString(Result.Mode);
+    if (Result.NumSpecs != Baseline.NumSpecs || Result.NodesPerSpec != Baseline.NodesPerSpec || Result.Seed != Baseline.Seed ||
+        Mode != Baseline.Mode || Result.Iterations != Baseline.Iterations)
+    {
+        AddIssue(InOutReport, EMWCS_IssueSeverity::Error, TEXT("Benchmark.BaselineMismatch"),
+                 FString::Printf(TEXT("Baseline was recorded for %d spec(s) x %d widget(s), seed %d, mode %s, %d iteration(s); this run used %d x %d, seed %d, mode %s, %d iteration(s)."),
+                                 Baseline.NumSpecs, Baseline.NodesPerSpec, Baseline.Seed, Baseline.Mode.IsEmpty() ? TEXT("(none)") : *Baseline.Mode, Baseline.Iterations,
+                                 Result.NumSpecs, Result.NodesPerSpec, Result.Seed, *Mode, Result.Iterations),
+                 TEXT("Benchmark"));
+        bPassed = false;
+    }
+
+    int32 NumRegressed = 0;
+    for (const FMWCS_BenchmarkStage &Stage : Result.Stages)
+    {
+        const double *BaselineMs = Baseline.MedianMs.Find(Stage.Name);
+        if (!BaselineMs)
+        {
+            continue;
+        }
+
+        FMWCS_BenchmarkDiffRow &Row = OutRows.AddDefaulted_GetRef();
+        Row.Stage = Stage.Name;
+        Row.BaselineMs = *BaselineMs;
+        Row.CurrentMs = Stage.MedianMs;
+        Row.DeltaPct = *BaselineMs > 0.0 ? (Stage.MedianMs - *BaselineMs) * 100.0 / *BaselineMs : 0.0;
+
+        // Command-line thresholds win over the baseline file, which wins over the default.
+        const double *Threshold = Gate.Thresholds.Find(Stage.Name);
+        if (!Threshold)
+        {
+            Threshold = Baseline.Thresholds.Find(Stage.Name);
+        }
+        Row.bGated = Threshold || Gate.GatedStages.Contains(Stage.Name);
+        Row.Threshold = Threshold ? *Threshold : Gate.DefaultThreshold;
+        Row.bRegressed = Row.bGated && Stage.MedianMs - *BaselineMs > Gate.MinDeltaMs && Stage.MedianMs > *BaselineMs * (1.0 + Row.Threshold);
+
+        if (Row.bRegressed)
+        {
+            ++NumRegressed;
+            AddIssue(InOutReport, EMWCS_IssueSeverity::Error, TEXT("Benchmark.Regression"),
+                     FString::Printf(TEXT("Median %.1fms vs baseline %.1fms (%+.1f%%, allowed +%.1f%%)."), Row.CurrentMs, Row.BaselineMs, Row.DeltaPct, Row.Threshold * 100.0),
+                     Stage.Name);
+        }
+    }
+
+    AddIssue(InOutReport, EMWCS_IssueSeverity::Info, TEXT("Benchmark.Gate"),
+             FString::Printf(TEXT("%d stage(s) compared, %d regressed."), OutRows.Num(), NumRegressed), TEXT("Benchmark"));
+    return bPassed && NumRegressed == 0;
+}
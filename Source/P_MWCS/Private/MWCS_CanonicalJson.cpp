@@ -0,0 +1,289 @@
+#include "MWCS_CanonicalJson.h"
+
+FMWCS_CanonicalJsonWriter::FMWCS_CanonicalJsonWriter(bool bInPretty, int32 InBaseDepth)
+    : bPretty(bInPretty), BaseDepth(InBaseDepth)
+{
+}
+
+void FMWCS_CanonicalJsonWriter::BeginObject()
+{
+    Begin(false, FString());
+}
+
+void FMWCS_CanonicalJsonWriter::BeginObject(const FString &Key)
+{
+    Begin(false, Key);
+}
+
+void FMWCS_CanonicalJsonWriter::BeginArray()
+{
+    Begin(true, FString());
+}
+
+void FMWCS_CanonicalJsonWriter::BeginArray(const FString &Key)
+{
+    Begin(true, Key);
+}
+
+bool FMWCS_CanonicalJsonWriter::EndObject(bool bOmitIfEmpty)
+{
+    return End(false, bOmitIfEmpty);
+}
+
+bool FMWCS_CanonicalJsonWriter::EndArray(bool bOmitIfEmpty)
+{
+    return End(true, bOmitIfEmpty);
+}
+
+void FMWCS_CanonicalJsonWriter::Write(const FString &Key, const FString &Value)
+{
+    AddMember(Key, Quote(Value));
+}
+
+void FMWCS_CanonicalJsonWriter::Write(const FString &Key, const TCHAR *Value)
+{
+    AddMember(Key, Quote(FString(Value)));
+}
+
+void FMWCS_CanonicalJsonWriter::Write(const FString &Key, double Value)
+{
+    AddMember(Key, FormatNumber(Value));
+}
+
+void FMWCS_CanonicalJsonWriter::Write(const FString &Key, int32 Value)
+{
+    AddMember(Key, FString::Printf(TEXT("%d"), Value));
+}
+
+void FMWCS_CanonicalJsonWriter::Write(const FString &Key, bool bValue)
+{
+    AddMember(Key, bValue ? TEXT("true") : TEXT("false"));
+}
+
+void FMWCS_CanonicalJsonWriter::WriteNull(const FString &Key)
+{
+    AddMember(Key, TEXT("null"));
+}
+
+void FMWCS_CanonicalJsonWriter::WriteElement(const FString &Value)
+{
+    AddElement(Quote(Value));
+}
+
+void FMWCS_CanonicalJsonWriter::WriteElement(double Value)
+{
+    AddElement(FormatNumber(Value));
+}
+
+void FMWCS_CanonicalJsonWriter::WriteElement(bool bValue)
+{
+    AddElement(bValue ? TEXT("true") : TEXT("false"));
+}
+
+void FMWCS_CanonicalJsonWriter::WriteNullElement()
+{
+    AddElement(TEXT("null"));
+}
+
+void FMWCS_CanonicalJsonWriter::WriteRaw(const FString &Key, const FString &Json)
+{
+    AddMember(Key, CopyTemp(Json));
+}
+
+int32 FMWCS_CanonicalJsonWriter::NumInCurrent() const
+{
+    if (Stack.Num() == 0)
+    {
+        return 0;
+    }
+    const FFrame &Top = Stack.Last();
+    return Top.bArray ? Top.Elements.Num() : Top.Members.Num();
+}
+
+const FString &FMWCS_CanonicalJsonWriter::GetOutput() const
+{
+    check(Stack.Num() == 0);
+    return Output;
+}
+
+void FMWCS_CanonicalJsonWriter::Begin(bool bArray, const FString &Key)
+{
+    FFrame &Frame = Stack.AddDefaulted_GetRef();
+    Frame.bArray = bArray;
+    Frame.Key = Key;
+}
+
+bool FMWCS_CanonicalJsonWriter::End(bool bArray, bool bOmitIfEmpty)
+{
+    check(Stack.Num() > 0 && Stack.Last().bArray == bArray);
+    FFrame Frame = Stack.Pop();
+    const int32 Depth = BaseDepth + Stack.Num();
+    const bool bHasKey = Stack.Num() > 0 && !Stack.Last().bArray;
+
+    const int32 Count = bArray ? Frame.Elements.Num() : Frame.Members.Num();
+    if (Count == 0 && bOmitIfEmpty && Stack.Num() > 0)
+    {
+        return false;
+    }
+
+    FString Text;
+    if (Count == 0)
+    {
+        Text = bArray ? TEXT("[]") : TEXT("{}");
+    }
+    else
+    {
+        if (!bArray)
+        {
+            Frame.Members.StableSort([](const TPair<FString, FString> &A, const TPair<FString, FString> &B)
+                                     { return A.Key.Compare(B.Key, ESearchCase::CaseSensitive) < 0; });
+        }
+
+        Text = bArray ? TEXT("[") : TEXT("{");
+        for (int32 Index = 0; Index < Count; ++Index)
+        {
+            if (Index > 0)
+            {
+                Text += TEXT(",");
+            }
+            if (bPretty)
+            {
+                Text += TEXT("\n");
+                Text += Indent(Depth + 1);
+            }
+            if (bArray)
+            {
+                Text += Frame.Elements[Index];
+            }
+            else
+            {
+                Text += Quote(Frame.Members[Index].Key);
+                Text += bPretty ? TEXT(": ") : TEXT(":");
+                Text += Frame.Members[Index].Value;
+            }
+        }
+        if (bPretty)
+        {
+            Text += TEXT("\n");
+            Text += Indent(Depth);
+        }
+        Text += bArray ? TEXT("]") : TEXT("}");
+    }
+
+    AddValue(Frame.Key, MoveTemp(Text), bHasKey);
+    return true;
+}
+
+void FMWCS_CanonicalJsonWriter::AddValue(const FString &Key, FString &&Value, bool bHasKey)
+{
+    if (Stack.Num() == 0)
+    {
+        Output = MoveTemp(Value);
+    }
+    else if (bHasKey)
+    {
+        AddMember(Key, MoveTemp(Value));
+    }
+    else
+    {
+        AddElement(MoveTemp(Value));
+    }
+}
+
+void FMWCS_CanonicalJsonWriter::AddMember(const FString &Key, FString &&Value)
+{
+    check(Stack.Num() > 0 && !Stack.Last().bArray);
+    TArray<TPair<FString, FString>> &Members = Stack.Last().Members;
+    for (TPair<FString, FString> &Member : Members)
+    {
+        if (Member.Key.Equals(Key, ESearchCase::CaseSensitive))
+        {
+            Member.Value = MoveTemp(Value);
+            return;
+        }
+    }
+    Members.Emplace(Key, MoveTemp(Value));
+}
+
+void FMWCS_CanonicalJsonWriter::AddElement(FString &&Value)
+{
+    check(Stack.Num() > 0 && Stack.Last().bArray);
+    Stack.Last().Elements.Add(MoveTemp(Value));
+}
+
+FString FMWCS_CanonicalJsonWriter::Indent(int32 Depth) const
+{
+    return FString::ChrN(Depth, TEXT('\t'));
+}
+
+FString FMWCS_CanonicalJsonWriter::Quote(const FString &Value)
+{
+    FString Out;
+    Out.Reserve(Value.Len() + 2);
+    Out += TEXT("\"");
+    for (const TCHAR Ch : Value)
+    {
+        switch (Ch)
+        {
+        case TEXT('"'):
+            Out += TEXT("\\\"");
+            break;
+        case TEXT('\\'):
+            Out += TEXT("\\\\");
+            break;
+        case TEXT('\n'):
+            Out += TEXT("\\n");
+            break;
+        case TEXT('\r'):
+            Out += TEXT("\\r");
+            break;
+        case TEXT('\t'):
+            Out += TEXT("\\t");
+            break;
+        case TEXT('\b'):
+            Out += TEXT("\\b");
+            break;
+        case TEXT('\f'):
+            Out += TEXT("\\f");
+            break;
+        default:
+            if (Ch < 0x20)
+            {
+                Out += FString::Printf(TEXT("\\u%04x"), static_cast<int32>(Ch));
+            }
+            else
+            {
+                Out.AppendChar(Ch);
+            }
+            break;
+        }
+    }
+    Out += TEXT("\"");
+    return Out;
+}
+
+FString FMWCS_CanonicalJsonWriter::FormatNumber(double Value)
+{
+    if (!FMath::IsFinite(Value))
+    {
+        return TEXT("0");
+    }
+
+    const double Rounded = FMath::RoundToDouble(Value);
+    if (FMath::Abs(Value - Rounded) < 0.0000005 && FMath::Abs(Rounded) < 1e15)
+    {
+        const int64 AsInt = static_cast<int64>(Rounded);
+        return AsInt == 0 ? FString(TEXT("0")) : FString::Printf(TEXT("%lld"), AsInt);
+    }
+
+    FString Text = FString::Printf(TEXT("%.6f"), Value);
+    while (Text.EndsWith(TEXT("0")))
+    {
+        Text.LeftChopInline(1);
+    }
+    if (Text.EndsWith(TEXT(".")))
+    {
+        Text.LeftChopInline(1);
+    }
+    return Text;
+}
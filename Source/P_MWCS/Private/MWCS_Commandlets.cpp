@@ -1,10 +1,35 @@
 #include "MWCS_Commandlets.h"
 
+#include "MWCS_AssetIndex.h"
+#include "MWCS_Benchmark.h"
+#include "MWCS_Discovery.h"
+#include "MWCS_LayoutSnapshot.h"
+#include "MWCS_PerfLint.h"
 #include "MWCS_Report.h"
+#include "MWCS_RoundTrip.h"
+#include "MWCS_RuntimeBench.h"
 #include "MWCS_Service.h"
+#include "MWCS_Settings.h"
+#include "MWCS_WidgetExtractor.h"
 
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "Common/TcpSocketBuilder.h"
+#include "Containers/Ticker.h"
+#include "HAL/PlatformFileManager.h"
+#include "HAL/PlatformMisc.h"
+#include "HAL/PlatformProcess.h"
+#include "HAL/PlatformTime.h"
+#include "Interfaces/IPv4/IPv4Address.h"
+#include "Interfaces/IPv4/IPv4Endpoint.h"
 #include "Misc/CommandLine.h"
+#include "Misc/DateTime.h"
+#include "Misc/FileHelper.h"
 #include "Misc/Parse.h"
+#include "Misc/Paths.h"
+#include "Sockets.h"
+#include "SocketSubsystem.h"
+#include "UObject/UObjectGlobals.h"
+#include "WidgetBlueprint.h"
 
 static bool ShouldFailOnWarnings(const FString &Params)
 {
@@ -57,37 +82,949 @@ static void LogReportToOutput(const FMWCS_Report &Report)
     }
 }
 
-int32 UMWCS_ValidateWidgetsCommandlet::Main(const FString &Params)
+static int32 ExitCodeForReport(const FMWCS_Report &Report, const FString &Params)
 {
-    FMWCS_Report Report = FMWCS_Service::Get().ValidateAll();
-    LogReportToOutput(Report);
-    const bool bFailWarnings = ShouldFailOnWarnings(Params);
-    const bool bFailErrors = ShouldFailOnErrors(Params);
-    if (bFailErrors && Report.HasErrors())
+    if (ShouldFailOnErrors(Params) && Report.HasErrors())
     {
         return 1;
     }
-    if (bFailWarnings && Report.HasWarnings())
+    if (ShouldFailOnWarnings(Params) && Report.HasWarnings())
     {
         return 2;
     }
     return 0;
 }
 
-int32 UMWCS_CreateWidgetsCommandlet::Main(const FString &Params)
+// Issue order differs between the serial and pipelined paths (the pipeline groups issues per spec),
+// so compare counters plus the sorted issue lists.
+static bool ReportsEquivalent(const FMWCS_Report &A, const FMWCS_Report &B)
+{
+    if (A.SpecsProcessed != B.SpecsProcessed || A.AssetsCreated != B.AssetsCreated || A.AssetsRepaired != B.AssetsRepaired || A.AssetsRecreated != B.AssetsRecreated || A.Issues.Num() != B.Issues.Num())
+    {
+        return false;
+    }
+
+    auto SortedKeys = [](const FMWCS_Report &Report)
+    {
+        TArray<FString> Keys;
+        Keys.Reserve(Report.Issues.Num());
+        for (const FMWCS_Issue &Issue : Report.Issues)
+        {
+            Keys.Add(FString::Printf(TEXT("%d|%s|%s|%s"), static_cast<int32>(Issue.Severity), *Issue.Code, *Issue.Context, *Issue.Message));
+        }
+        Keys.Sort();
+        return Keys;
+    };
+
+    return SortedKeys(A) == SortedKeys(B);
+}
+
+// -ReportOut=<file> writes the report to a fixed path (used by the coordinator to collect shard results).
+static void WriteReportOut(const FString &Params, const FMWCS_Report &Report)
+{
+    FString ReportOut;
+    if (FParse::Value(*Params, TEXT("-ReportOut="), ReportOut) && !ReportOut.IsEmpty())
+    {
+        if (!FFileHelper::SaveStringToFile(MWCS_ReportJson::ToJsonString(Report), *ReportOut))
+        {
+            UE_LOG(LogTemp, Error, TEXT("MWCS: Failed to write report to '%s'"), *ReportOut);
+        }
+    }
+}
+
+static FMWCS_Report RunPipelineBenchmark(EMWCS_BuildMode Mode, const FMWCS_SpecFilter &Filter)
+{
+    const double SerialStart = FPlatformTime::Seconds();
+    FMWCS_Report SerialReport = FMWCS_Service::Get().BuildAll(Mode, Filter);
+    const double SerialSeconds = FPlatformTime::Seconds() - SerialStart;
+
+    const double PipelinedStart = FPlatformTime::Seconds();
+    FMWCS_Report PipelinedReport = FMWCS_Service::Get().BuildAllPipelined(Mode, Filter);
+    const double PipelinedSeconds = FPlatformTime::Seconds() - PipelinedStart;
+
+    UE_LOG(LogTemp, Display, TEXT("MWCS: Pipeline benchmark (%d spec(s)): serial %.3fs, pipelined %.3fs, speedup %.2fx"),
+           PipelinedReport.SpecsProcessed,
+           SerialSeconds,
+           PipelinedSeconds,
+           PipelinedSeconds > 0.0 ? SerialSeconds / PipelinedSeconds : 0.0);
+
+    // CreateMissing skips assets made by the serial pass, so only Repair/ForceRecreate are comparable.
+    if (Mode != EMWCS_BuildMode::CreateMissing && !ReportsEquivalent(SerialReport, PipelinedReport))
+    {
+        FMWCS_Issue Issue;
+        Issue.Severity = EMWCS_IssueSeverity::Warning;
+        Issue.Code = TEXT("Pipeline.ReportMismatch");
+        Issue.Message = TEXT("Pipelined BuildAll produced a different report than the serial path.");
+        Issue.Context = TEXT("BenchmarkPipeline");
+        PipelinedReport.Issues.Add(MoveTemp(Issue));
+    }
+
+    return PipelinedReport;
+}
+
+// Request handlers shared by the one-shot commandlets and MWCS_Server. Each logs the report,
+// honours -ReportOut= and returns the commandlet exit code.
+static int32 RunValidateRequest(const FString &Params, FMWCS_Report &OutReport)
+{
+    FMWCS_SpecFilter Filter;
+    if (!FMWCS_SpecFilter::FromParams(Params, Filter, OutReport))
+    {
+        LogReportToOutput(OutReport);
+        return 1;
+    }
+
+    OutReport = FMWCS_Service::Get().ValidateAll(Filter);
+    LogReportToOutput(OutReport);
+    WriteReportOut(Params, OutReport);
+    return ExitCodeForReport(OutReport, Params);
+}
+
+static int32 RunCreateRequest(const FString &Params, FMWCS_Report &OutReport)
 {
     const EMWCS_BuildMode Mode = ParseMode(Params);
-    FMWCS_Report Report = FMWCS_Service::Get().BuildAll(Mode);
-    LogReportToOutput(Report);
-    const bool bFailWarnings = ShouldFailOnWarnings(Params);
-    const bool bFailErrors = ShouldFailOnErrors(Params);
-    if (bFailErrors && Report.HasErrors())
+
+    // -AssetIndexOut=<file>: shard workers hand their index entries to the coordinator instead of rewriting the shared file.
+    FString AssetIndexOut;
+    FParse::Value(*Params, TEXT("-AssetIndexOut="), AssetIndexOut);
+    FMWCS_AssetIndex::Get().SetFragmentPath(AssetIndexOut);
+
+    FMWCS_SpecFilter Filter;
+    if (!FMWCS_SpecFilter::FromParams(Params, Filter, OutReport))
     {
+        LogReportToOutput(OutReport);
         return 1;
     }
-    if (bFailWarnings && Report.HasWarnings())
+
+    if (Params.Contains(TEXT("-BenchmarkPipeline")))
     {
-        return 2;
+        OutReport = RunPipelineBenchmark(Mode, Filter);
+    }
+    else if (Params.Contains(TEXT("-Validate")))
+    {
+        OutReport = FMWCS_Service::Get().BuildAndValidateAll(Mode, Filter);
+    }
+    else if (Params.Contains(TEXT("-Pipeline")))
+    {
+        OutReport = FMWCS_Service::Get().BuildAllPipelined(Mode, Filter);
+    }
+    else
+    {
+        OutReport = FMWCS_Service::Get().BuildAll(Mode, Filter);
+    }
+
+    LogReportToOutput(OutReport);
+    WriteReportOut(Params, OutReport);
+    return ExitCodeForReport(OutReport, Params);
+}
+
+static int32 RunPlanRequest(const FString &Params, FMWCS_Report &OutReport)
+{
+    FMWCS_SpecFilter Filter;
+    if (!FMWCS_SpecFilter::FromParams(Params, Filter, OutReport))
+    {
+        LogReportToOutput(OutReport);
+        return 1;
+    }
+
+    const FMWCS_Plan Plan = FMWCS_Service::Get().PlanAll(Filter);
+
+    for (const FMWCS_PlanEntry &Entry : Plan.Entries)
+    {
+        UE_LOG(LogTemp, Display, TEXT("MWCS Plan: %-12s %s"), *MWCS_PlanJson::ChangeToString(Entry.Change), *Entry.AssetPath);
+        for (const FString &Reason : Entry.Reasons)
+        {
+            UE_LOG(LogTemp, Display, TEXT("MWCS Plan:     %s"), *Reason);
+        }
+    }
+    UE_LOG(LogTemp, Display, TEXT("MWCS Plan: %d new, %d structural, %d property-only, %d unchanged"),
+           Plan.Count(EMWCS_PlanChange::New),
+           Plan.Count(EMWCS_PlanChange::Structural),
+           Plan.Count(EMWCS_PlanChange::PropertyOnly),
+           Plan.Count(EMWCS_PlanChange::Unchanged));
+
+    OutReport = Plan.Report;
+    LogReportToOutput(OutReport);
+    WriteReportOut(Params, OutReport);
+
+    const int32 ExitCode = ExitCodeForReport(OutReport, Params);
+    if (ExitCode != 0)
+    {
+        return ExitCode;
+    }
+    if (Params.Contains(TEXT("-FailOnChanges")) && Plan.HasChanges())
+    {
+        return 3;
+    }
+    return 0;
+}
+
+// -Path=<long package path or folder>  -Out=<directory> (defaults to Saved/MWCS/ExtractedSpecs)
+static int32 RunExtractRequest(const FString &Params, FMWCS_Report &OutReport)
+{
+    FString Path;
+    if (!FParse::Value(*Params, TEXT("-Path="), Path) || Path.IsEmpty())
+    {
+        const UMWCS_Settings *Settings = UMWCS_Settings::Get();
+        Path = Settings ? Settings->OutputRootPath : FString();
+    }
+    if (Path.IsEmpty())
+    {
+        FMWCS_Issue Issue;
+        Issue.Severity = EMWCS_IssueSeverity::Error;
+        Issue.Code = TEXT("Extract.MissingPath");
+        Issue.Message = TEXT("Expected -Path=<package path or folder> (or set OutputRootPath).");
+        Issue.Context = TEXT("Extract");
+        OutReport.Issues.Add(MoveTemp(Issue));
+        LogReportToOutput(OutReport);
+        return 1;
+    }
+
+    FMWCS_ExtractBatchOptions BatchOptions;
+    if (!FParse::Value(*Params, TEXT("-Out="), BatchOptions.OutputDir))
+    {
+        FParse::Value(*Params, TEXT("-OutputPath="), BatchOptions.OutputDir);
+    }
+    FParse::Value(*Params, TEXT("-BatchSize="), BatchOptions.BatchSize);
+    BatchOptions.bForce = FParse::Param(*Params, TEXT("Force"));
+
+    FMWCS_DiscoveryStats Discovery;
+    FMWCS_Discovery::ScanPath(Path, Discovery);
+    FMWCS_Discovery::AddReportEntry(Discovery, OutReport);
+
+    IAssetRegistry &AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry")).Get();
+    TArray<FAssetData> Assets;
+    AssetRegistry.GetAssetsByPackageName(FName(*Path), Assets);
+    if (Assets.Num() == 0)
+    {
+        FARFilter ARFilter;
+        ARFilter.PackagePaths.Add(FName(*Path));
+        ARFilter.bRecursivePaths = true;
+        ARFilter.ClassPaths.Add(UWidgetBlueprint::StaticClass()->GetClassPathName());
+        ARFilter.bRecursiveClasses = true;
+        AssetRegistry.GetAssets(ARFilter, Assets);
+    }
+    Assets.Sort([](const FAssetData &A, const FAssetData &B)
+                { return A.PackageName.LexicalLess(B.PackageName); });
+
+    FMWCS_ExtractOptions Options;
+    Options.bMinimal = FParse::Param(*Params, TEXT("Minimal"));
+    Options.bMinified = FParse::Param(*Params, TEXT("Minified"));
+    BatchOptions.bParityCheck = FParse::Param(*Params, TEXT("ParityCheck"));
+    FMWCS_WidgetExtractor::ExtractAssets(Assets, Options, BatchOptions, OutReport);
+
+    LogReportToOutput(OutReport);
+    WriteReportOut(Params, OutReport);
+    return ExitCodeForReport(OutReport, Params);
+}
+
+// -Specs=<directory of spec JSON> (defaults to the plugin's Tests/TestSpecs)  -Minimal
+static int32 RunRoundTripRequest(const FString &Params, FMWCS_Report &OutReport)
+{
+    FString SpecDir;
+    if (!FParse::Value(*Params, TEXT("-Specs="), SpecDir) || SpecDir.IsEmpty())
+    {
+        SpecDir = FMWCS_RoundTrip::GetDefaultSpecDir();
+    }
+    else if (FPaths::IsRelative(SpecDir))
+    {
+        SpecDir = FPaths::Combine(FPaths::ProjectDir(), SpecDir);
+    }
+
+    FMWCS_RoundTripOptions Options;
+    Options.bMinimal = FParse::Param(*Params, TEXT("Minimal"));
+
+    TArray<FMWCS_RoundTripResult> Results;
+    FMWCS_RoundTrip::RunDirectory(SpecDir, Options, Results, OutReport);
+
+    for (const FMWCS_RoundTripResult &Result : Results)
+    {
+        UE_LOG(LogTemp, Display, TEXT("MWCS RoundTrip: %-4s %-40s parse %7.1fms  build %8.1fms  extract %7.1fms  compare %5.1fms"),
+               Result.bPassed ? TEXT("OK") : TEXT("FAIL"),
+               *FPaths::GetCleanFilename(Result.SpecPath),
+               Result.ParseMs,
+               Result.BuildMs,
+               Result.ExtractMs,
+               Result.CompareMs);
+        for (const FString &Difference : Result.Differences)
+        {
+            UE_LOG(LogTemp, Error, TEXT("MWCS RoundTrip:      %s"), *Difference);
+        }
+    }
+
+    LogReportToOutput(OutReport);
+    WriteReportOut(Params, OutReport);
+
+    // A mismatch always fails the run; -FailOnErrors is implied.
+    if (OutReport.HasErrors())
+    {
+        return 1;
+    }
+    return ExitCodeForReport(OutReport, Params);
+}
+
+// -Thresholds=BuildAll:0.1,Extract:0.25
+static void MWCS_ParseThresholds(const FString &Params, TMap<FString, double> &OutThresholds)
+{
+    FString List;
+    if (!FParse::Value(*Params, TEXT("-Thresholds="), List, /*bShouldStopOnSeparator*/ false))
+    {
+        return;
+    }
+    TArray<FString> Entries;
+    List.ParseIntoArray(Entries, TEXT(","), true);
+    for (const FString &Entry : Entries)
+    {
+        FString Stage;
+        FString Value;
+        if (Entry.Split(TEXT(":"), &Stage, &Value))
+        {
+            OutThresholds.Add(Stage.TrimStartAndEnd(), FCString::Atod(*Value));
+        }
+    }
+}
+
+// -NumSpecs=<N> (100)  -Nodes=<widgets per spec> (200)  -Seed=<N> (1)  -Iterations=<N> (1)  -Corpus=<dir>
+// -OutputRoot=<package path>  -Mode=<build mode> (ForceRecreate)  -Out=<table file>
+// -SaveBaseline=<file>  -Baseline=<file> [-Threshold=0.1] [-Thresholds=Stage:0.1,...] [-MinDeltaMs=5]
+static int32 RunBenchmarkRequest(const FString &Params, FMWCS_Report &OutReport)
+{
+    FMWCS_BenchmarkOptions Options;
+    FParse::Value(*Params, TEXT("-NumSpecs="), Options.Corpus.NumSpecs);
+    FParse::Value(*Params, TEXT("-Nodes="), Options.Corpus.NodesPerSpec);
+    FParse::Value(*Params, TEXT("-Seed="), Options.Corpus.Seed);
+    FParse::Value(*Params, TEXT("-MaxChildren="), Options.Corpus.MaxChildren);
+    FParse::Value(*Params, TEXT("-OutputRoot="), Options.Corpus.OutputRootPath);
+    FParse::Value(*Params, TEXT("-Iterations="), Options.Iterations);
+    Options.Corpus.NumSpecs = FMath::Max(1, Options.Corpus.NumSpecs);
+    Options.Corpus.NodesPerSpec = FMath::Max(1, Options.Corpus.NodesPerSpec);
+    Options.Mode = Params.Contains(TEXT("-Mode=")) ? ParseMode(Params) : EMWCS_BuildMode::ForceRecreate;
+
+    if (FParse::Value(*Params, TEXT("-Corpus="), Options.CorpusDir) && FPaths::IsRelative(Options.CorpusDir))
+    {
+        Options.CorpusDir = FPaths::ConvertRelativePathToFull(FPaths::Combine(FPaths::ProjectDir(), Options.CorpusDir));
+    }
+
+    // Read the baseline before the run so a bad path fails fast.
+    FString BaselinePath;
+    FMWCS_BenchmarkBaseline Baseline;
+    const bool bCompare = FParse::Value(*Params, TEXT("-Baseline="), BaselinePath) && !BaselinePath.IsEmpty();
+    if (bCompare && !FMWCS_Benchmark::LoadBaseline(BaselinePath, Baseline, OutReport))
+    {
+        LogReportToOutput(OutReport);
+        return 1;
+    }
+
+    FMWCS_BenchmarkResult Result;
+    FMWCS_Benchmark::Run(Options, Result, OutReport);
+
+    const int64 TotalNodes = static_cast<int64>(Result.NumSpecs) * Result.NodesPerSpec;
+    for (const FMWCS_BenchmarkStage &Stage : Result.Stages)
+    {
+        UE_LOG(LogTemp, Display, TEXT("MWCS Benchmark: %-12s %10.1fms median of %d  %8.2fms/spec  %10.0f nodes/s  used %8.1fMB (%+7.1fMB)  peak %8.1fMB  %d error(s)"),
+               *Stage.Name, Stage.MedianMs, Stage.SamplesMs.Num(), Stage.MedianMs / Result.NumSpecs,
+               Stage.MedianMs > 0.0 ? TotalNodes * 1000.0 / Stage.MedianMs : 0.0,
+               Stage.UsedMB, Stage.DeltaMB, Stage.PeakMB, Stage.Errors);
+    }
+
+    FString TablePath;
+    if (!FParse::Value(*Params, TEXT("-Out="), TablePath) || TablePath.IsEmpty())
+    {
+        TablePath = FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("MWCS"), TEXT("Benchmarks"),
+                                    FString::Printf(TEXT("MWCS_Benchmark_%s.json"), *FDateTime::UtcNow().ToString(TEXT("%Y%m%d_%H%M%S"))));
+    }
+    if (FFileHelper::SaveStringToFile(FMWCS_Benchmark::ToJson(Result), *TablePath))
+    {
+        UE_LOG(LogTemp, Display, TEXT("MWCS Benchmark: table written to %s"), *TablePath);
+    }
+    else
+    {
+        UE_LOG(LogTemp, Error, TEXT("MWCS: Failed to write benchmark table to '%s'"), *TablePath);
+    }
+
+    FMWCS_BenchmarkGateOptions Gate;
+    FParse::Value(*Params, TEXT("-Threshold="), Gate.DefaultThreshold);
+    FParse::Value(*Params, TEXT("-MinDeltaMs="), Gate.MinDeltaMs);
+    MWCS_ParseThresholds(Params, Gate.Thresholds);
+
+    FString SaveBaselinePath;
+    if (FParse::Value(*Params, TEXT("-SaveBaseline="), SaveBaselinePath) && !SaveBaselinePath.IsEmpty())
+    {
+        if (FFileHelper::SaveStringToFile(FMWCS_Benchmark::ToBaselineJson(Result, Gate.Thresholds), *SaveBaselinePath))
+        {
+            UE_LOG(LogTemp, Display, TEXT("MWCS Benchmark: baseline written to %s"), *SaveBaselinePath);
+        }
+        else
+        {
+            UE_LOG(LogTemp, Error, TEXT("MWCS: Failed to write benchmark baseline to '%s'"), *SaveBaselinePath);
+        }
+    }
+
+    bool bGatePassed = true;
+    if (bCompare)
+    {
+        TArray<FMWCS_BenchmarkDiffRow> Rows;
+        bGatePassed = FMWCS_Benchmark::Compare(Result, Baseline, Gate, Rows, OutReport);
+
+        UE_LOG(LogTemp, Display, TEXT("MWCS Benchmark: %-12s %12s %12s %9s %9s  %s"), TEXT("Stage"), TEXT("Baseline"), TEXT("Current"), TEXT("Delta"), TEXT("Allowed"), TEXT("Result"));
+        for (const FMWCS_BenchmarkDiffRow &Row : Rows)
+        {
+            const FString Allowed = Row.bGated ? FString::Printf(TEXT("+%.1f%%"), Row.Threshold * 100.0) : FString(TEXT("-"));
+            const TCHAR *Verdict = Row.bRegressed ? TEXT("REGRESSED") : Row.bGated ? TEXT("ok") : TEXT("not gated");
+            if (Row.bRegressed)
+            {
+                UE_LOG(LogTemp, Error, TEXT("MWCS Benchmark: %-12s %10.1fms %10.1fms %+8.1f%% %9s  %s"), *Row.Stage, Row.BaselineMs, Row.CurrentMs, Row.DeltaPct, *Allowed, Verdict);
+            }
+            else
+            {
+                UE_LOG(LogTemp, Display, TEXT("MWCS Benchmark: %-12s %10.1fms %10.1fms %+8.1f%% %9s  %s"), *Row.Stage, Row.BaselineMs, Row.CurrentMs, Row.DeltaPct, *Allowed, Verdict);
+            }
+        }
+    }
+
+    LogReportToOutput(OutReport);
+    WriteReportOut(Params, OutReport);
+
+    // The gate's own exit code wins: its Benchmark.Regression errors would otherwise turn into 1 under -FailOnErrors.
+    if (!bGatePassed)
+    {
+        return 4;
+    }
+    return ExitCodeForReport(OutReport, Params);
+}
+
+// -Path=<package path> (OutputRootPath)  -Instances=<N> (100)  -Passes=<N> (3)  -Out=<table file>
+static int32 RunRuntimeBenchRequest(const FString &Params, FMWCS_Report &OutReport)
+{
+    FMWCS_RuntimeBenchOptions Options;
+    FParse::Value(*Params, TEXT("-Path="), Options.Path);
+    FParse::Value(*Params, TEXT("-Instances="), Options.Instances);
+    FParse::Value(*Params, TEXT("-Passes="), Options.Passes);
+    if (Options.Path.IsEmpty())
+    {
+        Options.Path = GetDefault<UMWCS_Settings>()->OutputRootPath;
+    }
+
+    FMWCS_DiscoveryStats Discovery;
+    FMWCS_Discovery::ScanPath(Options.Path, Discovery);
+    FMWCS_Discovery::AddReportEntry(Discovery, OutReport);
+
+    FMWCS_RuntimeBenchResult Result;
+    FMWCS_RuntimeBench::Run(Options, Result, OutReport);
+
+    // Most expensive first.
+    TArray<FMWCS_RuntimeBenchRow> Rows = Result.Rows;
+    Rows.Sort([](const FMWCS_RuntimeBenchRow &A, const FMWCS_RuntimeBenchRow &B)
+              { return A.TotalUs() > B.TotalUs(); });
+    for (const FMWCS_RuntimeBenchRow &Row : Rows)
+    {
+        UE_LOG(LogTemp, Display, TEXT("MWCS RuntimeBench: %-48s %5d widget(s) %6d swidget(s)  create %8.1fus  take %8.1fus  prepass %8.1fus  %7.1f UObject(s)  %8.1fKB"),
+               *Row.AssetPath, Row.Widgets, Row.SlateWidgets, Row.CreateUs, Row.TakeWidgetUs, Row.PrepassUs, Row.UObjects, Row.MemoryKB);
+    }
+
+    FString TablePath;
+    if (!FParse::Value(*Params, TEXT("-Out="), TablePath) || TablePath.IsEmpty())
+    {
+        TablePath = FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("MWCS"), TEXT("Benchmarks"),
+                                    FString::Printf(TEXT("MWCS_RuntimeBench_%s.json"), *FDateTime::UtcNow().ToString(TEXT("%Y%m%d_%H%M%S"))));
+    }
+    if (FFileHelper::SaveStringToFile(FMWCS_RuntimeBench::ToJson(Result), *TablePath))
+    {
+        UE_LOG(LogTemp, Display, TEXT("MWCS RuntimeBench: table written to %s"), *TablePath);
+    }
+    else
+    {
+        UE_LOG(LogTemp, Error, TEXT("MWCS: Failed to write runtime benchmark table to '%s'"), *TablePath);
+    }
+
+    LogReportToOutput(OutReport);
+    WriteReportOut(Params, OutReport);
+    return ExitCodeForReport(OutReport, Params);
+}
+
+// -Out=<snapshot file>  -Baseline=<snapshot file> [-Tolerance=0.5]  -FillSize=<W>x<H> (1920x1080), plus the subset selection flags
+static int32 RunLayoutSnapshotRequest(const FString &Params, FMWCS_Report &OutReport)
+{
+    FMWCS_SpecFilter Filter;
+    if (!FMWCS_SpecFilter::FromParams(Params, Filter, OutReport))
+    {
+        LogReportToOutput(OutReport);
+        return 1;
+    }
+
+    FMWCS_LayoutSnapshotOptions Options;
+    FParse::Value(*Params, TEXT("-Tolerance="), Options.Tolerance);
+    FString FillSize;
+    FString Width;
+    FString Height;
+    if (FParse::Value(*Params, TEXT("-FillSize="), FillSize) && FillSize.Split(TEXT("x"), &Width, &Height))
+    {
+        Options.FillScreenSize = FVector2D(FCString::Atod(*Width), FCString::Atod(*Height));
+    }
+
+    // Read the baseline before capturing so a bad path fails fast.
+    FString BaselinePath;
+    FMWCS_LayoutSnapshotData Baseline;
+    const bool bCompare = FParse::Value(*Params, TEXT("-Baseline="), BaselinePath) && !BaselinePath.IsEmpty();
+    if (bCompare && !FMWCS_LayoutSnapshot::Load(BaselinePath, Baseline, OutReport))
+    {
+        LogReportToOutput(OutReport);
+        return 1;
+    }
+
+    FMWCS_LayoutSnapshotData Snapshot;
+    FMWCS_LayoutSnapshot::CaptureAll(Filter, Options, Snapshot, OutReport);
+    for (const TPair<FString, FMWCS_SpecLayout> &Spec : Snapshot.Specs)
+    {
+        UE_LOG(LogTemp, Display, TEXT("MWCS Layout: %-40s %7.1fx%-7.1f %4d widget(s)"), *Spec.Key, Spec.Value.ViewportSize.X, Spec.Value.ViewportSize.Y, Spec.Value.Widgets.Num());
+    }
+
+    FString SnapshotPath;
+    if (!FParse::Value(*Params, TEXT("-Out="), SnapshotPath) || SnapshotPath.IsEmpty())
+    {
+        SnapshotPath = FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("MWCS"), TEXT("Layout"),
+                                       FString::Printf(TEXT("MWCS_Layout_%s.json"), *FDateTime::UtcNow().ToString(TEXT("%Y%m%d_%H%M%S"))));
+    }
+    if (FFileHelper::SaveStringToFile(FMWCS_LayoutSnapshot::ToJson(Snapshot), *SnapshotPath))
+    {
+        UE_LOG(LogTemp, Display, TEXT("MWCS Layout: snapshot written to %s"), *SnapshotPath);
+    }
+    else
+    {
+        UE_LOG(LogTemp, Error, TEXT("MWCS: Failed to write layout snapshot to '%s'"), *SnapshotPath);
+    }
+
+    if (bCompare)
+    {
+        FMWCS_LayoutSnapshot::Compare(Baseline, Snapshot, Options, OutReport);
+    }
+
+    LogReportToOutput(OutReport);
+    WriteReportOut(Params, OutReport);
+
+    // A moved or missing widget always fails a comparison; -FailOnErrors is implied.
+    if (bCompare && OutReport.HasErrors())
+    {
+        return 1;
+    }
+    return ExitCodeForReport(OutReport, Params);
+}
+
+// -Rules=Depth:12,WidgetCount:400:Error,HitTestable:Off (on top of the settings), plus the subset selection flags
+static int32 RunLintRequest(const FString &Params, FMWCS_Report &OutReport)
+{
+    FMWCS_SpecFilter Filter;
+    if (!FMWCS_SpecFilter::FromParams(Params, Filter, OutReport))
+    {
+        LogReportToOutput(OutReport);
+        return 1;
+    }
+
+    MWCS_Core::FPerfLintOptions Options = FMWCS_PerfLint::GetOptions();
+    FString Rules;
+    if (FParse::Value(*Params, TEXT("-Rules="), Rules, /*bShouldStopOnSeparator*/ false) && !FMWCS_PerfLint::ApplyOverrides(Rules, Options, OutReport))
+    {
+        LogReportToOutput(OutReport);
+        return 1;
+    }
+
+    FMWCS_PerfLint::LintAll(Filter, Options, OutReport);
+    LogReportToOutput(OutReport);
+    WriteReportOut(Params, OutReport);
+    return ExitCodeForReport(OutReport, Params);
+}
+
+int32 UMWCS_ValidateWidgetsCommandlet::Main(const FString &Params)
+{
+    FMWCS_Report Report;
+    return RunValidateRequest(Params, Report);
+}
+
+int32 UMWCS_CreateWidgetsCommandlet::Main(const FString &Params)
+{
+    FMWCS_Report Report;
+    return RunCreateRequest(Params, Report);
+}
+
+int32 UMWCS_PlanWidgetsCommandlet::Main(const FString &Params)
+{
+    FMWCS_Report Report;
+    return RunPlanRequest(Params, Report);
+}
+
+int32 UMWCS_ExtractWidgetsCommandlet::Main(const FString &Params)
+{
+    FMWCS_Report Report;
+    return RunExtractRequest(Params, Report);
+}
+
+int32 UMWCS_RoundTripCommandlet::Main(const FString &Params)
+{
+    FMWCS_Report Report;
+    return RunRoundTripRequest(Params, Report);
+}
+
+int32 UMWCS_BenchmarkCommandlet::Main(const FString &Params)
+{
+    FMWCS_Report Report;
+    return RunBenchmarkRequest(Params, Report);
+}
+
+int32 UMWCS_RuntimeBenchCommandlet::Main(const FString &Params)
+{
+    FMWCS_Report Report;
+    return RunRuntimeBenchRequest(Params, Report);
+}
+
+int32 UMWCS_LayoutSnapshotCommandlet::Main(const FString &Params)
+{
+    FMWCS_Report Report;
+    return RunLayoutSnapshotRequest(Params, Report);
+}
+
+int32 UMWCS_LintWidgetsCommandlet::Main(const FString &Params)
+{
+    FMWCS_Report Report;
+    return RunLintRequest(Params, Report);
+}
+
+int32 UMWCS_BuildCoordinatorCommandlet::Main(const FString &Params)
+{
+    int32 NumWorkers = FMath::Clamp(FPlatformMisc::NumberOfCores() / 2, 1, 16);
+    FParse::Value(*Params, TEXT("-Workers="), NumWorkers);
+    NumWorkers = FMath::Max(1, NumWorkers);
+
+    FString WorkerCommandlet = TEXT("MWCS_CreateWidgets");
+    FParse::Value(*Params, TEXT("-Commandlet="), WorkerCommandlet);
+
+    // Forward the selection/build options; failure flags are applied once to the merged report.
+    FString Forwarded;
+    {
+        const TCHAR *Stream = *Params;
+        FString Token;
+        while (FParse::Token(Stream, Token, /*UseEscape*/ false))
+        {
+            static const TCHAR *ForwardPrefixes[] = {TEXT("-Mode="), TEXT("-Only="), TEXT("-Provider="), TEXT("-ChangedFiles="), TEXT("-Validate"), TEXT("-Pipeline")};
+            for (const TCHAR *Prefix : ForwardPrefixes)
+            {
+                if (Token.StartsWith(Prefix, ESearchCase::IgnoreCase))
+                {
+                    Forwarded += TEXT(" ") + Token;
+                    break;
+                }
+            }
+        }
+    }
+
+    const FString RunDir = FPaths::ConvertRelativePathToFull(FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("MWCS"), TEXT("Coordinator"), FDateTime::UtcNow().ToString(TEXT("%Y%m%d_%H%M%S"))));
+    FPlatformFileManager::Get().GetPlatformFile().CreateDirectoryTree(*RunDir);
+
+    const FString Executable = FPlatformProcess::ExecutablePath();
+    const FString ProjectFile = FPaths::ConvertRelativePathToFull(FPaths::GetProjectFilePath());
+
+    struct FWorker
+    {
+        FProcHandle Handle;
+        FString ReportPath;
+        FString LogPath;
+        FString IndexPath;
+        int32 ReturnCode = -1;
+        double StartSeconds = 0.0;
+        double ElapsedSeconds = 0.0;
+        bool bRunning = false;
+    };
+    TArray<FWorker> Workers;
+    Workers.SetNum(NumWorkers);
+
+    const double RunStart = FPlatformTime::Seconds();
+    for (int32 Index = 0; Index < NumWorkers; ++Index)
+    {
+        FWorker &Worker = Workers[Index];
+        Worker.ReportPath = FPaths::Combine(RunDir, FString::Printf(TEXT("Shard_%d.json"), Index));
+        Worker.LogPath = FPaths::Combine(RunDir, FString::Printf(TEXT("Shard_%d.log"), Index));
+        Worker.IndexPath = FPaths::Combine(RunDir, FString::Printf(TEXT("Shard_%d.index.json"), Index));
+
+        const FString Args = FString::Printf(
+            TEXT("\"%s\" -run=%s -Shard=%d/%d -ReportOut=\"%s\" -AssetIndexOut=\"%s\" -abslog=\"%s\" -unattended -nop4 -NullRHI -nosplash -nosound%s"),
+            *ProjectFile, *WorkerCommandlet, Index, NumWorkers, *Worker.ReportPath, *Worker.IndexPath, *Worker.LogPath, *Forwarded);
+
+        UE_LOG(LogTemp, Display, TEXT("MWCS: Starting shard %d/%d: %s %s"), Index, NumWorkers, *Executable, *Args);
+        Worker.StartSeconds = FPlatformTime::Seconds();
+        Worker.Handle = FPlatformProcess::CreateProc(*Executable, *Args, /*bLaunchDetached*/ false, /*bLaunchHidden*/ true, /*bLaunchReallyHidden*/ true, nullptr, 0, nullptr, nullptr);
+        Worker.bRunning = Worker.Handle.IsValid();
+    }
+
+    for (int32 Running = NumWorkers; Running > 0;)
+    {
+        Running = 0;
+        for (int32 Index = 0; Index < NumWorkers; ++Index)
+        {
+            FWorker &Worker = Workers[Index];
+            if (!Worker.bRunning)
+            {
+                continue;
+            }
+            if (FPlatformProcess::IsProcRunning(Worker.Handle))
+            {
+                ++Running;
+                continue;
+            }
+
+            FPlatformProcess::GetProcReturnCode(Worker.Handle, &Worker.ReturnCode);
+            FPlatformProcess::CloseProc(Worker.Handle);
+            Worker.bRunning = false;
+            Worker.ElapsedSeconds = FPlatformTime::Seconds() - Worker.StartSeconds;
+            UE_LOG(LogTemp, Display, TEXT("MWCS: Shard %d/%d finished in %.1fs (exit code %d)"), Index, NumWorkers, Worker.ElapsedSeconds, Worker.ReturnCode);
+        }
+        if (Running > 0)
+        {
+            FPlatformProcess::Sleep(0.25f);
+        }
     }
+
+    // Merge in shard order so the combined report is deterministic.
+    FMWCS_Report Merged;
+    bool bWorkerFailed = false;
+    for (int32 Index = 0; Index < NumWorkers; ++Index)
+    {
+        const FWorker &Worker = Workers[Index];
+        const FString ShardLabel = FString::Printf(TEXT("Shard %d/%d"), Index, NumWorkers);
+
+        FString Json;
+        FMWCS_Report ShardReport;
+        if (Worker.ReturnCode != 0 || !FFileHelper::LoadFileToString(Json, *Worker.ReportPath) || !MWCS_ReportJson::FromJsonString(Json, ShardReport))
+        {
+            bWorkerFailed = true;
+            FMWCS_Issue Issue;
+            Issue.Severity = EMWCS_IssueSeverity::Error;
+            Issue.Code = TEXT("Coordinator.WorkerFailed");
+            Issue.Message = FString::Printf(TEXT("Worker exited with code %d or produced no report; see %s"), Worker.ReturnCode, *Worker.LogPath);
+            Issue.Context = ShardLabel;
+            Merged.Issues.Add(MoveTemp(Issue));
+            continue;
+        }
+        Merged.Append(ShardReport);
+    }
+
+    // Workers only wrote index fragments; fold them into Saved/MWCS/AssetIndex.json in one write. A crashed worker's
+    // partial fragment is still merged, since the assets it lists were built.
+    for (const FWorker &Worker : Workers)
+    {
+        FMWCS_AssetIndex::Get().MergeFragment(Worker.IndexPath);
+    }
+    FMWCS_AssetIndex::Get().SaveIfDirty();
+
+    UE_LOG(LogTemp, Display, TEXT("MWCS: Coordinator finished %d shard(s) in %.1fs"), NumWorkers, FPlatformTime::Seconds() - RunStart);
+
+    FMWCS_Service::Get().SaveReportJson(Merged, TEXT("Coordinated"));
+    LogReportToOutput(Merged);
+    WriteReportOut(Params, Merged);
+
+    if (bWorkerFailed)
+    {
+        return 1;
+    }
+    return ExitCodeForReport(Merged, Params);
+}
+
+// ---------------------------------------------------------------------------
+// MWCS_Server
+//
+// Protocol (one request per connection, UTF-8, newline-terminated lines):
+//   client -> server:  <command> [params]          e.g. "create -Mode=Repair -Only=WBP_HUD* -FailOnErrors"
+//   server -> client:  ISSUE <Severity> <Code> | <Context> | <Message>   (one per issue, streamed)
+//                      REPORT <UTF-16 code unit count>\n<report json>
+//                      EXIT <code>
+// Commands: validate, create (alias build), plan, extract, ping, shutdown.
+// ---------------------------------------------------------------------------
+
+static bool MWCS_SendUtf8(FSocket *Socket, const FString &Text)
+{
+    const FTCHARToUTF8 Utf8(*Text);
+    const uint8 *Data = reinterpret_cast<const uint8 *>(Utf8.Get());
+    int32 Remaining = Utf8.Length();
+    while (Remaining > 0)
+    {
+        int32 Sent = 0;
+        if (!Socket->Send(Data, Remaining, Sent) || Sent <= 0)
+        {
+            return false;
+        }
+        Data += Sent;
+        Remaining -= Sent;
+    }
+    return true;
+}
+
+static bool MWCS_ReceiveLine(FSocket *Socket, FString &OutLine)
+{
+    static constexpr int32 MaxRequestBytes = 64 * 1024;
+
+    TArray<uint8> Buffer;
+    while (Buffer.Num() < MaxRequestBytes)
+    {
+        if (!Socket->Wait(ESocketWaitConditions::WaitForRead, FTimespan::FromSeconds(30.0)))
+        {
+            return false;
+        }
+
+        uint8 Byte = 0;
+        int32 Read = 0;
+        if (!Socket->Recv(&Byte, 1, Read) || Read == 0)
+        {
+            return false;
+        }
+        if (Byte == '\n')
+        {
+            break;
+        }
+        if (Byte != '\r')
+        {
+            Buffer.Add(Byte);
+        }
+    }
+
+    const FUTF8ToTCHAR Converted(reinterpret_cast<const ANSICHAR *>(Buffer.GetData()), Buffer.Num());
+    OutLine = FString(Converted.Length(), Converted.Get());
+    return true;
+}
+
+static FString MWCS_SeverityLabel(EMWCS_IssueSeverity Severity)
+{
+    switch (Severity)
+    {
+    case EMWCS_IssueSeverity::Error:
+        return TEXT("Error");
+    case EMWCS_IssueSeverity::Warning:
+        return TEXT("Warning");
+    default:
+        return TEXT("Info");
+    }
+}
+
+// Returns false when the client asked the server to shut down.
+static bool MWCS_HandleServerClient(FSocket *Client)
+{
+    FString Line;
+    if (!MWCS_ReceiveLine(Client, Line))
+    {
+        return true;
+    }
+    Line.TrimStartAndEndInline();
+
+    FString Command;
+    FString Params;
+    if (!Line.Split(TEXT(" "), &Command, &Params))
+    {
+        Command = Line;
+    }
+    Command.ToLowerInline();
+
+    UE_LOG(LogTemp, Display, TEXT("MWCS Server: request '%s'"), *Line);
+
+    if (Command == TEXT("ping"))
+    {
+        MWCS_SendUtf8(Client, TEXT("EXIT 0\n"));
+        return true;
+    }
+    if (Command == TEXT("shutdown"))
+    {
+        MWCS_SendUtf8(Client, TEXT("EXIT 0\n"));
+        return false;
+    }
+
+    FMWCS_Report Report;
+    int32 ExitCode = 0;
+    const double Start = FPlatformTime::Seconds();
+    if (Command == TEXT("validate"))
+    {
+        ExitCode = RunValidateRequest(Params, Report);
+    }
+    else if (Command == TEXT("create") || Command == TEXT("build"))
+    {
+        ExitCode = RunCreateRequest(Params, Report);
+    }
+    else if (Command == TEXT("plan"))
+    {
+        ExitCode = RunPlanRequest(Params, Report);
+    }
+    else if (Command == TEXT("extract"))
+    {
+        ExitCode = RunExtractRequest(Params, Report);
+    }
+    else
+    {
+        FMWCS_Issue Issue;
+        Issue.Severity = EMWCS_IssueSeverity::Error;
+        Issue.Code = TEXT("Server.UnknownCommand");
+        Issue.Message = FString::Printf(TEXT("Unknown command '%s'. Expected validate, create, plan, extract, ping or shutdown."), *Command);
+        Issue.Context = TEXT("MWCS_Server");
+        Report.Issues.Add(MoveTemp(Issue));
+        ExitCode = 1;
+    }
+    UE_LOG(LogTemp, Display, TEXT("MWCS Server: '%s' finished in %.2fs (exit code %d)"), *Command, FPlatformTime::Seconds() - Start, ExitCode);
+
+    for (const FMWCS_Issue &Issue : Report.Issues)
+    {
+        const FString Ctx = Issue.Context.IsEmpty() ? TEXT("<no context>") : Issue.Context;
+        const FString IssueLine = FString::Printf(TEXT("ISSUE %s %s | %s | %s"), *MWCS_SeverityLabel(Issue.Severity), *Issue.Code, *Ctx, *Issue.Message).Replace(TEXT("\n"), TEXT(" "));
+        if (!MWCS_SendUtf8(Client, IssueLine + TEXT("\n")))
+        {
+            return true;
+        }
+    }
+
+    const FString Json = MWCS_ReportJson::ToJsonString(Report);
+    MWCS_SendUtf8(Client, FString::Printf(TEXT("REPORT %d\n"), Json.Len()));
+    MWCS_SendUtf8(Client, Json);
+    MWCS_SendUtf8(Client, FString::Printf(TEXT("\nEXIT %d\n"), ExitCode));
+    return true;
+}
+
+int32 UMWCS_ServerCommandlet::Main(const FString &Params)
+{
+    int32 Port = 47110;
+    FParse::Value(*Params, TEXT("-Port="), Port);
+
+    // Loopback only: the server executes builds on request and must not be reachable from the network.
+    const FIPv4Endpoint Endpoint(FIPv4Address(127, 0, 0, 1), static_cast<uint16>(Port));
+    FSocket *Listener = FTcpSocketBuilder(TEXT("MWCS_Server")).AsReusable().BoundToEndpoint(Endpoint).Listening(8);
+    if (!Listener)
+    {
+        UE_LOG(LogTemp, Error, TEXT("MWCS Server: failed to listen on %s"), *Endpoint.ToString());
+        return 1;
+    }
+
+    ISocketSubsystem *SocketSubsystem = ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM);
+    UE_LOG(LogTemp, Display, TEXT("MWCS Server: listening on %s"), *Endpoint.ToString());
+
+    bool bRunning = true;
+    double LastTick = FPlatformTime::Seconds();
+    while (bRunning && !IsEngineExitRequested())
+    {
+        bool bPending = false;
+        if (Listener->WaitForPendingConnection(bPending, FTimespan::FromMilliseconds(250.0)) && bPending)
+        {
+            if (FSocket *Client = Listener->Accept(TEXT("MWCS_ServerClient")))
+            {
+                bRunning = MWCS_HandleServerClient(Client);
+                Client->Close();
+                SocketSubsystem->DestroySocket(Client);
+
+                // Drop objects loaded for this request so memory stays flat across requests;
+                // modules, the asset registry and class metadata stay warm.
+                CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+            }
+        }
+
+        // Keep the editor alive between requests (asset registry updates, deferred tasks).
+        const double Now = FPlatformTime::Seconds();
+        FTaskGraphInterface::Get().ProcessThreadUntilIdle(ENamedThreads::GameThread);
+        FTSTicker::GetCoreTicker().Tick(static_cast<float>(Now - LastTick));
+        LastTick = Now;
+    }
+
+    Listener->Close();
+    SocketSubsystem->DestroySocket(Listener);
+    UE_LOG(LogTemp, Display, TEXT("MWCS Server: shut down"));
     return 0;
 }
@@ -0,0 +1,227 @@
+#include "MWCS_Discovery.h"
+
+#include "MWCS_Settings.h"
+
+#include "MWCS_Utilities.h"
+using namespace MWCS_Utilities;
+
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/CommandLine.h"
+#include "Misc/PackageName.h"
+#include "Misc/Parse.h"
+
+// Discovery state lives for the whole process so a long-running MWCS_Server only pays for new paths.
+static bool GMWCS_RootsScanned = false;
+static TSet<FString> GMWCS_ScannedPaths;
+static TSet<FName> GMWCS_ScannedPackages;
+
+static IAssetRegistry &MWCS_GetAssetRegistry()
+{
+    return FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry")).Get();
+}
+
+// Object or class path -> long package name, skipping native (/Script) and malformed entries.
+static bool MWCS_ToContentPackageName(const FString &Path, FName &OutPackageName)
+{
+    FString Trimmed = Path.TrimStartAndEnd().TrimQuotes();
+    if (Trimmed.IsEmpty() || Trimmed.StartsWith(TEXT("/Script/")))
+    {
+        return false;
+    }
+
+    const FString PackageName = FPackageName::ObjectPathToPackageName(Trimmed);
+    if (!FPackageName::IsValidLongPackageName(PackageName))
+    {
+        return false;
+    }
+    OutPackageName = FName(*PackageName);
+    return true;
+}
+
+static void MWCS_CollectNodePackages(const FMWCS_HierarchyNode &Node, TSet<FName> &OutPackages)
+{
+    FName PackageName;
+    if (!Node.WidgetClassPath.IsEmpty() && MWCS_ToContentPackageName(Node.WidgetClassPath, PackageName))
+    {
+        OutPackages.Add(PackageName);
+    }
+    for (const FMWCS_HierarchyNode &Child : Node.Children)
+    {
+        MWCS_CollectNodePackages(Child, OutPackages);
+    }
+}
+
+static void MWCS_ScanPathsNow(const TArray<FString> &Paths, FMWCS_DiscoveryStats &InOutStats)
+{
+    TArray<FString> NewPaths;
+    for (const FString &Path : Paths)
+    {
+        if (!Path.IsEmpty() && !GMWCS_ScannedPaths.Contains(Path))
+        {
+            GMWCS_ScannedPaths.Add(Path);
+            NewPaths.Add(Path);
+        }
+    }
+    if (NewPaths.Num() == 0)
+    {
+        return;
+    }
+
+    const double Start = FPlatformTime::Seconds();
+    MWCS_GetAssetRegistry().ScanPathsSynchronous(NewPaths, /*bForceRescan*/ false);
+    InOutStats.Seconds += FPlatformTime::Seconds() - Start;
+    InOutStats.PathsScanned += NewPaths.Num();
+}
+
+bool FMWCS_Discovery::UseScopedDiscovery()
+{
+    if (!IsRunningCommandlet())
+    {
+        return false;
+    }
+    if (FParse::Param(FCommandLine::Get(), TEXT("FullDiscovery")))
+    {
+        return false;
+    }
+    const UMWCS_Settings *Settings = UMWCS_Settings::Get();
+    return !Settings || Settings->bScopedDiscoveryInCommandlets;
+}
+
+void FMWCS_Discovery::ScanRoots(FMWCS_DiscoveryStats &InOutStats)
+{
+    if (!IsRunningCommandlet() || GMWCS_RootsScanned)
+    {
+        return;
+    }
+    GMWCS_RootsScanned = true;
+
+    if (!UseScopedDiscovery())
+    {
+        const double Start = FPlatformTime::Seconds();
+        MWCS_GetAssetRegistry().SearchAllAssets(/*bSynchronousSearch*/ true);
+        InOutStats.Seconds += FPlatformTime::Seconds() - Start;
+        InOutStats.bFullScan = true;
+        return;
+    }
+
+    TArray<FString> Roots;
+    if (const UMWCS_Settings *Settings = UMWCS_Settings::Get())
+    {
+        FString Normalized;
+        if (EnsureValidPackagePath(Settings->OutputRootPath, Normalized))
+        {
+            Roots.AddUnique(Normalized);
+        }
+        if (EnsureValidPackagePath(Settings->ToolEuwOutputPath, Normalized))
+        {
+            Roots.AddUnique(Normalized);
+        }
+        for (const FMWCS_ExternalToolEuwConfig &Config : Settings->ExternalToolEuws)
+        {
+            if (EnsureValidPackagePath(Config.OutputPath, Normalized))
+            {
+                Roots.AddUnique(Normalized);
+            }
+        }
+    }
+    MWCS_ScanPathsNow(Roots, InOutStats);
+}
+
+void FMWCS_Discovery::ScanSpec(const FMWCS_WidgetSpec &Spec, FMWCS_DiscoveryStats &InOutStats)
+{
+    if (!UseScopedDiscovery())
+    {
+        return;
+    }
+
+    TSet<FName> Packages;
+    FName PackageName;
+    for (const FString &Dependency : Spec.Dependencies)
+    {
+        if (MWCS_ToContentPackageName(Dependency, PackageName))
+        {
+            Packages.Add(PackageName);
+        }
+    }
+    if (MWCS_ToContentPackageName(Spec.ParentClassPath, PackageName))
+    {
+        Packages.Add(PackageName);
+    }
+    MWCS_CollectNodePackages(Spec.HierarchyRoot, Packages);
+
+    TArray<FString> Files;
+    for (const FName Package : Packages)
+    {
+        if (GMWCS_ScannedPackages.Contains(Package))
+        {
+            continue;
+        }
+        GMWCS_ScannedPackages.Add(Package);
+
+        // Missing packages are not an error here; the builder/validator report unresolved references.
+        FString Filename;
+        if (FPackageName::DoesPackageExist(Package.ToString(), &Filename))
+        {
+            Files.Add(MoveTemp(Filename));
+        }
+    }
+    if (Files.Num() == 0)
+    {
+        return;
+    }
+
+    const double Start = FPlatformTime::Seconds();
+    MWCS_GetAssetRegistry().ScanFilesSynchronous(Files, /*bForceRescan*/ false);
+    InOutStats.Seconds += FPlatformTime::Seconds() - Start;
+    InOutStats.PackagesScanned += Files.Num();
+}
+
+void FMWCS_Discovery::ScanPath(const FString &LongPackagePath, FMWCS_DiscoveryStats &InOutStats)
+{
+    if (!UseScopedDiscovery())
+    {
+        return;
+    }
+
+    // Accept either a folder or a single package; scanning the containing folder covers both.
+    FString Path = LongPackagePath;
+    if (FPackageName::DoesPackageExist(Path))
+    {
+        Path = FPackageName::GetLongPackagePath(Path);
+    }
+    MWCS_ScanPathsNow({Path}, InOutStats);
+}
+
+void FMWCS_Discovery::PrepareForSpecs(const TArray<FMWCS_WidgetSpec> &Specs, FMWCS_Report &Report)
+{
+    FMWCS_DiscoveryStats Stats;
+    ScanRoots(Stats);
+    for (const FMWCS_WidgetSpec &Spec : Specs)
+    {
+        ScanSpec(Spec, Stats);
+    }
+    AddReportEntry(Stats, Report);
+}
+
+void FMWCS_Discovery::AddReportEntry(const FMWCS_DiscoveryStats &Stats, FMWCS_Report &Report)
+{
+    if (!Stats.DidWork())
+    {
+        return;
+    }
+
+    if (Stats.bFullScan)
+    {
+        UE_LOG(LogTemp, Display, TEXT("MWCS: full asset registry scan took %.2fs"), Stats.Seconds);
+        AddIssue(Report, EMWCS_IssueSeverity::Info, TEXT("Discovery.Full"),
+                 FString::Printf(TEXT("Full asset registry scan took %.2fs (-FullDiscovery or scoped discovery disabled)."), Stats.Seconds),
+                 TEXT("AssetRegistry"));
+        return;
+    }
+
+    UE_LOG(LogTemp, Display, TEXT("MWCS: scoped discovery scanned %d path(s) and %d package(s) in %.2fs"), Stats.PathsScanned, Stats.PackagesScanned, Stats.Seconds);
+    AddIssue(Report, EMWCS_IssueSeverity::Info, TEXT("Discovery.Scoped"),
+             FString::Printf(TEXT("Scanned %d path(s) and %d dependency package(s) in %.2fs."), Stats.PathsScanned, Stats.PackagesScanned, Stats.Seconds),
+             TEXT("AssetRegistry"));
+}
@@ -0,0 +1,282 @@
+#include "MWCS_FileSpecProvider.h"
+
+#include "MWCS_CoreCanonical.h"
+#include "MWCS_CoreSpec.h"
+#include "MWCS_Settings.h"
+#include "MWCS_SpecParser.h"
+
+#include "MWCS_Utilities.h"
+using namespace MWCS_Utilities;
+
+#include "Dom/JsonObject.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+
+namespace
+{
+    struct FMWCS_SpecFileEntry
+    {
+        FDateTime Timestamp;
+        int64 Size = -1;
+        TArray<FString> SpecJsons;
+        TArray<TSharedPtr<const MWCS_Core::FJsonNode>> SpecRoots; // parallel to SpecJsons
+        TArray<FMWCS_Issue> Issues; // split/read problems, replayed while the file is unchanged
+    };
+
+    // Per-process cache keyed by normalized absolute path.
+    TMap<FString, FMWCS_SpecFileEntry> GMWCS_SpecFileCache;
+
+    // Timestamps from the previous run (loaded once from SpecFileIndex.json). Only feeds the "changed since the last
+    // run" count in SpecFiles.Scanned: a fresh process still reads every file, since reloading persisted split specs
+    // would cost as much as reading the spec files themselves.
+    TMap<FString, FDateTime> GMWCS_PreviousTimestamps;
+    bool GMWCS_PreviousLoaded = false;
+} // namespace
+
+static FString MWCS_SpecFileIndexPath()
+{
+    return FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("MWCS"), TEXT("SpecFileIndex.json"));
+}
+
+static void MWCS_LoadPreviousIndex()
+{
+    if (GMWCS_PreviousLoaded)
+    {
+        return;
+    }
+    GMWCS_PreviousLoaded = true;
+
+    FString Json;
+    if (!FFileHelper::LoadFileToString(Json, *MWCS_SpecFileIndexPath()))
+    {
+        return;
+    }
+    TSharedPtr<FJsonObject> Root;
+    TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Json);
+    const TArray<TSharedPtr<FJsonValue>> *Files = nullptr;
+    if (!FJsonSerializer::Deserialize(Reader, Root) || !Root.IsValid() || !Root->TryGetArrayField(TEXT("Files"), Files))
+    {
+        return;
+    }
+    for (const TSharedPtr<FJsonValue> &Value : *Files)
+    {
+        const TSharedPtr<FJsonObject> Obj = Value.IsValid() ? Value->AsObject() : nullptr;
+        FString Path;
+        FString Timestamp;
+        FDateTime Parsed;
+        if (Obj.IsValid() && Obj->TryGetStringField(TEXT("Path"), Path) && Obj->TryGetStringField(TEXT("Timestamp"), Timestamp) && FDateTime::ParseIso8601(*Timestamp, Parsed))
+        {
+            GMWCS_PreviousTimestamps.Add(Path, Parsed);
+        }
+    }
+}
+
+static void MWCS_SavePreviousIndex()
+{
+    TArray<FString> Paths;
+    GMWCS_SpecFileCache.GetKeys(Paths);
+    Paths.Sort();
+
+    TArray<TSharedPtr<FJsonValue>> Files;
+    for (const FString &Path : Paths)
+    {
+        const FMWCS_SpecFileEntry &Entry = GMWCS_SpecFileCache[Path];
+        TSharedRef<FJsonObject> Obj = MakeShared<FJsonObject>();
+        Obj->SetStringField(TEXT("Path"), Path);
+        Obj->SetStringField(TEXT("Timestamp"), Entry.Timestamp.ToIso8601());
+        Obj->SetNumberField(TEXT("Size"), static_cast<double>(Entry.Size));
+        Obj->SetNumberField(TEXT("Specs"), Entry.SpecJsons.Num());
+        Files.Add(MakeShared<FJsonValueObject>(Obj));
+    }
+
+    TSharedRef<FJsonObject> Root = MakeShared<FJsonObject>();
+    Root->SetNumberField(TEXT("Version"), 1);
+    Root->SetArrayField(TEXT("Files"), Files);
+
+    FString Json;
+    TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&Json);
+    FJsonSerializer::Serialize(Root, Writer);
+    FFileHelper::SaveStringToFile(Json, *MWCS_SpecFileIndexPath());
+}
+
+// Splits one file into per-spec documents with the core reader, which also enforces the Spec.Limit.* caps. Each
+// spec keeps its parsed DOM for FMWCS_SpecParser::ParseSpecSource, plus minified canonical text for text consumers.
+static void MWCS_ReadSpecFile(const FString &Path, FMWCS_SpecFileEntry &OutEntry)
+{
+    OutEntry.SpecJsons.Reset();
+    OutEntry.SpecRoots.Reset();
+    OutEntry.Issues.Reset();
+
+    auto AddFileIssue = [&OutEntry, &Path](const FString &Code, const FString &Message)
+    {
+        FMWCS_Issue &Issue = OutEntry.Issues.AddDefaulted_GetRef();
+        Issue.Severity = EMWCS_IssueSeverity::Error;
+        Issue.Code = Code;
+        Issue.Message = Message;
+        Issue.Context = Path;
+    };
+
+    FString Text;
+    if (!FFileHelper::LoadFileToString(Text, *Path))
+    {
+        AddFileIssue(TEXT("SpecFile.ReadFailed"), TEXT("Failed to read spec file."));
+        return;
+    }
+
+    const FTCHARToUTF8 Utf8(*Text);
+    std::vector<MWCS_Core::FJsonNode> Specs;
+    std::vector<MWCS_Core::FDiagnostic> Diagnostics;
+    MWCS_Core::SplitSpecFile(std::string_view(Utf8.Get(), Utf8.Length()), Specs, Diagnostics, FMWCS_SpecParser::GetCoreParseOptions());
+    for (const MWCS_Core::FDiagnostic &Diagnostic : Diagnostics)
+    {
+        AddFileIssue(UTF8_TO_TCHAR(Diagnostic.Code.c_str()), UTF8_TO_TCHAR(Diagnostic.Message.c_str()));
+    }
+
+    for (MWCS_Core::FJsonNode &Spec : Specs)
+    {
+        OutEntry.SpecJsons.Add(UTF8_TO_TCHAR(MWCS_Core::Canonicalize(Spec, /*bPretty*/ false).c_str()));
+        OutEntry.SpecRoots.Add(MakeShared<MWCS_Core::FJsonNode>(MoveTemp(Spec)));
+    }
+}
+
+FString FMWCS_FileSpecProvider::NormalizePath(const FString &Path)
+{
+    FString Full = FPaths::IsRelative(Path) ? FPaths::ConvertRelativePathToFull(FPaths::ProjectDir(), Path) : FPaths::ConvertRelativePathToFull(Path);
+    FPaths::NormalizeFilename(Full);
+    FPaths::CollapseRelativeDirectories(Full);
+    return Full;
+}
+
+void FMWCS_FileSpecProvider::GetSpecDirectories(TArray<FString> &OutDirectories)
+{
+    OutDirectories.Reset();
+    const UMWCS_Settings *Settings = UMWCS_Settings::Get();
+    if (!Settings)
+    {
+        return;
+    }
+    for (const FDirectoryPath &Dir : Settings->SpecDirectories)
+    {
+        if (Dir.Path.IsEmpty())
+        {
+            continue;
+        }
+        const FString Full = NormalizePath(Dir.Path);
+        if (IFileManager::Get().DirectoryExists(*Full))
+        {
+            OutDirectories.AddUnique(Full);
+        }
+    }
+}
+
+bool FMWCS_FileSpecProvider::IsSpecFile(const FString &AbsolutePath)
+{
+    if (!FPaths::GetExtension(AbsolutePath).Equals(TEXT("json"), ESearchCase::IgnoreCase))
+    {
+        return false;
+    }
+    const FString Normalized = NormalizePath(AbsolutePath);
+    TArray<FString> Directories;
+    GetSpecDirectories(Directories);
+    for (const FString &Dir : Directories)
+    {
+        if (FPaths::IsUnderDirectory(Normalized, Dir))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+void FMWCS_FileSpecProvider::CollectSpecSources(TArray<FMWCS_SpecSource> &OutSources, FMWCS_Report &InOutReport, const TSet<FString> *OnlyFiles)
+{
+    TArray<FString> Directories;
+    GetSpecDirectories(Directories);
+    if (Directories.Num() == 0)
+    {
+        return;
+    }
+
+    MWCS_LoadPreviousIndex();
+
+    const double Start = FPlatformTime::Seconds();
+    TArray<FString> Files;
+    for (const FString &Dir : Directories)
+    {
+        TArray<FString> Found;
+        IFileManager::Get().FindFilesRecursive(Found, *Dir, TEXT("*.json"), /*Files*/ true, /*Directories*/ false);
+        Files.Append(MoveTemp(Found));
+    }
+    // Deterministic order regardless of file system enumeration.
+    for (FString &File : Files)
+    {
+        File = NormalizePath(File);
+    }
+    Files.Sort();
+
+    int32 NumRead = 0;
+    int32 NumChangedSinceLastRun = 0;
+    TSet<FString> Seen;
+    for (const FString &File : Files)
+    {
+        Seen.Add(File);
+        if (OnlyFiles && !OnlyFiles->Contains(File))
+        {
+            continue;
+        }
+
+        const FFileStatData Stat = IFileManager::Get().GetStatData(*File);
+        FMWCS_SpecFileEntry &Entry = GMWCS_SpecFileCache.FindOrAdd(File);
+        if (Entry.Timestamp != Stat.ModificationTime || Entry.Size != Stat.FileSize)
+        {
+            Entry.Timestamp = Stat.ModificationTime;
+            Entry.Size = Stat.FileSize;
+            MWCS_ReadSpecFile(File, Entry);
+            ++NumRead;
+        }
+
+        const FDateTime *Previous = GMWCS_PreviousTimestamps.Find(File);
+        if (!Previous || *Previous != Entry.Timestamp)
+        {
+            ++NumChangedSinceLastRun;
+        }
+
+        InOutReport.Issues.Append(Entry.Issues);
+        for (int32 Index = 0; Index < Entry.SpecJsons.Num(); ++Index)
+        {
+            FMWCS_SpecSource &Source = OutSources.AddDefaulted_GetRef();
+            Source.Json = Entry.SpecJsons[Index];
+            Source.Root = Entry.SpecRoots[Index];
+            Source.Context = File;
+        }
+    }
+
+    // Forget deleted files so they drop out of the persisted index too.
+    for (auto It = GMWCS_SpecFileCache.CreateIterator(); It; ++It)
+    {
+        if (!Seen.Contains(It.Key()))
+        {
+            It.RemoveCurrent();
+        }
+    }
+
+    if (!OnlyFiles)
+    {
+        MWCS_SavePreviousIndex();
+        GMWCS_PreviousTimestamps.Reset();
+        for (const TPair<FString, FMWCS_SpecFileEntry> &Pair : GMWCS_SpecFileCache)
+        {
+            GMWCS_PreviousTimestamps.Add(Pair.Key, Pair.Value.Timestamp);
+        }
+    }
+
+    AddIssue(InOutReport, EMWCS_IssueSeverity::Info, TEXT("SpecFiles.Scanned"),
+             FString::Printf(TEXT("%d spec file(s): %d re-read, %d changed since the last run (%.2fs)."),
+                             Files.Num(), NumRead, NumChangedSinceLastRun, FPlatformTime::Seconds() - Start),
+             TEXT("SpecDirectories"));
+}
@@ -0,0 +1,285 @@
+#include "MWCS_HotReload.h"
+
+#include "MWCS_AssetIndex.h"
+#include "MWCS_FileSpecProvider.h"
+#include "MWCS_Service.h"
+#include "MWCS_Settings.h"
+#include "MWCS_SpecGraph.h"
+#include "MWCS_SpecParser.h"
+#include "MWCS_WidgetBuilder.h"
+#include "MWCS_WidgetRegistry.h"
+
+#include "MWCS_Utilities.h"
+using namespace MWCS_Utilities;
+
+#include "Algo/AnyOf.h"
+#include "DirectoryWatcherModule.h"
+#include "Editor.h"
+#include "Framework/Notifications/NotificationManager.h"
+#include "HAL/PlatformTime.h"
+#include "IDirectoryWatcher.h"
+#include "Subsystems/AssetEditorSubsystem.h"
+#include "WidgetBlueprint.h"
+#include "WidgetBlueprintEditor.h"
+#include "Widgets/Notifications/SNotificationList.h"
+
+FMWCS_HotReload &FMWCS_HotReload::Get()
+{
+    static FMWCS_HotReload Instance;
+    return Instance;
+}
+
+void FMWCS_HotReload::Start()
+{
+    if (IsRunningCommandlet())
+    {
+        return;
+    }
+
+    if (UMWCS_Settings *Settings = GetMutableDefault<UMWCS_Settings>())
+    {
+        SettingsChangedHandle = Settings->OnSettingChanged().AddLambda([this](UObject *, struct FPropertyChangedEvent &)
+                                                                      { RefreshWatches(); });
+    }
+    RefreshWatches();
+}
+
+void FMWCS_HotReload::Stop()
+{
+    if (SettingsChangedHandle.IsValid())
+    {
+        if (UObjectInitialized())
+        {
+            GetMutableDefault<UMWCS_Settings>()->OnSettingChanged().Remove(SettingsChangedHandle);
+        }
+        SettingsChangedHandle.Reset();
+    }
+
+    if (FDirectoryWatcherModule *Module = FModuleManager::GetModulePtr<FDirectoryWatcherModule>(TEXT("DirectoryWatcher")))
+    {
+        if (IDirectoryWatcher *Watcher = Module->Get())
+        {
+            for (const TPair<FString, FDelegateHandle> &Pair : WatchHandles)
+            {
+                Watcher->UnregisterDirectoryChangedCallback_Handle(Pair.Key, Pair.Value);
+            }
+        }
+    }
+    WatchHandles.Reset();
+    PendingFiles.Reset();
+
+    if (TickerHandle.IsValid())
+    {
+        FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+        TickerHandle.Reset();
+    }
+}
+
+void FMWCS_HotReload::RefreshWatches()
+{
+    IDirectoryWatcher *Watcher = FModuleManager::LoadModuleChecked<FDirectoryWatcherModule>(TEXT("DirectoryWatcher")).Get();
+    if (!Watcher)
+    {
+        return;
+    }
+
+    for (const TPair<FString, FDelegateHandle> &Pair : WatchHandles)
+    {
+        Watcher->UnregisterDirectoryChangedCallback_Handle(Pair.Key, Pair.Value);
+    }
+    WatchHandles.Reset();
+
+    const UMWCS_Settings *Settings = UMWCS_Settings::Get();
+    if (!Settings || !Settings->bHotReloadSpecFiles)
+    {
+        return;
+    }
+
+    TArray<FString> Directories;
+    FMWCS_FileSpecProvider::GetSpecDirectories(Directories);
+    for (const FString &Dir : Directories)
+    {
+        FDelegateHandle Handle;
+        Watcher->RegisterDirectoryChangedCallback_Handle(Dir, IDirectoryWatcher::FDirectoryChanged::CreateRaw(this, &FMWCS_HotReload::HandleDirectoryChanged), Handle);
+        WatchHandles.Add(Dir, Handle);
+    }
+}
+
+void FMWCS_HotReload::HandleDirectoryChanged(const TArray<FFileChangeData> &Changes)
+{
+    bool bAny = false;
+    for (const FFileChangeData &Change : Changes)
+    {
+        if (Change.Action == FFileChangeData::FCA_Removed)
+        {
+            continue;
+        }
+        if (FMWCS_FileSpecProvider::IsSpecFile(Change.Filename))
+        {
+            PendingFiles.Add(FMWCS_FileSpecProvider::NormalizePath(Change.Filename));
+            bAny = true;
+        }
+    }
+    if (!bAny)
+    {
+        return;
+    }
+
+    // Every save restarts the quiet period, so editors that write a file in several steps trigger one rebuild.
+    LastChangeTime = FPlatformTime::Seconds();
+    if (!TickerHandle.IsValid())
+    {
+        TickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FMWCS_HotReload::Tick), 0.05f);
+    }
+}
+
+bool FMWCS_HotReload::Tick(float DeltaTime)
+{
+    const UMWCS_Settings *Settings = UMWCS_Settings::Get();
+    const double Debounce = Settings ? Settings->HotReloadDebounceSeconds : 0.25;
+    if (FPlatformTime::Seconds() - LastChangeTime < Debounce)
+    {
+        return true;
+    }
+    // Do not interleave with a time-sliced Validate/Build from the tool UI; retry once it is done.
+    if (FMWCS_Service::Get().GetActiveRun().IsValid())
+    {
+        return true;
+    }
+
+    TickerHandle.Reset();
+    ProcessPending();
+    return false;
+}
+
+static void MWCS_RefreshOpenDesigner(UWidgetBlueprint *Blueprint)
+{
+    if (!GEditor || !Blueprint)
+    {
+        return;
+    }
+    IAssetEditorInstance *Editor = GEditor->GetEditorSubsystem<UAssetEditorSubsystem>()->FindEditorForAsset(Blueprint, /*bFocusIfOpen*/ false);
+    if (Editor && Editor->GetEditorName() == TEXT("WidgetBlueprintEditor"))
+    {
+        static_cast<FWidgetBlueprintEditor *>(Editor)->RefreshPreview();
+    }
+}
+
+void FMWCS_HotReload::ProcessPending()
+{
+    const double Start = FPlatformTime::Seconds();
+    const TSet<FString> Files = MoveTemp(PendingFiles);
+    PendingFiles.Reset();
+
+    FMWCS_Report Report;
+    TArray<FMWCS_SpecSource> ChangedSources;
+    FMWCS_FileSpecProvider::CollectSpecSources(ChangedSources, Report, &Files);
+
+    // Specs from the saved files whose content differs from what was last built.
+    TArray<FMWCS_WidgetSpec> Specs;
+    TSet<int32> Changed;
+    FString PackagePath;
+    const UMWCS_Settings *Settings = UMWCS_Settings::Get();
+    const bool bHasRoot = Settings && EnsureValidPackagePath(Settings->OutputRootPath, PackagePath);
+    for (const FMWCS_SpecSource &Source : ChangedSources)
+    {
+        FMWCS_WidgetSpec Spec;
+        if (!FMWCS_SpecParser::ParseSpecSource(Source, Spec, Report))
+        {
+            continue;
+        }
+        const FMWCS_AssetIndexEntry *Indexed = bHasRoot ? FMWCS_AssetIndex::Get().Find(PackagePath / Spec.BlueprintName.ToString()) : nullptr;
+        if (Indexed && Indexed->SpecHash == Spec.SpecHash)
+        {
+            continue;
+        }
+        Changed.Add(Specs.Add(MoveTemp(Spec)));
+    }
+
+    if (Changed.Num() > 0)
+    {
+        // Pull in only specs that can nest a changed widget: their JSON must mention its name. The graph
+        // below then keeps the real dependents. Repeat until no new candidates, for nesting chains.
+        TArray<FMWCS_SpecSource> AllSources;
+        FMWCS_Report CollectReport;
+        FMWCS_WidgetRegistry::CollectSpecSources(AllSources, CollectReport);
+
+        TSet<FName> Known;
+        for (const FMWCS_WidgetSpec &Spec : Specs)
+        {
+            Known.Add(Spec.BlueprintName);
+        }
+        TArray<bool> Taken;
+        Taken.SetNumZeroed(AllSources.Num());
+        for (bool bAdded = true; bAdded;)
+        {
+            bAdded = false;
+            for (int32 Index = 0; Index < AllSources.Num(); ++Index)
+            {
+                // Sources from the saved files are candidates too: an unchanged spec can nest a changed one from the
+                // same file. Specs already selected are filtered by name (Known) below.
+                if (Taken[Index])
+                {
+                    continue;
+                }
+                const FString &Json = AllSources[Index].Json;
+                const bool bMentions = Algo::AnyOf(Known, [&Json](const FName Name)
+                                                   { return Json.Contains(Name.ToString()); });
+                if (!bMentions)
+                {
+                    continue;
+                }
+                Taken[Index] = true;
+                FMWCS_WidgetSpec Spec;
+                if (FMWCS_SpecParser::ParseSpecSource(AllSources[Index], Spec, CollectReport) && !Known.Contains(Spec.BlueprintName))
+                {
+                    Known.Add(Spec.BlueprintName);
+                    Specs.Add(MoveTemp(Spec));
+                    bAdded = true;
+                }
+            }
+        }
+
+        FMWCS_SpecGraph Graph;
+        Graph.Build(Specs, PackagePath);
+        TSet<int32> Selected = Changed;
+        Graph.ExpandDependents(Selected);
+        TArray<int32> Order = Selected.Array();
+        Order.Sort();
+        Graph.SortDependenciesFirst(Order);
+
+        for (const int32 Index : Order)
+        {
+            UWidgetBlueprint *Blueprint = nullptr;
+            if (FMWCS_WidgetBuilder::CreateOrUpdateFromSpec(Specs[Index], EMWCS_BuildMode::Repair, FMWCS_BuildOptions(), Report, &Blueprint))
+            {
+                MWCS_RefreshOpenDesigner(Blueprint);
+            }
+        }
+        Report.SpecsProcessed = Order.Num();
+        FMWCS_AssetIndex::Get().SaveIfDirty();
+    }
+
+    const double Seconds = FPlatformTime::Seconds() - Start;
+    UE_LOG(LogTemp, Display, TEXT("MWCS: hot reload of %d file(s) rebuilt %d widget(s) (%d changed) in %.2fs"), Files.Num(), Report.SpecsProcessed, Changed.Num(), Seconds);
+    for (const FMWCS_Issue &Issue : Report.Issues)
+    {
+        if (Issue.Severity == EMWCS_IssueSeverity::Error)
+        {
+            UE_LOG(LogTemp, Error, TEXT("MWCS[%s] %s | %s"), *Issue.Code, *Issue.Context, *Issue.Message);
+        }
+        else if (Issue.Severity == EMWCS_IssueSeverity::Warning)
+        {
+            UE_LOG(LogTemp, Warning, TEXT("MWCS[%s] %s | %s"), *Issue.Code, *Issue.Context, *Issue.Message);
+        }
+    }
+
+    if (Changed.Num() > 0 || Report.HasErrors())
+    {
+        FNotificationInfo Info(FText::FromString(FString::Printf(TEXT("MWCS hot reload: %d widget(s) rebuilt, %d error(s) (%.2fs)"),
+                                                                 Report.SpecsProcessed, Report.NumErrors(), Seconds)));
+        Info.ExpireDuration = 3.0f;
+        FSlateNotificationManager::Get().AddNotification(Info);
+        FMWCS_Service::Get().SaveReportJson(Report, TEXT("HotReload"));
+    }
+}
@@ -0,0 +1,321 @@
+#include "MWCS_LayoutSnapshot.h"
+
+#include "MWCS_CanonicalJson.h"
+#include "MWCS_Discovery.h"
+#include "MWCS_RuntimeBench.h"
+#include "MWCS_Settings.h"
+#include "MWCS_WidgetRegistry.h"
+
+#include "Blueprint/UserWidget.h"
+#include "Blueprint/WidgetTree.h"
+#include "Dom/JsonObject.h"
+#include "Editor.h"
+#include "Layout/ArrangedChildren.h"
+#include "Misc/FileHelper.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "UObject/StrongObjectPtr.h"
+#include "WidgetBlueprint.h"
+
+#include "MWCS_Utilities.h"
+
+using namespace MWCS_Utilities;
+
+static const TCHAR *GMWCS_LayoutSnapshotFormat = TEXT("MWCS.LayoutSnapshot");
+
+static double MWCS_RoundLayout(double Value)
+{
+    return FMath::RoundToDouble(Value * 100.0) / 100.0;
+}
+
+static FString MWCS_FormatNumbers(std::initializer_list<double> Values)
+{
+    FString Out;
+    for (const double Value : Values)
+    {
+        Out += (Out.IsEmpty() ? TEXT("") : TEXT(",")) + FMWCS_CanonicalJsonWriter::FormatNumber(MWCS_RoundLayout(Value));
+    }
+    return Out;
+}
+
+static bool MWCS_ParseNumbers(const FString &Text, int32 Count, TArray<double> &OutValues)
+{
+    TArray<FString> Parts;
+    Text.ParseIntoArray(Parts, TEXT(","), /*InCullEmpty*/ false);
+    OutValues.Reset();
+    for (const FString &Part : Parts)
+    {
+        if (!Part.TrimStartAndEnd().IsNumeric())
+        {
+            return false;
+        }
+        OutValues.Add(FCString::Atod(*Part));
+    }
+    return OutValues.Num() == Count;
+}
+
+static void MWCS_CollectNodeNames(const FMWCS_HierarchyNode &Node, TArray<FName> &OutNames)
+{
+    if (!Node.Name.IsNone())
+    {
+        OutNames.Add(Node.Name);
+    }
+    for (const FMWCS_HierarchyNode &Child : Node.Children)
+    {
+        MWCS_CollectNodeNames(Child, OutNames);
+    }
+}
+
+// Walks the arranged tree from the root geometry and records every widget in Named.
+static void MWCS_ArrangeAndRecord(const TSharedRef<SWidget> &Widget, const FGeometry &Geometry, const TMap<const SWidget *, FString> &Named,
+                                  FMWCS_SpecLayout &OutLayout)
+{
+    if (const FString *Name = Named.Find(&Widget.Get()))
+    {
+        FMWCS_WidgetLayout &Layout = OutLayout.Widgets.Add(*Name);
+        Layout.Position = FVector2D(Geometry.GetAbsolutePosition());
+        Layout.Size = FVector2D(Geometry.GetAbsoluteSize());
+    }
+
+    FArrangedChildren ArrangedChildren(EVisibility::All);
+    Widget->ArrangeChildren(Geometry, ArrangedChildren);
+    for (int32 Index = 0; Index < ArrangedChildren.Num(); ++Index)
+    {
+        const FArrangedWidget &Child = ArrangedChildren[Index];
+        MWCS_ArrangeAndRecord(Child.Widget, Child.Geometry, Named, OutLayout);
+    }
+}
+
+FVector2D FMWCS_LayoutSnapshot::GetViewportSize(const FMWCS_DesignerPreview &Preview, const FVector2D &DesiredSize, const FMWCS_LayoutSnapshotOptions &Options)
+{
+    switch (Preview.SizeMode)
+    {
+    case EMWCS_PreviewSizeMode::Custom:
+        return Preview.CustomSize.X > 0.0 && Preview.CustomSize.Y > 0.0 ? Preview.CustomSize : Options.FillScreenSize;
+    case EMWCS_PreviewSizeMode::Desired:
+    case EMWCS_PreviewSizeMode::DesiredOnScreen:
+        return DesiredSize;
+    default:
+        return Options.FillScreenSize;
+    }
+}
+
+bool FMWCS_LayoutSnapshot::CaptureBlueprint(const FMWCS_WidgetSpec &Spec, UWidgetBlueprint *Blueprint, const FMWCS_LayoutSnapshotOptions &Options,
+                                            FMWCS_SpecLayout &OutLayout, FMWCS_Report &InOutReport)
+{
+    OutLayout = FMWCS_SpecLayout();
+    const FString Context = Blueprint ? Blueprint->GetOutermost()->GetName() : Spec.BlueprintName.ToString();
+
+    UWorld *World = GEditor ? GEditor->GetEditorWorldContext().World() : nullptr;
+    UClass *WidgetClass = Blueprint ? Blueprint->GeneratedClass.Get() : nullptr;
+    const TStrongObjectPtr<UUserWidget> Widget(World && WidgetClass && WidgetClass->IsChildOf(UUserWidget::StaticClass()) ? CreateWidget<UUserWidget>(World, WidgetClass) : nullptr);
+    if (!Widget.IsValid() || !Widget->WidgetTree)
+    {
+        AddIssue(InOutReport, EMWCS_IssueSeverity::Error, TEXT("Layout.CaptureFailed"), TEXT("Could not instantiate the generated widget class."), Context);
+        return false;
+    }
+
+    const TSharedRef<SWidget> SlateRoot = Widget->TakeWidget();
+    SlateRoot->SlatePrepass(1.0f);
+    OutLayout.ViewportSize = GetViewportSize(Spec.DesignerPreview, FVector2D(SlateRoot->GetDesiredSize()), Options);
+
+    TArray<FName> Names;
+    MWCS_CollectNodeNames(Spec.HierarchyRoot, Names);
+    TMap<const SWidget *, FString> Named;
+    for (const FName Name : Names)
+    {
+        const UWidget *Child = Widget->WidgetTree->FindWidget(Name);
+        const TSharedPtr<SWidget> SlateWidget = Child ? Child->GetCachedWidget() : nullptr;
+        if (SlateWidget.IsValid())
+        {
+            Named.Add(SlateWidget.Get(), Name.ToString());
+        }
+    }
+
+    MWCS_ArrangeAndRecord(SlateRoot, FGeometry::MakeRoot(OutLayout.ViewportSize, FSlateLayoutTransform()), Named, OutLayout);
+    return true;
+}
+
+void FMWCS_LayoutSnapshot::CaptureAll(const FMWCS_SpecFilter &Filter, const FMWCS_LayoutSnapshotOptions &Options, FMWCS_LayoutSnapshotData &OutSnapshot,
+                                      FMWCS_Report &InOutReport)
+{
+    OutSnapshot = FMWCS_LayoutSnapshotData();
+    if (!FMWCS_RuntimeBench::EnsureSlate(InOutReport))
+    {
+        return;
+    }
+
+    FString PackagePath;
+    if (!EnsureValidPackagePath(GetDefault<UMWCS_Settings>()->OutputRootPath, PackagePath))
+    {
+        AddIssue(InOutReport, EMWCS_IssueSeverity::Error, TEXT("Layout.InvalidOutputPath"), TEXT("OutputRootPath is invalid."), GetDefault<UMWCS_Settings>()->OutputRootPath);
+        return;
+    }
+
+    TArray<FMWCS_WidgetSpec> Specs;
+    FMWCS_WidgetRegistry::CollectSpecs(Specs, InOutReport);
+    Filter.Apply(Specs, InOutReport);
+    FMWCS_Discovery::PrepareForSpecs(Specs, InOutReport);
+    for (const FMWCS_WidgetSpec &Spec : Specs)
+    {
+        const FString AssetName = Spec.BlueprintName.ToString();
+        FAssetData AssetData;
+        UWidgetBlueprint *Blueprint = FindAssetData(PackagePath, AssetName, AssetData) ? Cast<UWidgetBlueprint>(AssetData.GetAsset()) : nullptr;
+        if (!Blueprint)
+        {
+            AddIssue(InOutReport, EMWCS_IssueSeverity::Error, TEXT("Layout.CaptureFailed"), TEXT("Widget Blueprint asset does not exist."),
+                     FString::Printf(TEXT("%s/%s"), *PackagePath, *AssetName));
+            continue;
+        }
+
+        FMWCS_SpecLayout Layout;
+        if (CaptureBlueprint(Spec, Blueprint, Options, Layout, InOutReport))
+        {
+            OutSnapshot.Specs.Add(AssetName, MoveTemp(Layout));
+        }
+    }
+}
+
+FString FMWCS_LayoutSnapshot::ToJson(const FMWCS_LayoutSnapshotData &Snapshot)
+{
+    FMWCS_CanonicalJsonWriter Writer;
+    Writer.BeginObject();
+    Writer.Write(TEXT("Format"), GMWCS_LayoutSnapshotFormat);
+    Writer.Write(TEXT("Version"), 1);
+    Writer.BeginObject(TEXT("Specs"));
+    for (const TPair<FString, FMWCS_SpecLayout> &Spec : Snapshot.Specs)
+    {
+        Writer.BeginObject(Spec.Key);
+        Writer.Write(TEXT("Viewport"), MWCS_FormatNumbers({Spec.Value.ViewportSize.X, Spec.Value.ViewportSize.Y}));
+        Writer.BeginObject(TEXT("Widgets"));
+        for (const TPair<FString, FMWCS_WidgetLayout> &Widget : Spec.Value.Widgets)
+        {
+            const FMWCS_WidgetLayout &Rect = Widget.Value;
+            Writer.Write(Widget.Key, MWCS_FormatNumbers({Rect.Position.X, Rect.Position.Y, Rect.Size.X, Rect.Size.Y}));
+        }
+        Writer.EndObject();
+        Writer.EndObject();
+    }
+    Writer.EndObject();
+    Writer.EndObject();
+    return Writer.GetOutput();
+}
+
+bool FMWCS_LayoutSnapshot::FromJson(const FString &Json, FMWCS_LayoutSnapshotData &OutSnapshot)
+{
+    OutSnapshot = FMWCS_LayoutSnapshotData();
+
+    TSharedPtr<FJsonObject> Root;
+    const TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Json);
+    FString Format;
+    const TSharedPtr<FJsonObject> *Specs = nullptr;
+    if (!FJsonSerializer::Deserialize(Reader, Root) || !Root.IsValid() || !Root->TryGetStringField(TEXT("Format"), Format) || Format != GMWCS_LayoutSnapshotFormat || !Root->TryGetObjectField(TEXT("Specs"), Specs) || !Specs || !Specs->IsValid())
+    {
+        return false;
+    }
+
+    TArray<double> Numbers;
+    for (const TPair<FString, TSharedPtr<FJsonValue>> &Spec : (*Specs)->Values)
+    {
+        const TSharedPtr<FJsonObject> *SpecObj = nullptr;
+        const TSharedPtr<FJsonObject> *Widgets = nullptr;
+        FString Viewport;
+        if (!Spec.Value.IsValid() || !Spec.Value->TryGetObject(SpecObj) || !SpecObj || !(*SpecObj)->TryGetStringField(TEXT("Viewport"), Viewport) || !MWCS_ParseNumbers(Viewport, 2, Numbers) || !(*SpecObj)->TryGetObjectField(TEXT("Widgets"), Widgets) || !Widgets)
+        {
+            return false;
+        }
+
+        FMWCS_SpecLayout &Layout = OutSnapshot.Specs.Add(Spec.Key);
+        Layout.ViewportSize = FVector2D(Numbers[0], Numbers[1]);
+        for (const TPair<FString, TSharedPtr<FJsonValue>> &Widget : (*Widgets)->Values)
+        {
+            FString Rect;
+            if (!Widget.Value.IsValid() || !Widget.Value->TryGetString(Rect) || !MWCS_ParseNumbers(Rect, 4, Numbers))
+            {
+                return false;
+            }
+            FMWCS_WidgetLayout &WidgetLayout = Layout.Widgets.Add(Widget.Key);
+            WidgetLayout.Position = FVector2D(Numbers[0], Numbers[1]);
+            WidgetLayout.Size = FVector2D(Numbers[2], Numbers[3]);
+        }
+    }
+    return true;
+}
+
+bool FMWCS_LayoutSnapshot::Load(const FString &Path, FMWCS_LayoutSnapshotData &OutSnapshot, FMWCS_Report &InOutReport)
+{
+    FString Json;
+    if (!FFileHelper::LoadFileToString(Json, *Path))
+    {
+        AddIssue(InOutReport, EMWCS_IssueSeverity::Error, TEXT("Layout.SnapshotInvalid"), TEXT("Snapshot file not found or unreadable."), Path);
+        return false;
+    }
+    if (!FromJson(Json, OutSnapshot))
+    {
+        AddIssue(InOutReport, EMWCS_IssueSeverity::Error, TEXT("Layout.SnapshotInvalid"),
+                 FString::Printf(TEXT("Expected a JSON object with \"Format\": \"%s\" and a \"Specs\" object of \"X,Y,W,H\" rectangles."), GMWCS_LayoutSnapshotFormat), Path);
+        return false;
+    }
+    return true;
+}
+
+int32 FMWCS_LayoutSnapshot::Compare(const FMWCS_LayoutSnapshotData &Baseline, const FMWCS_LayoutSnapshotData &Current, const FMWCS_LayoutSnapshotOptions &Options,
+                                    FMWCS_Report &InOutReport)
+{
+    auto Describe = [](const FMWCS_WidgetLayout &Rect)
+    {
+        return FString::Printf(TEXT("(%.2f, %.2f) %.2fx%.2f"), Rect.Position.X, Rect.Position.Y, Rect.Size.X, Rect.Size.Y);
+    };
+
+    int32 NumCompared = 0;
+    int32 NumMoved = 0;
+    for (const TPair<FString, FMWCS_SpecLayout> &Expected : Baseline.Specs)
+    {
+        const FMWCS_SpecLayout *Actual = Current.Specs.Find(Expected.Key);
+        if (!Actual)
+        {
+            AddIssue(InOutReport, EMWCS_IssueSeverity::Warning, TEXT("Layout.SpecMissing"), TEXT("Spec is in the baseline but was not captured."), Expected.Key);
+            continue;
+        }
+        if (!Actual->ViewportSize.Equals(Expected.Value.ViewportSize, Options.Tolerance))
+        {
+            AddIssue(InOutReport, EMWCS_IssueSeverity::Warning, TEXT("Layout.ViewportChanged"),
+                     FString::Printf(TEXT("Viewport %.2fx%.2f, baseline %.2fx%.2f."), Actual->ViewportSize.X, Actual->ViewportSize.Y, Expected.Value.ViewportSize.X, Expected.Value.ViewportSize.Y),
+                     Expected.Key);
+        }
+
+        for (const TPair<FString, FMWCS_WidgetLayout> &Widget : Expected.Value.Widgets)
+        {
+            const FString Context = FString::Printf(TEXT("%s.%s"), *Expected.Key, *Widget.Key);
+            const FMWCS_WidgetLayout *Rect = Actual->Widgets.Find(Widget.Key);
+            if (!Rect)
+            {
+                AddIssue(InOutReport, EMWCS_IssueSeverity::Error, TEXT("Layout.WidgetMissing"), TEXT("Widget is in the baseline but was not laid out."), Context);
+                continue;
+            }
+
+            ++NumCompared;
+            // Edges, not size: a widget that grows to the left moved even if its top-left corner did not.
+            const FVector2D BottomRight = Rect->Position + Rect->Size;
+            const FVector2D ExpectedBottomRight = Widget.Value.Position + Widget.Value.Size;
+            if (!Rect->Position.Equals(Widget.Value.Position, Options.Tolerance) || !BottomRight.Equals(ExpectedBottomRight, Options.Tolerance))
+            {
+                ++NumMoved;
+                AddIssue(InOutReport, EMWCS_IssueSeverity::Error, TEXT("Layout.Moved"),
+                         FString::Printf(TEXT("Now %s, baseline %s (tolerance %.2f)."), *Describe(*Rect), *Describe(Widget.Value), Options.Tolerance), Context);
+            }
+        }
+        for (const TPair<FString, FMWCS_WidgetLayout> &Widget : Actual->Widgets)
+        {
+            if (!Expected.Value.Widgets.Contains(Widget.Key))
+            {
+                AddIssue(InOutReport, EMWCS_IssueSeverity::Warning, TEXT("Layout.WidgetAdded"), TEXT("Widget is not in the baseline; record a new snapshot."),
+                         FString::Printf(TEXT("%s.%s"), *Expected.Key, *Widget.Key));
+            }
+        }
+    }
+
+    AddIssue(InOutReport, EMWCS_IssueSeverity::Info, TEXT("Layout.Summary"),
+             FString::Printf(TEXT("%d widget(s) in %d spec(s) compared, %d moved."), NumCompared, Baseline.Specs.Num(), NumMoved), TEXT("Layout"));
+    return NumMoved;
+}
@@ -0,0 +1,281 @@
+#include "MWCS_LogView.h"
+
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "Editor.h"
+#include "Misc/PackageName.h"
+#include "SourceCodeNavigation.h"
+#include "Subsystems/AssetEditorSubsystem.h"
+#include "Widgets/Input/SButton.h"
+#include "Widgets/Input/SCheckBox.h"
+#include "Widgets/Input/SEditableTextBox.h"
+#include "Widgets/Input/SSearchBox.h"
+#include "Widgets/SBoxPanel.h"
+#include "Widgets/Text/STextBlock.h"
+
+static FSlateColor MWCS_SeverityColor(EMWCS_IssueSeverity Severity)
+{
+    switch (Severity)
+    {
+    case EMWCS_IssueSeverity::Error:
+        return FSlateColor(FLinearColor(0.9f, 0.25f, 0.2f));
+    case EMWCS_IssueSeverity::Warning:
+        return FSlateColor(FLinearColor(0.95f, 0.75f, 0.2f));
+    default:
+        return FSlateColor::UseForeground();
+    }
+}
+
+// Issue contexts are package paths (/Game/UI/WBP_X), object paths, or provider class paths (/Script/Module.Class).
+static bool MWCS_OpenContext(const FString &Context)
+{
+    const FString Path = Context.TrimStartAndEnd();
+    if (!Path.StartsWith(TEXT("/")))
+    {
+        return false;
+    }
+
+    if (Path.StartsWith(TEXT("/Script/")))
+    {
+        if (UClass *Class = FindObject<UClass>(nullptr, *Path))
+        {
+            return FSourceCodeNavigation::NavigateToClass(Class);
+        }
+        return false;
+    }
+
+    const FString PackageName = FPackageName::ObjectPathToPackageName(Path);
+    if (!FPackageName::IsValidLongPackageName(PackageName) || !GEditor)
+    {
+        return false;
+    }
+
+    IAssetRegistry &AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry")).Get();
+    TArray<FAssetData> Assets;
+    AssetRegistry.GetAssetsByPackageName(FName(*PackageName), Assets);
+    if (Assets.Num() == 0)
+    {
+        return false;
+    }
+
+    UObject *Asset = Assets[0].GetAsset();
+    return Asset && GEditor->GetEditorSubsystem<UAssetEditorSubsystem>()->OpenEditorForAsset(Asset);
+}
+
+void SMWCS_LogView::Construct(const FArguments &InArgs)
+{
+    auto MakeSeverityToggle = [this](const TCHAR *Label, bool *bFlag, TFunction<int32()> Count) -> TSharedRef<SWidget>
+    {
+        return SNew(SCheckBox)
+            .IsChecked_Lambda([bFlag]()
+                              { return *bFlag ? ECheckBoxState::Checked : ECheckBoxState::Unchecked; })
+            .OnCheckStateChanged_Lambda([this, bFlag](ECheckBoxState State)
+                                        {
+                                            *bFlag = State == ECheckBoxState::Checked;
+                                            RebuildFiltered(); })
+                [SNew(STextBlock)
+                     .Text_Lambda([Label, Count]()
+                                  { return FText::FromString(FString::Printf(TEXT("%s (%d)"), Label, Count())); })];
+    };
+
+    ChildSlot
+        [SNew(SVerticalBox) +
+         SVerticalBox::Slot()
+             .AutoHeight()
+             .Padding(0, 0, 0, 4)
+                 [SNew(SHorizontalBox) +
+                  SHorizontalBox::Slot().AutoWidth().VAlign(VAlign_Center).Padding(2)[MakeSeverityToggle(TEXT("Errors"), &bShowErrors, [this]()
+                                                                                                         { return NumErrors; })] +
+                  SHorizontalBox::Slot().AutoWidth().VAlign(VAlign_Center).Padding(2)[MakeSeverityToggle(TEXT("Warnings"), &bShowWarnings, [this]()
+                                                                                                         { return NumWarnings; })] +
+                  SHorizontalBox::Slot().AutoWidth().VAlign(VAlign_Center).Padding(2)[MakeSeverityToggle(TEXT("Info"), &bShowInfo, [this]()
+                                                                                                         { return AllEntries.Num() - NumErrors - NumWarnings; })] +
+                  SHorizontalBox::Slot()
+                      .FillWidth(0.35f)
+                      .Padding(2)
+                          [SNew(SEditableTextBox)
+                               .HintText(FText::FromString(TEXT("Code (Builder.* or Validator.*)")))
+                               .OnTextChanged_Lambda([this](const FText &Text)
+                                                     {
+                                                         CodeFilter = Text.ToString().TrimStartAndEnd();
+                                                         RebuildFiltered(); })] +
+                  SHorizontalBox::Slot()
+                      .FillWidth(0.65f)
+                      .Padding(2)
+                          [SNew(SSearchBox)
+                               .OnTextChanged_Lambda([this](const FText &Text)
+                                                     {
+                                                         SearchText = Text.ToString().TrimStartAndEnd();
+                                                         RebuildFiltered(); })] +
+                  SHorizontalBox::Slot().AutoWidth().VAlign(VAlign_Center).Padding(6, 2)[SNew(STextBlock).Text(this, &SMWCS_LogView::GetCountText)] +
+                  SHorizontalBox::Slot()
+                      .AutoWidth()
+                      .Padding(2)
+                          [SNew(SButton)
+                               .Text(FText::FromString(TEXT("Clear")))
+                               .OnClicked_Lambda([this]()
+                                                 {
+                                                     Clear();
+                                                     return FReply::Handled(); })]] +
+         SVerticalBox::Slot()
+             .FillHeight(1.0f)
+                 [SAssignNew(ListView, SListView<FEntryPtr>)
+                      .ListItemsSource(&FilteredEntries)
+                      .SelectionMode(ESelectionMode::Multi)
+                      .OnGenerateRow(this, &SMWCS_LogView::GenerateRow)
+                      .OnMouseButtonDoubleClick(this, &SMWCS_LogView::HandleRowDoubleClicked)]];
+}
+
+void SMWCS_LogView::AddLine(const FString &Line)
+{
+    FEntryPtr Entry = MakeShared<FMWCS_LogEntry>();
+    Entry->Message = Line;
+    AddEntry(Entry);
+    RefreshList(/*bScrollToEnd*/ true);
+}
+
+void SMWCS_LogView::AddReport(const FString &Title, const FMWCS_Report &Report)
+{
+    AddLine(FString::Printf(TEXT("[%s] Specs=%d Created=%d Repaired=%d Recreated=%d Errors=%d Warnings=%d"),
+                            *Title,
+                            Report.SpecsProcessed,
+                            Report.AssetsCreated,
+                            Report.AssetsRepaired,
+                            Report.AssetsRecreated,
+                            Report.NumErrors(),
+                            Report.NumWarnings()));
+
+    AllEntries.Reserve(AllEntries.Num() + Report.Issues.Num());
+    for (const FMWCS_Issue &Issue : Report.Issues)
+    {
+        FEntryPtr Entry = MakeShared<FMWCS_LogEntry>();
+        Entry->Severity = Issue.Severity;
+        Entry->Code = Issue.Code;
+        Entry->Message = Issue.Message;
+        Entry->Context = Issue.Context;
+        AddEntry(Entry);
+    }
+    RefreshList(/*bScrollToEnd*/ true);
+}
+
+void SMWCS_LogView::Clear()
+{
+    AllEntries.Reset();
+    FilteredEntries.Reset();
+    NumErrors = 0;
+    NumWarnings = 0;
+    RefreshList(/*bScrollToEnd*/ false);
+}
+
+void SMWCS_LogView::AddEntry(const FEntryPtr &Entry)
+{
+    if (Entry->Severity == EMWCS_IssueSeverity::Error)
+    {
+        ++NumErrors;
+    }
+    else if (Entry->Severity == EMWCS_IssueSeverity::Warning)
+    {
+        ++NumWarnings;
+    }
+
+    AllEntries.Add(Entry);
+    if (PassesFilter(*Entry))
+    {
+        FilteredEntries.Add(Entry);
+    }
+}
+
+void SMWCS_LogView::RefreshList(bool bScrollToEnd)
+{
+    if (!ListView.IsValid())
+    {
+        return;
+    }
+    // Deferred to the next paint, so a burst of appends costs one refresh.
+    ListView->RequestListRefresh();
+    if (bScrollToEnd && FilteredEntries.Num() > 0)
+    {
+        ListView->RequestScrollIntoView(FilteredEntries.Last());
+    }
+}
+
+void SMWCS_LogView::RebuildFiltered()
+{
+    FilteredEntries.Reset();
+    for (const FEntryPtr &Entry : AllEntries)
+    {
+        if (PassesFilter(*Entry))
+        {
+            FilteredEntries.Add(Entry);
+        }
+    }
+    RefreshList(/*bScrollToEnd*/ false);
+}
+
+bool SMWCS_LogView::PassesFilter(const FMWCS_LogEntry &Entry) const
+{
+    switch (Entry.Severity)
+    {
+    case EMWCS_IssueSeverity::Error:
+        if (!bShowErrors)
+        {
+            return false;
+        }
+        break;
+    case EMWCS_IssueSeverity::Warning:
+        if (!bShowWarnings)
+        {
+            return false;
+        }
+        break;
+    default:
+        if (!bShowInfo)
+        {
+            return false;
+        }
+        break;
+    }
+
+    if (!CodeFilter.IsEmpty())
+    {
+        const bool bWildcard = CodeFilter.Contains(TEXT("*")) || CodeFilter.Contains(TEXT("?"));
+        if (bWildcard ? !Entry.Code.MatchesWildcard(CodeFilter) : !Entry.Code.StartsWith(CodeFilter))
+        {
+            return false;
+        }
+    }
+
+    if (!SearchText.IsEmpty() &&
+        !Entry.Message.Contains(SearchText) &&
+        !Entry.Code.Contains(SearchText) &&
+        !Entry.Context.Contains(SearchText))
+    {
+        return false;
+    }
+    return true;
+}
+
+TSharedRef<ITableRow> SMWCS_LogView::GenerateRow(FEntryPtr Entry, const TSharedRef<STableViewBase> &OwnerTable)
+{
+    const FString Text = Entry->Code.IsEmpty()
+                             ? Entry->Message
+                             : FString::Printf(TEXT("- %s: %s (%s)"), *Entry->Code, *Entry->Message, *Entry->Context);
+
+    return SNew(STableRow<FEntryPtr>, OwnerTable)
+        [SNew(STextBlock)
+             .Text(FText::FromString(Text))
+             .ColorAndOpacity(MWCS_SeverityColor(Entry->Severity))
+             .ToolTipText(Entry->Context.IsEmpty() ? FText::GetEmpty() : FText::FromString(FString::Printf(TEXT("%s\nDouble-click to open"), *Entry->Context)))];
+}
+
+void SMWCS_LogView::HandleRowDoubleClicked(FEntryPtr Entry)
+{
+    if (Entry.IsValid() && !Entry->Context.IsEmpty() && !MWCS_OpenContext(Entry->Context))
+    {
+        UE_LOG(LogTemp, Display, TEXT("MWCS: nothing to open for context '%s'"), *Entry->Context);
+    }
+}
+
+FText SMWCS_LogView::GetCountText() const
+{
+    return FText::FromString(FString::Printf(TEXT("%d / %d"), FilteredEntries.Num(), AllEntries.Num()));
+}
@@ -0,0 +1,59 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Widgets/SCompoundWidget.h"
+#include "Widgets/Views/SListView.h"
+
+#include "MWCS_Report.h"
+
+struct FMWCS_LogEntry
+{
+    EMWCS_IssueSeverity Severity = EMWCS_IssueSeverity::Info;
+    FString Code; // empty for plain status lines
+    FString Message;
+    FString Context;
+};
+
+/**
+ * Output log shared by the MWCS tab and the Tool EUW.
+ * One list row per issue or status line: appends are O(1) and only visible rows are laid out.
+ * Rows can be filtered by severity, code (prefix or wildcard) and free text; double-clicking a row
+ * opens the asset (or provider class source) named in its context.
+ */
+class SMWCS_LogView : public SCompoundWidget
+{
+public:
+    SLATE_BEGIN_ARGS(SMWCS_LogView) {}
+    SLATE_END_ARGS()
+
+    void Construct(const FArguments &InArgs);
+
+    void AddLine(const FString &Line);
+    void AddReport(const FString &Title, const FMWCS_Report &Report);
+    void Clear();
+
+private:
+    using FEntryPtr = TSharedPtr<FMWCS_LogEntry>;
+
+    void AddEntry(const FEntryPtr &Entry);
+    void RefreshList(bool bScrollToEnd);
+    void RebuildFiltered();
+    bool PassesFilter(const FMWCS_LogEntry &Entry) const;
+
+    TSharedRef<ITableRow> GenerateRow(FEntryPtr Entry, const TSharedRef<STableViewBase> &OwnerTable);
+    void HandleRowDoubleClicked(FEntryPtr Entry);
+    FText GetCountText() const;
+
+    TArray<FEntryPtr> AllEntries;
+    TArray<FEntryPtr> FilteredEntries;
+    TSharedPtr<SListView<FEntryPtr>> ListView;
+
+    bool bShowErrors = true;
+    bool bShowWarnings = true;
+    bool bShowInfo = true;
+    FString CodeFilter;
+    FString SearchText;
+
+    int32 NumErrors = 0;
+    int32 NumWarnings = 0;
+};
@@ -0,0 +1,122 @@
+#include "MWCS_PerfLint.h"
+
+#include "MWCS_Settings.h"
+#include "MWCS_WidgetRegistry.h"
+
+#include "MWCS_Utilities.h"
+
+using namespace MWCS_Utilities;
+
+static std::string MWCS_ToUtf8(const FString &Value)
+{
+    const FTCHARToUTF8 Utf8(*Value);
+    return std::string(Utf8.Get(), Utf8.Length());
+}
+
+static void MWCS_ApplyRule(const FMWCS_PerfLintRule &Config, MWCS_Core::FPerfRule &OutRule)
+{
+    OutRule.bEnabled = Config.Severity != EMWCS_LintSeverity::Off;
+    OutRule.Severity = Config.Severity == EMWCS_LintSeverity::Error     ? MWCS_Core::ESeverity::Error
+                       : Config.Severity == EMWCS_LintSeverity::Warning ? MWCS_Core::ESeverity::Warning
+                                                                        : MWCS_Core::ESeverity::Info;
+    OutRule.Budget = FMath::Max(0, Config.Budget);
+}
+
+// Only what the Perf.* rules read: names, types, IsVariable, binding names and Design "Visibility".
+static void MWCS_ToCoreNode(const FMWCS_HierarchyNode &Node, MWCS_Core::FHierarchyNode &OutNode)
+{
+    OutNode.Name = Node.Name.IsNone() ? std::string() : MWCS_ToUtf8(Node.Name.ToString());
+    OutNode.Type = MWCS_ToUtf8(Node.Type.ToString());
+    OutNode.bIsVariable = Node.bIsVariable;
+    OutNode.bHasIsVariable = Node.bHasIsVariable;
+    OutNode.Children.resize(Node.Children.Num());
+    for (int32 Index = 0; Index < Node.Children.Num(); ++Index)
+    {
+        MWCS_ToCoreNode(Node.Children[Index], OutNode.Children[Index]);
+    }
+}
+
+static void MWCS_ToCoreSpec(const FMWCS_WidgetSpec &Spec, MWCS_Core::FWidgetSpec &OutSpec)
+{
+    OutSpec.BlueprintName = MWCS_ToUtf8(Spec.BlueprintName.ToString());
+    MWCS_ToCoreNode(Spec.HierarchyRoot, OutSpec.HierarchyRoot);
+    for (const FName &Name : Spec.Bindings.Required)
+    {
+        OutSpec.Bindings.Required.push_back(MWCS_ToUtf8(Name.ToString()));
+    }
+    for (const FName &Name : Spec.Bindings.Optional)
+    {
+        OutSpec.Bindings.Optional.push_back(MWCS_ToUtf8(Name.ToString()));
+    }
+    for (const TPair<FName, TSharedPtr<FJsonObject>> &Entry : Spec.Design)
+    {
+        FString Visibility;
+        if (Entry.Value.IsValid() && Entry.Value->TryGetStringField(TEXT("Visibility"), Visibility))
+        {
+            MWCS_Core::FDesignEntry &Design = OutSpec.Design.emplace_back();
+            Design.Name = MWCS_ToUtf8(Entry.Key.ToString());
+            Design.Properties.Type = MWCS_Core::EJsonType::Object;
+            MWCS_Core::FJsonNode Value;
+            Value.Type = MWCS_Core::EJsonType::String;
+            Value.String = MWCS_ToUtf8(Visibility);
+            Design.Properties.Set("Visibility", MoveTemp(Value));
+        }
+    }
+}
+
+MWCS_Core::FPerfLintOptions FMWCS_PerfLint::GetOptions()
+{
+    MWCS_Core::FPerfLintOptions Options;
+    if (const UMWCS_Settings *Settings = UMWCS_Settings::Get())
+    {
+        MWCS_ApplyRule(Settings->PerfLintDepth, Options.Depth);
+        MWCS_ApplyRule(Settings->PerfLintWidgetCount, Options.WidgetCount);
+        MWCS_ApplyRule(Settings->PerfLintCanvasChildren, Options.CanvasChildren);
+        MWCS_ApplyRule(Settings->PerfLintVariableCount, Options.VariableCount);
+        MWCS_ApplyRule(Settings->PerfLintHitTestable, Options.HitTestable);
+    }
+    return Options;
+}
+
+bool FMWCS_PerfLint::ApplyOverrides(const FString &Rules, MWCS_Core::FPerfLintOptions &InOutOptions, FMWCS_Report &InOutReport)
+{
+    std::string Error;
+    if (!InOutOptions.ApplyOverrides(MWCS_ToUtf8(Rules), Error))
+    {
+        AddIssue(InOutReport, EMWCS_IssueSeverity::Error, TEXT("Lint.InvalidRules"), UTF8_TO_TCHAR(Error.c_str()), Rules);
+        return false;
+    }
+    return true;
+}
+
+int32 FMWCS_PerfLint::LintSpec(const FMWCS_WidgetSpec &Spec, const MWCS_Core::FPerfLintOptions &Options, FMWCS_Report &InOutReport)
+{
+    MWCS_Core::FWidgetSpec CoreSpec;
+    MWCS_ToCoreSpec(Spec, CoreSpec);
+
+    std::vector<MWCS_Core::FDiagnostic> Diagnostics;
+    MWCS_Core::LintSpecPerformance(CoreSpec, Options, Diagnostics);
+
+    const FString Context = Spec.BlueprintName.ToString();
+    for (const MWCS_Core::FDiagnostic &Diagnostic : Diagnostics)
+    {
+        AddIssue(InOutReport, static_cast<EMWCS_IssueSeverity>(Diagnostic.Severity), UTF8_TO_TCHAR(Diagnostic.Code.c_str()), UTF8_TO_TCHAR(Diagnostic.Message.c_str()), Context);
+    }
+    return static_cast<int32>(Diagnostics.size());
+}
+
+void FMWCS_PerfLint::LintAll(const FMWCS_SpecFilter &Filter, const MWCS_Core::FPerfLintOptions &Options, FMWCS_Report &InOutReport)
+{
+    TArray<FMWCS_WidgetSpec> Specs;
+    FMWCS_WidgetRegistry::CollectSpecs(Specs, InOutReport);
+    Filter.Apply(Specs, InOutReport);
+
+    int32 NumFlagged = 0;
+    for (const FMWCS_WidgetSpec &Spec : Specs)
+    {
+        NumFlagged += LintSpec(Spec, Options, InOutReport) > 0 ? 1 : 0;
+    }
+
+    AddIssue(InOutReport, EMWCS_IssueSeverity::Info, TEXT("Lint.Summary"),
+             FString::Printf(TEXT("%d of %d spec(s) have Perf.* findings."), NumFlagged, Specs.Num()), TEXT("Lint"));
+}
@@ -40,6 +40,15 @@ bool FMWCS_Report::HasWarnings() const
     return NumWarnings() > 0;
 }
 
+void FMWCS_Report::Append(const FMWCS_Report &Other)
+{
+    Issues.Append(Other.Issues);
+    SpecsProcessed += Other.SpecsProcessed;
+    AssetsCreated += Other.AssetsCreated;
+    AssetsRepaired += Other.AssetsRepaired;
+    AssetsRecreated += Other.AssetsRecreated;
+}
+
 static FString SeverityToString(EMWCS_IssueSeverity Severity)
 {
     switch (Severity)
@@ -55,6 +64,19 @@ static FString SeverityToString(EMWCS_IssueSeverity Severity)
     }
 }
 
+static EMWCS_IssueSeverity SeverityFromString(const FString &Severity)
+{
+    if (Severity.Equals(TEXT("Error"), ESearchCase::IgnoreCase))
+    {
+        return EMWCS_IssueSeverity::Error;
+    }
+    if (Severity.Equals(TEXT("Warning"), ESearchCase::IgnoreCase))
+    {
+        return EMWCS_IssueSeverity::Warning;
+    }
+    return EMWCS_IssueSeverity::Info;
+}
+
 FString MWCS_ReportJson::ToJsonString(const FMWCS_Report &Report)
 {
     TSharedRef<FJsonObject> Root = MakeShared<FJsonObject>();
@@ -83,3 +105,42 @@ FString MWCS_ReportJson::ToJsonString(const FMWCS_Report &Report)
     FJsonSerializer::Serialize(Root, Writer);
     return Out;
 }
+
+bool MWCS_ReportJson::FromJsonString(const FString &Json, FMWCS_Report &OutReport)
+{
+    OutReport = FMWCS_Report();
+
+    TSharedPtr<FJsonObject> Root;
+    TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Json);
+    if (!FJsonSerializer::Deserialize(Reader, Root) || !Root.IsValid())
+    {
+        return false;
+    }
+
+    Root->TryGetNumberField(TEXT("SpecsProcessed"), OutReport.SpecsProcessed);
+    Root->TryGetNumberField(TEXT("AssetsCreated"), OutReport.AssetsCreated);
+    Root->TryGetNumberField(TEXT("AssetsRepaired"), OutReport.AssetsRepaired);
+    Root->TryGetNumberField(TEXT("AssetsRecreated"), OutReport.AssetsRecreated);
+
+    const TArray<TSharedPtr<FJsonValue>> *Issues = nullptr;
+    if (Root->TryGetArrayField(TEXT("Issues"), Issues) && Issues)
+    {
+        OutReport.Issues.Reserve(Issues->Num());
+        for (const TSharedPtr<FJsonValue> &Value : *Issues)
+        {
+            const TSharedPtr<FJsonObject> Obj = Value.IsValid() ? Value->AsObject() : nullptr;
+            if (!Obj.IsValid())
+            {
+                continue;
+            }
+
+            FMWCS_Issue &Issue = OutReport.Issues.AddDefaulted_GetRef();
+            Issue.Severity = SeverityFromString(Obj->GetStringField(TEXT("Severity")));
+            Obj->TryGetStringField(TEXT("Code"), Issue.Code);
+            Obj->TryGetStringField(TEXT("Message"), Issue.Message);
+            Obj->TryGetStringField(TEXT("Context"), Issue.Context);
+        }
+    }
+
+    return true;
+}
@@ -0,0 +1,395 @@
+#include "MWCS_RoundTrip.h"
+
+#include "MWCS_SpecOptimizer.h"
+#include "MWCS_SpecParser.h"
+#include "MWCS_WidgetBuilder.h"
+#include "MWCS_WidgetExtractor.h"
+
+#include "Dom/JsonValue.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformTime.h"
+#include "Interfaces/IPluginManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "UObject/UObjectGlobals.h"
+#include "WidgetBlueprint.h"
+
+#include "MWCS_Utilities.h"
+
+using namespace MWCS_Utilities;
+
+static constexpr double GMWCS_RoundTripTolerance = 1.e-4;
+
+static bool MWCS_NearlyEqual(double A, double B)
+{
+    return FMath::IsNearlyEqual(A, B, GMWCS_RoundTripTolerance);
+}
+
+static FString MWCS_MarginToString(const FMargin &M)
+{
+    return FString::Printf(TEXT("(%g, %g, %g, %g)"), M.Left, M.Top, M.Right, M.Bottom);
+}
+
+static FString MWCS_Vector2ToString(const FVector2D &V)
+{
+    return FString::Printf(TEXT("(%g, %g)"), V.X, V.Y);
+}
+
+static bool MWCS_MarginNearlyEqual(const FMargin &A, const FMargin &B)
+{
+    return MWCS_NearlyEqual(A.Left, B.Left) && MWCS_NearlyEqual(A.Top, B.Top) && MWCS_NearlyEqual(A.Right, B.Right) && MWCS_NearlyEqual(A.Bottom, B.Bottom);
+}
+
+static bool MWCS_Vector2NearlyEqual(const FVector2D &A, const FVector2D &B)
+{
+    return MWCS_NearlyEqual(A.X, B.X) && MWCS_NearlyEqual(A.Y, B.Y);
+}
+
+// Expected must be contained in Actual: every object field of Expected exists in Actual with an equal value.
+static void MWCS_CompareJsonValue(const TSharedPtr<FJsonValue> &Expected, const TSharedPtr<FJsonValue> &Actual, const FString &Path, TArray<FString> &OutDifferences)
+{
+    if (!Expected.IsValid())
+    {
+        return;
+    }
+    if (!Actual.IsValid())
+    {
+        OutDifferences.Add(FString::Printf(TEXT("%s: missing after round trip"), *Path));
+        return;
+    }
+
+    switch (Expected->Type)
+    {
+    case EJson::Object:
+    {
+        const TSharedPtr<FJsonObject> ExpectedObj = Expected->AsObject();
+        const TSharedPtr<FJsonObject> *ActualObj = nullptr;
+        if (!Actual->TryGetObject(ActualObj) || !ActualObj || !ActualObj->IsValid())
+        {
+            OutDifferences.Add(FString::Printf(TEXT("%s: expected an object"), *Path));
+            return;
+        }
+        if (!ExpectedObj.IsValid())
+        {
+            return;
+        }
+        for (const TPair<FString, TSharedPtr<FJsonValue>> &Field : ExpectedObj->Values)
+        {
+            MWCS_CompareJsonValue(Field.Value, (*ActualObj)->TryGetField(Field.Key), Path + TEXT(".") + Field.Key, OutDifferences);
+        }
+        break;
+    }
+    case EJson::Array:
+    {
+        const TArray<TSharedPtr<FJsonValue>> *ActualArray = nullptr;
+        if (!Actual->TryGetArray(ActualArray) || !ActualArray)
+        {
+            OutDifferences.Add(FString::Printf(TEXT("%s: expected an array"), *Path));
+            return;
+        }
+        const TArray<TSharedPtr<FJsonValue>> &ExpectedArray = Expected->AsArray();
+        if (ExpectedArray.Num() != ActualArray->Num())
+        {
+            OutDifferences.Add(FString::Printf(TEXT("%s: expected %d element(s), got %d"), *Path, ExpectedArray.Num(), ActualArray->Num()));
+            return;
+        }
+        for (int32 Index = 0; Index < ExpectedArray.Num(); ++Index)
+        {
+            MWCS_CompareJsonValue(ExpectedArray[Index], (*ActualArray)[Index], FString::Printf(TEXT("%s[%d]"), *Path, Index), OutDifferences);
+        }
+        break;
+    }
+    case EJson::Number:
+    {
+        double ActualNumber = 0.0;
+        if (!Actual->TryGetNumber(ActualNumber) || !MWCS_NearlyEqual(Expected->AsNumber(), ActualNumber))
+        {
+            OutDifferences.Add(FString::Printf(TEXT("%s: expected %g, got '%s'"), *Path, Expected->AsNumber(), *Actual->AsString()));
+        }
+        break;
+    }
+    case EJson::Boolean:
+    {
+        bool bActual = false;
+        if (!Actual->TryGetBool(bActual) || bActual != Expected->AsBool())
+        {
+            OutDifferences.Add(FString::Printf(TEXT("%s: expected %s, got '%s'"), *Path, Expected->AsBool() ? TEXT("true") : TEXT("false"), *Actual->AsString()));
+        }
+        break;
+    }
+    case EJson::String:
+    {
+        FString ActualString;
+        if (!Actual->TryGetString(ActualString) || !ActualString.Equals(Expected->AsString(), ESearchCase::IgnoreCase))
+        {
+            OutDifferences.Add(FString::Printf(TEXT("%s: expected '%s', got '%s'"), *Path, *Expected->AsString(), *Actual->AsString()));
+        }
+        break;
+    }
+    default:
+        break;
+    }
+}
+
+static void MWCS_CompareNodes(const FMWCS_HierarchyNode &Expected, const FMWCS_HierarchyNode &Actual, const FString &Path, TArray<FString> &OutDifferences)
+{
+    if (Expected.Name != Actual.Name || Expected.Type != Actual.Type)
+    {
+        OutDifferences.Add(FString::Printf(TEXT("%s: expected %s '%s', got %s '%s'"), *Path,
+                                           *Expected.Type.ToString(), *Expected.Name.ToString(), *Actual.Type.ToString(), *Actual.Name.ToString()));
+        // Everything below would be compared against the wrong widget.
+        return;
+    }
+
+    auto Differ = [&OutDifferences, &Path](const TCHAR *Field, const FString &ExpectedValue, const FString &ActualValue)
+    {
+        OutDifferences.Add(FString::Printf(TEXT("%s.%s: expected %s, got %s"), *Path, Field, *ExpectedValue, *ActualValue));
+    };
+
+    if (!Expected.Text.IsEmpty() && !Expected.Text.Equals(Actual.Text, ESearchCase::CaseSensitive))
+    {
+        Differ(TEXT("Text"), FString::Printf(TEXT("'%s'"), *Expected.Text), FString::Printf(TEXT("'%s'"), *Actual.Text));
+    }
+    if (!Expected.WidgetClassPath.IsEmpty() && !Expected.WidgetClassPath.Equals(Actual.WidgetClassPath, ESearchCase::IgnoreCase))
+    {
+        Differ(TEXT("WidgetClass"), Expected.WidgetClassPath, Actual.WidgetClassPath);
+    }
+    if (Expected.FontSize > 0 && Expected.FontSize != Actual.FontSize)
+    {
+        Differ(TEXT("FontSize"), LexToString(Expected.FontSize), LexToString(Actual.FontSize));
+    }
+    if (!Expected.Justification.IsEmpty() && !Expected.Justification.Equals(Actual.Justification, ESearchCase::IgnoreCase))
+    {
+        Differ(TEXT("Justification"), Expected.Justification, Actual.Justification);
+    }
+
+    if (Expected.bHasSlotPadding && (!Actual.bHasSlotPadding || !MWCS_MarginNearlyEqual(Expected.SlotPadding, Actual.SlotPadding)))
+    {
+        Differ(TEXT("Slot.Padding"), MWCS_MarginToString(Expected.SlotPadding), Actual.bHasSlotPadding ? MWCS_MarginToString(Actual.SlotPadding) : TEXT("<unset>"));
+    }
+    if (Expected.bHasSlotHAlign && (!Actual.bHasSlotHAlign || Expected.SlotHAlign != Actual.SlotHAlign))
+    {
+        Differ(TEXT("Slot.HAlign"), LexToString(static_cast<int32>(Expected.SlotHAlign)), Actual.bHasSlotHAlign ? LexToString(static_cast<int32>(Actual.SlotHAlign)) : TEXT("<unset>"));
+    }
+    if (Expected.bHasSlotVAlign && (!Actual.bHasSlotVAlign || Expected.SlotVAlign != Actual.SlotVAlign))
+    {
+        Differ(TEXT("Slot.VAlign"), LexToString(static_cast<int32>(Expected.SlotVAlign)), Actual.bHasSlotVAlign ? LexToString(static_cast<int32>(Actual.SlotVAlign)) : TEXT("<unset>"));
+    }
+    if (Expected.bHasSlotSize &&
+        (!Actual.bHasSlotSize || Expected.SlotSizeRule != Actual.SlotSizeRule ||
+         (Expected.SlotSizeRule == ESlateSizeRule::Fill && !MWCS_NearlyEqual(Expected.SlotSizeValue, Actual.SlotSizeValue))))
+    {
+        Differ(TEXT("Slot.Size"), FString::Printf(TEXT("%d/%g"), static_cast<int32>(Expected.SlotSizeRule), Expected.SlotSizeValue),
+               Actual.bHasSlotSize ? FString::Printf(TEXT("%d/%g"), static_cast<int32>(Actual.SlotSizeRule), Actual.SlotSizeValue) : TEXT("<unset>"));
+    }
+
+    if (Expected.bHasCanvasAnchors &&
+        (!Actual.bHasCanvasAnchors || !MWCS_Vector2NearlyEqual(Expected.CanvasAnchorsMin, Actual.CanvasAnchorsMin) || !MWCS_Vector2NearlyEqual(Expected.CanvasAnchorsMax, Actual.CanvasAnchorsMax)))
+    {
+        Differ(TEXT("Slot.Anchors"), MWCS_Vector2ToString(Expected.CanvasAnchorsMin) + MWCS_Vector2ToString(Expected.CanvasAnchorsMax),
+               Actual.bHasCanvasAnchors ? MWCS_Vector2ToString(Actual.CanvasAnchorsMin) + MWCS_Vector2ToString(Actual.CanvasAnchorsMax) : TEXT("<unset>"));
+    }
+    if (Expected.bHasCanvasOffsets && (!Actual.bHasCanvasOffsets || !MWCS_MarginNearlyEqual(Expected.CanvasOffsets, Actual.CanvasOffsets)))
+    {
+        Differ(TEXT("Slot.Offsets"), MWCS_MarginToString(Expected.CanvasOffsets), Actual.bHasCanvasOffsets ? MWCS_MarginToString(Actual.CanvasOffsets) : TEXT("<unset>"));
+    }
+    if (Expected.bHasCanvasAlignment && (!Actual.bHasCanvasAlignment || !MWCS_Vector2NearlyEqual(Expected.CanvasAlignment, Actual.CanvasAlignment)))
+    {
+        Differ(TEXT("Slot.Alignment"), MWCS_Vector2ToString(Expected.CanvasAlignment), Actual.bHasCanvasAlignment ? MWCS_Vector2ToString(Actual.CanvasAlignment) : TEXT("<unset>"));
+    }
+    if (Expected.bHasCanvasAutoSize && (!Actual.bHasCanvasAutoSize || Expected.bCanvasAutoSize != Actual.bCanvasAutoSize))
+    {
+        Differ(TEXT("Slot.AutoSize"), LexToString(Expected.bCanvasAutoSize), Actual.bHasCanvasAutoSize ? LexToString(Actual.bCanvasAutoSize) : TEXT("<unset>"));
+    }
+    if (Expected.bHasCanvasZOrder && (!Actual.bHasCanvasZOrder || Expected.CanvasZOrder != Actual.CanvasZOrder))
+    {
+        Differ(TEXT("Slot.ZOrder"), LexToString(Expected.CanvasZOrder), Actual.bHasCanvasZOrder ? LexToString(Actual.CanvasZOrder) : TEXT("<unset>"));
+    }
+
+    if (Expected.bHasOrientation && (!Actual.bHasOrientation || Expected.Orientation != Actual.Orientation))
+    {
+        Differ(TEXT("Orientation"), LexToString(static_cast<int32>(Expected.Orientation)), Actual.bHasOrientation ? LexToString(static_cast<int32>(Actual.Orientation)) : TEXT("<unset>"));
+    }
+    if (Expected.bHasScrollBarVisibility && (!Actual.bHasScrollBarVisibility || Expected.ScrollBarVisibility != Actual.ScrollBarVisibility))
+    {
+        Differ(TEXT("ScrollBarVisibility"), LexToString(static_cast<int32>(Expected.ScrollBarVisibility)),
+               Actual.bHasScrollBarVisibility ? LexToString(static_cast<int32>(Actual.ScrollBarVisibility)) : TEXT("<unset>"));
+    }
+    if (Expected.bHasSpacerSize && (!Actual.bHasSpacerSize || !MWCS_Vector2NearlyEqual(Expected.SpacerSize, Actual.SpacerSize)))
+    {
+        Differ(TEXT("Size"), MWCS_Vector2ToString(Expected.SpacerSize), Actual.bHasSpacerSize ? MWCS_Vector2ToString(Actual.SpacerSize) : TEXT("<unset>"));
+    }
+
+    if (Expected.Children.Num() != Actual.Children.Num())
+    {
+        Differ(TEXT("Children"), LexToString(Expected.Children.Num()), LexToString(Actual.Children.Num()));
+    }
+    const int32 NumChildren = FMath::Min(Expected.Children.Num(), Actual.Children.Num());
+    for (int32 Index = 0; Index < NumChildren; ++Index)
+    {
+        MWCS_CompareNodes(Expected.Children[Index], Actual.Children[Index], Path + TEXT("/") + Expected.Children[Index].Name.ToString(), OutDifferences);
+    }
+}
+
+bool FMWCS_RoundTrip::CompareSpecs(const FMWCS_WidgetSpec &Original, const FMWCS_WidgetSpec &RoundTripped, TArray<FString> &OutDifferences)
+{
+    const int32 NumBefore = OutDifferences.Num();
+
+    if (Original.BlueprintName != RoundTripped.BlueprintName)
+    {
+        OutDifferences.Add(FString::Printf(TEXT("BlueprintName: expected %s, got %s"), *Original.BlueprintName.ToString(), *RoundTripped.BlueprintName.ToString()));
+    }
+    if (!Original.ParentClassPath.IsEmpty() && !Original.ParentClassPath.Equals(RoundTripped.ParentClassPath, ESearchCase::IgnoreCase))
+    {
+        OutDifferences.Add(FString::Printf(TEXT("ParentClass: expected %s, got %s"), *Original.ParentClassPath, *RoundTripped.ParentClassPath));
+    }
+
+    const FMWCS_DesignerPreview &ExpectedPreview = Original.DesignerPreview;
+    const FMWCS_DesignerPreview &ActualPreview = RoundTripped.DesignerPreview;
+    if (ExpectedPreview.SizeMode != ActualPreview.SizeMode)
+    {
+        OutDifferences.Add(FString::Printf(TEXT("DesignerPreview.SizeMode: expected %d, got %d"), static_cast<int32>(ExpectedPreview.SizeMode), static_cast<int32>(ActualPreview.SizeMode)));
+    }
+    else if (ExpectedPreview.SizeMode == EMWCS_PreviewSizeMode::Custom && !MWCS_Vector2NearlyEqual(ExpectedPreview.CustomSize, ActualPreview.CustomSize))
+    {
+        OutDifferences.Add(FString::Printf(TEXT("DesignerPreview.CustomSize: expected %s, got %s"), *MWCS_Vector2ToString(ExpectedPreview.CustomSize), *MWCS_Vector2ToString(ActualPreview.CustomSize)));
+    }
+
+    MWCS_CompareNodes(Original.HierarchyRoot, RoundTripped.HierarchyRoot, TEXT("Hierarchy/") + Original.HierarchyRoot.Name.ToString(), OutDifferences);
+
+    TArray<FName> DesignKeys;
+    Original.Design.GetKeys(DesignKeys);
+    DesignKeys.Sort(FNameLexicalLess());
+    for (const FName &Key : DesignKeys)
+    {
+        const TSharedPtr<FJsonObject> &ExpectedObj = Original.Design.FindChecked(Key);
+        const TSharedPtr<FJsonObject> *ActualObj = RoundTripped.Design.Find(Key);
+        const TSharedPtr<FJsonValue> ActualValue = (ActualObj && ActualObj->IsValid()) ? MakeShared<FJsonValueObject>(*ActualObj) : TSharedPtr<FJsonValue>();
+        if (ExpectedObj.IsValid())
+        {
+            MWCS_CompareJsonValue(MakeShared<FJsonValueObject>(ExpectedObj), ActualValue, TEXT("Design.") + Key.ToString(), OutDifferences);
+        }
+    }
+
+    return OutDifferences.Num() == NumBefore;
+}
+
+bool FMWCS_RoundTrip::RunSpecFile(const FString &SpecPath, const FMWCS_RoundTripOptions &Options, FMWCS_RoundTripResult &OutResult, FMWCS_Report &InOutReport)
+{
+    OutResult = FMWCS_RoundTripResult();
+    OutResult.SpecPath = SpecPath;
+    const FString Context = FPaths::GetCleanFilename(SpecPath);
+
+    double Stage = FPlatformTime::Seconds();
+    FString Json;
+    FMWCS_WidgetSpec Original;
+    if (!FFileHelper::LoadFileToString(Json, *SpecPath))
+    {
+        AddIssue(InOutReport, EMWCS_IssueSeverity::Error, TEXT("RoundTrip.ReadFailed"), TEXT("Could not read the spec file."), SpecPath);
+        return false;
+    }
+    if (!FMWCS_SpecParser::ParseSpecJson(Json, Original, InOutReport, SpecPath))
+    {
+        AddIssue(InOutReport, EMWCS_IssueSeverity::Error, TEXT("RoundTrip.ParseFailed"), TEXT("The spec did not parse."), SpecPath);
+        return false;
+    }
+    // The build collapses redundant containers when the optimizer is on; the extraction can only match that hierarchy.
+    if (FMWCS_SpecOptimizer::IsEnabled(Original))
+    {
+        FMWCS_SpecOptimizer::Optimize(Original);
+    }
+    OutResult.BlueprintName = Original.BlueprintName;
+    OutResult.ParseMs = (FPlatformTime::Seconds() - Stage) * 1000.0;
+
+    Stage = FPlatformTime::Seconds();
+    FMWCS_BuildOptions BuildOptions;
+    BuildOptions.OutputPathOverride = Options.OutputPath.IsEmpty() ? TEXT("/Temp/MWCS_RoundTrip") : Options.OutputPath;
+    BuildOptions.bSkipSave = true;
+    FMWCS_Report BuildReport;
+    UWidgetBlueprint *Built = nullptr;
+    const bool bBuilt = FMWCS_WidgetBuilder::CreateOrUpdateFromSpec(Original, EMWCS_BuildMode::ForceRecreate, BuildOptions, BuildReport, &Built);
+    for (const FMWCS_Issue &Issue : BuildReport.Issues)
+    {
+        if (Issue.Severity != EMWCS_IssueSeverity::Info)
+        {
+            InOutReport.Issues.Add(Issue);
+        }
+    }
+    OutResult.BuildMs = (FPlatformTime::Seconds() - Stage) * 1000.0;
+    if (!bBuilt || !Built)
+    {
+        AddIssue(InOutReport, EMWCS_IssueSeverity::Error, TEXT("RoundTrip.BuildFailed"), TEXT("The spec did not build."), SpecPath);
+        return false;
+    }
+
+    Stage = FPlatformTime::Seconds();
+    FMWCS_ExtractOptions ExtractOptions;
+    ExtractOptions.bMinimal = Options.bMinimal;
+    ExtractOptions.bMinified = true;
+    FString Extracted;
+    FMWCS_WidgetSpec RoundTripped;
+    const bool bExtracted = FMWCS_WidgetExtractor::ExtractToJson(Built, ExtractOptions, Extracted, InOutReport) &&
+                            FMWCS_SpecParser::ParseSpecJson(Extracted, RoundTripped, InOutReport, Built->GetPathName());
+    OutResult.ExtractMs = (FPlatformTime::Seconds() - Stage) * 1000.0;
+    if (!bExtracted)
+    {
+        AddIssue(InOutReport, EMWCS_IssueSeverity::Error, TEXT("RoundTrip.ExtractFailed"), TEXT("The built asset did not extract to a parseable spec."), SpecPath);
+        return false;
+    }
+
+    Stage = FPlatformTime::Seconds();
+    OutResult.bPassed = CompareSpecs(Original, RoundTripped, OutResult.Differences);
+    OutResult.CompareMs = (FPlatformTime::Seconds() - Stage) * 1000.0;
+
+    if (OutResult.bPassed)
+    {
+        AddIssue(InOutReport, EMWCS_IssueSeverity::Info, TEXT("RoundTrip.Ok"),
+                 FString::Printf(TEXT("%s: parse %.1fms, build %.1fms, extract %.1fms, compare %.1fms"),
+                                 *Context, OutResult.ParseMs, OutResult.BuildMs, OutResult.ExtractMs, OutResult.CompareMs),
+                 SpecPath);
+    }
+    for (const FString &Difference : OutResult.Differences)
+    {
+        AddIssue(InOutReport, EMWCS_IssueSeverity::Error, TEXT("RoundTrip.Mismatch"), Difference, SpecPath);
+    }
+    return OutResult.bPassed;
+}
+
+void FMWCS_RoundTrip::RunDirectory(const FString &SpecDir, const FMWCS_RoundTripOptions &Options, TArray<FMWCS_RoundTripResult> &OutResults, FMWCS_Report &InOutReport)
+{
+    OutResults.Reset();
+
+    TArray<FString> Files;
+    IFileManager::Get().FindFilesRecursive(Files, *SpecDir, TEXT("*.json"), /*Files*/ true, /*Directories*/ false);
+    Files.Sort();
+    if (Files.Num() == 0)
+    {
+        AddIssue(InOutReport, EMWCS_IssueSeverity::Error, TEXT("RoundTrip.NoSpecs"), TEXT("No *.json specs found."), SpecDir);
+        return;
+    }
+
+    const double Start = FPlatformTime::Seconds();
+    int32 NumPassed = 0;
+    for (const FString &File : Files)
+    {
+        FMWCS_RoundTripResult &Result = OutResults.AddDefaulted_GetRef();
+        if (RunSpecFile(File, Options, Result, InOutReport))
+        {
+            ++NumPassed;
+        }
+        InOutReport.SpecsProcessed++;
+
+        // Each built blueprint lives in an unsaved /Temp package; release it before the next spec.
+        CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+    }
+
+    AddIssue(InOutReport, EMWCS_IssueSeverity::Info, TEXT("RoundTrip.Summary"),
+             FString::Printf(TEXT("%d of %d spec(s) round-tripped (%.2fs)."), NumPassed, Files.Num(), FPlatformTime::Seconds() - Start),
+             SpecDir);
+}
+
+FString FMWCS_RoundTrip::GetDefaultSpecDir()
+{
+    const TSharedPtr<IPlugin> Plugin = IPluginManager::Get().FindPlugin(TEXT("P_MWCS"));
+    return Plugin.IsValid() ? FPaths::Combine(Plugin->GetBaseDir(), TEXT("Tests"), TEXT("TestSpecs")) : FString();
+}
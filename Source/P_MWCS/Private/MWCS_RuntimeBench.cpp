@@ -0,0 +1,217 @@
+#include "MWCS_RuntimeBench.h"
+
+#include "MWCS_Benchmark.h"
+#include "MWCS_CanonicalJson.h"
+#include "MWCS_Settings.h"
+
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "Blueprint/UserWidget.h"
+#include "Blueprint/WidgetTree.h"
+#include "Editor.h"
+#include "Framework/Application/SlateApplication.h"
+#include "HAL/PlatformMemory.h"
+#include "HAL/PlatformTime.h"
+#include "Interfaces/ISlateNullRendererModule.h"
+#include "Null/NullPlatformApplicationMisc.h"
+#include "UObject/StrongObjectPtr.h"
+#include "UObject/UObjectArray.h"
+#include "UObject/UObjectGlobals.h"
+#include "WidgetBlueprint.h"
+
+#include "MWCS_Utilities.h"
+
+using namespace MWCS_Utilities;
+
+static int32 MWCS_CountSlateWidgets(const TSharedRef<SWidget> &Widget)
+{
+    int32 Count = 1;
+    if (FChildren *Children = Widget->GetChildren())
+    {
+        for (int32 Index = 0; Index < Children->Num(); ++Index)
+        {
+            Count += MWCS_CountSlateWidgets(Children->GetChildAt(Index));
+        }
+    }
+    return Count;
+}
+
+bool FMWCS_RuntimeBench::EnsureSlate(FMWCS_Report &InOutReport)
+{
+    if (FSlateApplication::IsInitialized())
+    {
+        return true;
+    }
+
+    // Same setup as the engine's -NullRHI unattended paths: no windows, no GPU, but font measurement works.
+    FSlateApplication::Create(MakeShareable(FNullPlatformApplicationMisc::CreateApplication()));
+    ISlateNullRendererModule *NullRenderer = FModuleManager::LoadModulePtr<ISlateNullRendererModule>(TEXT("SlateNullRenderer"));
+    if (!FSlateApplication::IsInitialized() || !NullRenderer || !FSlateApplication::Get().InitializeRenderer(NullRenderer->CreateSlateNullRenderer(), /*bQuietMode*/ true))
+    {
+        AddIssue(InOutReport, EMWCS_IssueSeverity::Error, TEXT("RuntimeBench.NoSlate"), TEXT("Could not initialize Slate with the null renderer."), TEXT("RuntimeBench"));
+        return false;
+    }
+    return true;
+}
+
+bool FMWCS_RuntimeBench::MeasureClass(UClass *WidgetClass, const FMWCS_RuntimeBenchOptions &Options, FMWCS_RuntimeBenchRow &OutRow, FMWCS_Report &InOutReport)
+{
+    OutRow = FMWCS_RuntimeBenchRow();
+    OutRow.AssetPath = WidgetClass ? WidgetClass->GetPathName() : FString();
+    if (UObject *Outer = WidgetClass ? WidgetClass->ClassGeneratedBy.Get() : nullptr)
+    {
+        OutRow.AssetPath = Outer->GetPathName();
+    }
+
+    UWorld *World = GEditor ? GEditor->GetEditorWorldContext().World() : nullptr;
+    if (!WidgetClass || !WidgetClass->IsChildOf(UUserWidget::StaticClass()) || WidgetClass->HasAnyClassFlags(CLASS_Abstract) || !World)
+    {
+        AddIssue(InOutReport, EMWCS_IssueSeverity::Warning, TEXT("RuntimeBench.CreateFailed"),
+                 World ? TEXT("Not an instantiable UserWidget class.") : TEXT("No editor world to create widgets in."), OutRow.AssetPath);
+        return false;
+    }
+
+    // The garbage collections between passes must not take the class (transient blueprints in tests) with them.
+    const TStrongObjectPtr<UClass> ClassGuard(WidgetClass);
+    const int32 Instances = FMath::Max(1, Options.Instances);
+
+    TArray<double> CreateSamples;
+    TArray<double> TakeWidgetSamples;
+    TArray<double> PrepassSamples;
+    TArray<double> ObjectSamples;
+    TArray<double> MemorySamples;
+    for (int32 Pass = 0; Pass < FMath::Max(1, Options.Passes); ++Pass)
+    {
+        CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+        const int32 ObjectsBefore = GUObjectArray.GetObjectArrayNumMinusAvailable();
+        const uint64 UsedBefore = FPlatformMemory::GetStats().UsedPhysical;
+
+        TArray<TStrongObjectPtr<UUserWidget>> Widgets;
+        Widgets.Reserve(Instances);
+        double Start = FPlatformTime::Seconds();
+        for (int32 Index = 0; Index < Instances; ++Index)
+        {
+            Widgets.Emplace(CreateWidget<UUserWidget>(World, WidgetClass));
+        }
+        const double CreateSeconds = FPlatformTime::Seconds() - Start;
+
+        if (!Widgets[0].IsValid())
+        {
+            AddIssue(InOutReport, EMWCS_IssueSeverity::Warning, TEXT("RuntimeBench.CreateFailed"), TEXT("CreateWidget returned null."), OutRow.AssetPath);
+            return false;
+        }
+
+        // UUserWidget only keeps a weak pointer to its Slate tree; hold it so the prepass and the memory figure see it.
+        TArray<TSharedRef<SWidget>> SlateWidgets;
+        SlateWidgets.Reserve(Instances);
+        Start = FPlatformTime::Seconds();
+        for (const TStrongObjectPtr<UUserWidget> &Widget : Widgets)
+        {
+            SlateWidgets.Add(Widget->TakeWidget());
+        }
+        const double TakeWidgetSeconds = FPlatformTime::Seconds() - Start;
+
+        Start = FPlatformTime::Seconds();
+        for (const TSharedRef<SWidget> &SlateWidget : SlateWidgets)
+        {
+            SlateWidget->SlatePrepass(Options.LayoutScale);
+        }
+        const double PrepassSeconds = FPlatformTime::Seconds() - Start;
+
+        const int64 ObjectsDelta = GUObjectArray.GetObjectArrayNumMinusAvailable() - ObjectsBefore;
+        const int64 UsedDelta = static_cast<int64>(FPlatformMemory::GetStats().UsedPhysical) - static_cast<int64>(UsedBefore);
+
+        CreateSamples.Add(CreateSeconds * 1e6 / Instances);
+        TakeWidgetSamples.Add(TakeWidgetSeconds * 1e6 / Instances);
+        PrepassSamples.Add(PrepassSeconds * 1e6 / Instances);
+        ObjectSamples.Add(static_cast<double>(ObjectsDelta) / Instances);
+        MemorySamples.Add(FMath::Max<int64>(0, UsedDelta) / 1024.0 / Instances);
+
+        if (Pass == 0)
+        {
+            TArray<UWidget *> TreeWidgets;
+            if (Widgets[0]->WidgetTree)
+            {
+                Widgets[0]->WidgetTree->GetAllWidgets(TreeWidgets);
+            }
+            OutRow.Widgets = TreeWidgets.Num();
+            OutRow.SlateWidgets = MWCS_CountSlateWidgets(SlateWidgets[0]);
+        }
+    }
+    CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+
+    OutRow.CreateUs = FMWCS_Benchmark::Median(CreateSamples);
+    OutRow.TakeWidgetUs = FMWCS_Benchmark::Median(TakeWidgetSamples);
+    OutRow.PrepassUs = FMWCS_Benchmark::Median(PrepassSamples);
+    OutRow.UObjects = FMWCS_Benchmark::Median(ObjectSamples);
+    OutRow.MemoryKB = FMWCS_Benchmark::Median(MemorySamples);
+    return true;
+}
+
+void FMWCS_RuntimeBench::Run(const FMWCS_RuntimeBenchOptions &Options, FMWCS_RuntimeBenchResult &OutResult, FMWCS_Report &InOutReport)
+{
+    OutResult = FMWCS_RuntimeBenchResult();
+    OutResult.Instances = FMath::Max(1, Options.Instances);
+    OutResult.Passes = FMath::Max(1, Options.Passes);
+    if (!EnsureSlate(InOutReport))
+    {
+        return;
+    }
+
+    const FString Path = Options.Path.IsEmpty() ? GetDefault<UMWCS_Settings>()->OutputRootPath : Options.Path;
+    IAssetRegistry &AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry")).Get();
+    FARFilter ARFilter;
+    ARFilter.PackagePaths.Add(FName(*Path));
+    ARFilter.bRecursivePaths = true;
+    ARFilter.ClassPaths.Add(UWidgetBlueprint::StaticClass()->GetClassPathName());
+    ARFilter.bRecursiveClasses = true;
+    TArray<FAssetData> Assets;
+    AssetRegistry.GetAssets(ARFilter, Assets);
+    Assets.Sort([](const FAssetData &A, const FAssetData &B)
+                { return A.PackageName.LexicalLess(B.PackageName); });
+
+    for (const FAssetData &Asset : Assets)
+    {
+        const UWidgetBlueprint *WidgetBlueprint = Cast<UWidgetBlueprint>(Asset.GetAsset());
+        if (!WidgetBlueprint || !WidgetBlueprint->GeneratedClass)
+        {
+            AddIssue(InOutReport, EMWCS_IssueSeverity::Warning, TEXT("RuntimeBench.CreateFailed"), TEXT("Widget Blueprint has no generated class (not compiled?)."), Asset.GetObjectPathString());
+            continue;
+        }
+
+        FMWCS_RuntimeBenchRow Row;
+        if (MeasureClass(WidgetBlueprint->GeneratedClass, Options, Row, InOutReport))
+        {
+            OutResult.Rows.Add(MoveTemp(Row));
+        }
+    }
+
+    AddIssue(InOutReport, EMWCS_IssueSeverity::Info, TEXT("RuntimeBench.Summary"),
+             FString::Printf(TEXT("%d of %d class(es) measured, %d instance(s) x %d pass(es) each."), OutResult.Rows.Num(), Assets.Num(), OutResult.Instances, OutResult.Passes),
+             Path);
+}
+
+FString FMWCS_RuntimeBench::ToJson(const FMWCS_RuntimeBenchResult &Result)
+{
+    FMWCS_CanonicalJsonWriter Writer;
+    Writer.BeginObject();
+    Writer.Write(TEXT("Instances"), Result.Instances);
+    Writer.Write(TEXT("Passes"), Result.Passes);
+    Writer.BeginArray(TEXT("Classes"));
+    for (const FMWCS_RuntimeBenchRow &Row : Result.Rows)
+    {
+        Writer.BeginObject();
+        Writer.Write(TEXT("Asset"), Row.AssetPath);
+        Writer.Write(TEXT("Widgets"), Row.Widgets);
+        Writer.Write(TEXT("SlateWidgets"), Row.SlateWidgets);
+        Writer.Write(TEXT("CreateUs"), Row.CreateUs);
+        Writer.Write(TEXT("TakeWidgetUs"), Row.TakeWidgetUs);
+        Writer.Write(TEXT("PrepassUs"), Row.PrepassUs);
+        Writer.Write(TEXT("TotalUs"), Row.TotalUs());
+        Writer.Write(TEXT("UObjects"), Row.UObjects);
+        Writer.Write(TEXT("MemoryKB"), Row.MemoryKB);
+        Writer.EndObject();
+    }
+    Writer.EndArray();
+    Writer.EndObject();
+    return Writer.GetOutput();
+}
@@ -1,5 +1,8 @@
 #include "MWCS_Service.h"
 
+#include "MWCS_AssetIndex.h"
+#include "MWCS_Discovery.h"
+#include "MWCS_PerfLint.h"
 #include "MWCS_Report.h"
 #include "MWCS_Settings.h"
 #include "MWCS_WidgetBuilder.h"
@@ -7,10 +10,16 @@
 #include "MWCS_SpecParser.h"
 #include "MWCS_WidgetValidator.h"
 
+#include "MWCS_Utilities.h"
+using namespace MWCS_Utilities;
+
+#include "Async/Async.h"
 #include "HAL/PlatformFileManager.h"
 #include "Misc/DateTime.h"
 #include "Misc/FileHelper.h"
+#include "Misc/PackageName.h"
 #include "Misc/Paths.h"
+#include "UObject/Package.h"
 
 FMWCS_Service &FMWCS_Service::Get()
 {
@@ -35,32 +44,310 @@ bool FMWCS_Service::SaveReportJson(const FMWCS_Report &Report, const FString &Fi
     return FFileHelper::SaveStringToFile(Json, *FullPath);
 }
 
-FMWCS_Report FMWCS_Service::ValidateAll()
+bool FMWCS_Service::SavePlanJson(const FMWCS_Plan &Plan) const
+{
+    const FString Dir = FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("MWCS"), TEXT("Plans"));
+    IPlatformFile &PF = FPlatformFileManager::Get().GetPlatformFile();
+    PF.CreateDirectoryTree(*Dir);
+
+    const FString Filename = FString::Printf(TEXT("MWCS_Plan_%s.json"), *TimestampForFilename());
+    const FString FullPath = FPaths::Combine(Dir, Filename);
+    return FFileHelper::SaveStringToFile(MWCS_PlanJson::ToJsonString(Plan), *FullPath);
+}
+
+// The Perf.* lint stage of every validate entry point (ValidateAll, ValidateAssets, BuildAndValidateAll and the
+// time-sliced StartValidateAll); a no-op unless bPerfLintInValidateAll is set.
+static void MWCS_RunValidateLint(TArrayView<const FMWCS_WidgetSpec> Specs, FMWCS_Report &Report)
+{
+    if (!GetDefault<UMWCS_Settings>()->bPerfLintInValidateAll)
+    {
+        return;
+    }
+    const MWCS_Core::FPerfLintOptions LintOptions = FMWCS_PerfLint::GetOptions();
+    for (const FMWCS_WidgetSpec &Spec : Specs)
+    {
+        FMWCS_PerfLint::LintSpec(Spec, LintOptions, Report);
+    }
+}
+
+FMWCS_Report FMWCS_Service::ValidateAll(const FMWCS_SpecFilter &Filter)
 {
     FMWCS_Report Report;
     TArray<FMWCS_WidgetSpec> Specs;
     FMWCS_WidgetRegistry::CollectSpecs(Specs, Report);
+    Filter.Apply(Specs, Report);
+    FMWCS_Discovery::PrepareForSpecs(Specs, Report);
     for (const FMWCS_WidgetSpec &Spec : Specs)
     {
         FMWCS_WidgetValidator::ValidateSpecAsset(Spec, Report);
     }
+    MWCS_RunValidateLint(Specs, Report);
     SaveReportJson(Report, TEXT("Validate"));
     return Report;
 }
 
-FMWCS_Report FMWCS_Service::BuildAll(EMWCS_BuildMode Mode)
+FMWCS_Report FMWCS_Service::BuildAll(EMWCS_BuildMode Mode, const FMWCS_SpecFilter &Filter)
 {
     FMWCS_Report Report;
     TArray<FMWCS_WidgetSpec> Specs;
     FMWCS_WidgetRegistry::CollectSpecs(Specs, Report);
+    Filter.Apply(Specs, Report);
+    FMWCS_Discovery::PrepareForSpecs(Specs, Report);
     for (const FMWCS_WidgetSpec &Spec : Specs)
     {
         FMWCS_WidgetBuilder::CreateOrUpdateFromSpec(Spec, Mode, Report);
     }
+    FMWCS_AssetIndex::Get().SaveIfDirty();
+    SaveReportJson(Report, TEXT("Build"));
+    return Report;
+}
+
+static void MWCS_CollectSpecsForAssets(const TArray<FString> &AssetPaths, TArray<FMWCS_WidgetSpec> &OutSpecs, FMWCS_Report &Report)
+{
+    TSet<FString> Providers;
+    TSet<FName> Names;
+    bool bNeedAllProviders = false;
+    for (const FString &AssetPath : AssetPaths)
+    {
+        Names.Add(FName(*FPackageName::GetShortName(AssetPath)));
+        if (const FMWCS_AssetIndexEntry *Entry = FMWCS_AssetIndex::Get().Find(AssetPath))
+        {
+            Providers.Add(Entry->ProviderPath);
+        }
+        else
+        {
+            bNeedAllProviders = true;
+        }
+    }
+
+    FMWCS_WidgetRegistry::CollectSpecs(OutSpecs, Report, bNeedAllProviders ? nullptr : &Providers);
+    OutSpecs.RemoveAll([&Names](const FMWCS_WidgetSpec &Spec)
+                       { return !Names.Contains(Spec.BlueprintName); });
+    Report.SpecsProcessed = OutSpecs.Num();
+
+    for (const FName Name : Names)
+    {
+        if (!OutSpecs.ContainsByPredicate([Name](const FMWCS_WidgetSpec &Spec)
+                                          { return Spec.BlueprintName == Name; }))
+        {
+            AddIssue(Report, EMWCS_IssueSeverity::Warning, TEXT("Index.NoSpecForAsset"), TEXT("No configured provider produces a spec for this asset."), Name.ToString());
+        }
+    }
+    AddIssue(Report, EMWCS_IssueSeverity::Info, TEXT("Index.Selected"),
+             FString::Printf(TEXT("%d asset(s) -> %d spec(s) from %s."), AssetPaths.Num(), OutSpecs.Num(),
+                             bNeedAllProviders ? TEXT("all providers (not every asset was indexed)") : *FString::Printf(TEXT("%d indexed provider(s)"), Providers.Num())),
+             TEXT("AssetIndex"));
+}
+
+FMWCS_Report FMWCS_Service::ValidateAssets(const TArray<FString> &AssetPaths)
+{
+    FMWCS_Report Report;
+    TArray<FMWCS_WidgetSpec> Specs;
+    MWCS_CollectSpecsForAssets(AssetPaths, Specs, Report);
+    FMWCS_Discovery::PrepareForSpecs(Specs, Report);
+    for (const FMWCS_WidgetSpec &Spec : Specs)
+    {
+        FMWCS_WidgetValidator::ValidateSpecAsset(Spec, Report);
+    }
+    MWCS_RunValidateLint(Specs, Report);
+    SaveReportJson(Report, TEXT("Validate"));
+    return Report;
+}
+
+FMWCS_Report FMWCS_Service::BuildAssets(EMWCS_BuildMode Mode, const TArray<FString> &AssetPaths)
+{
+    FMWCS_Report Report;
+    TArray<FMWCS_WidgetSpec> Specs;
+    MWCS_CollectSpecsForAssets(AssetPaths, Specs, Report);
+    FMWCS_Discovery::PrepareForSpecs(Specs, Report);
+    for (const FMWCS_WidgetSpec &Spec : Specs)
+    {
+        FMWCS_WidgetBuilder::CreateOrUpdateFromSpec(Spec, Mode, Report);
+    }
+    FMWCS_AssetIndex::Get().SaveIfDirty();
+    SaveReportJson(Report, TEXT("Build"));
+    return Report;
+}
+
+FMWCS_Report FMWCS_Service::BuildAllPipelined(EMWCS_BuildMode Mode, const FMWCS_SpecFilter &Filter)
+{
+    FMWCS_Report Report;
+
+    const UMWCS_Settings *Settings = UMWCS_Settings::Get();
+    const int32 ParseAhead = FMath::Max(1, Settings ? Settings->PipelineParseAhead : 2);
+    const int32 MaxPendingSaves = FMath::Max(1, Settings ? Settings->PipelineMaxPendingSaves : 8);
+
+    FMWCS_BuildOptions Options;
+    Options.bAsyncSave = true;
+    int32 PendingSaves = 0;
+
+    auto BuildWithBoundedSaves = [&](const FMWCS_WidgetSpec &Spec)
+    {
+        // Bound the async write queue so serialized packages do not pile up in memory.
+        if (PendingSaves >= MaxPendingSaves)
+        {
+            UPackage::WaitForAsyncFileWrites();
+            PendingSaves = 0;
+        }
+        FMWCS_WidgetBuilder::CreateOrUpdateFromSpec(Spec, Mode, Options, Report);
+        ++PendingSaves;
+    };
+
+    if (!Filter.IsEmpty())
+    {
+        // Selection needs every spec parsed (names, nested-widget dependents), so parse up front
+        // and keep only the build/save overlap.
+        TArray<FMWCS_WidgetSpec> Specs;
+        FMWCS_WidgetRegistry::CollectSpecs(Specs, Report);
+        Filter.Apply(Specs, Report);
+        FMWCS_Discovery::PrepareForSpecs(Specs, Report);
+        for (const FMWCS_WidgetSpec &Spec : Specs)
+        {
+            BuildWithBoundedSaves(Spec);
+        }
+        UPackage::WaitForAsyncFileWrites();
+        FMWCS_AssetIndex::Get().SaveIfDirty();
+        SaveReportJson(Report, TEXT("Build"));
+        return Report;
+    }
+
+    // Dependencies are only known once a spec is parsed, so each spec's packages are scanned just before its build.
+    FMWCS_DiscoveryStats Discovery;
+    FMWCS_Discovery::ScanRoots(Discovery);
+
+    // Providers are UObjects invoked through ProcessEvent, so fetching their JSON stays on the game thread.
+    TArray<FMWCS_SpecSource> Sources;
+    FMWCS_WidgetRegistry::CollectSpecSources(Sources, Report);
+
+    struct FParsedSpec
+    {
+        FMWCS_WidgetSpec Spec;
+        FMWCS_Report Report;
+        bool bParsed = false;
+    };
+    using FParsedSpecPtr = TSharedPtr<FParsedSpec, ESPMode::ThreadSafe>;
+
+    // Each parse writes into its own report; merging them in source order keeps the result
+    // independent of which worker finishes first.
+    TArray<TFuture<FParsedSpecPtr>> Parses;
+    Parses.SetNum(Sources.Num());
+    int32 NextToParse = 0;
+
+    for (int32 Index = 0; Index < Sources.Num(); ++Index)
+    {
+        // Keep at most ParseAhead specs parsed (or parsing) beyond the one being built.
+        while (NextToParse < Sources.Num() && NextToParse <= Index + ParseAhead)
+        {
+            Parses[NextToParse] = Async(EAsyncExecution::ThreadPool, [Source = MoveTemp(Sources[NextToParse])]()
+            {
+                FParsedSpecPtr Parsed = MakeShared<FParsedSpec, ESPMode::ThreadSafe>();
+                Parsed->bParsed = FMWCS_SpecParser::ParseSpecSource(Source, Parsed->Spec, Parsed->Report);
+                return Parsed;
+            });
+            ++NextToParse;
+        }
+
+        FParsedSpecPtr Parsed = Parses[Index].Get();
+        Parses[Index].Reset();
+
+        Report.Issues.Append(MoveTemp(Parsed->Report.Issues));
+        if (!Parsed->bParsed)
+        {
+            continue;
+        }
+        Report.SpecsProcessed++;
+
+        FMWCS_Discovery::ScanSpec(Parsed->Spec, Discovery);
+        BuildWithBoundedSaves(Parsed->Spec);
+    }
+
+    UPackage::WaitForAsyncFileWrites();
+    FMWCS_Discovery::AddReportEntry(Discovery, Report);
+
+    FMWCS_AssetIndex::Get().SaveIfDirty();
     SaveReportJson(Report, TEXT("Build"));
     return Report;
 }
 
+FMWCS_Report FMWCS_Service::BuildAndValidateAll(EMWCS_BuildMode Mode, const FMWCS_SpecFilter &Filter)
+{
+    FMWCS_Report Report;
+    TArray<FMWCS_WidgetSpec> Specs;
+    FMWCS_WidgetRegistry::CollectSpecs(Specs, Report);
+    Filter.Apply(Specs, Report);
+    FMWCS_Discovery::PrepareForSpecs(Specs, Report);
+    for (const FMWCS_WidgetSpec &Spec : Specs)
+    {
+        UWidgetBlueprint *Blueprint = nullptr;
+        if (!FMWCS_WidgetBuilder::CreateOrUpdateFromSpec(Spec, Mode, FMWCS_BuildOptions(), Report, &Blueprint))
+        {
+            // Build errors already explain why; validating a half-built asset would only repeat them.
+            continue;
+        }
+        if (Blueprint)
+        {
+            FMWCS_WidgetValidator::ValidateBlueprint(Spec, Blueprint, Report);
+        }
+    }
+    MWCS_RunValidateLint(Specs, Report);
+    FMWCS_AssetIndex::Get().SaveIfDirty();
+    SaveReportJson(Report, TEXT("BuildValidate"));
+    return Report;
+}
+
+FMWCS_Plan FMWCS_Service::PlanAll(const FMWCS_SpecFilter &Filter)
+{
+    FMWCS_Plan Plan;
+    TArray<FMWCS_WidgetSpec> Specs;
+    FMWCS_WidgetRegistry::CollectSpecs(Specs, Plan.Report);
+    Filter.Apply(Specs, Plan.Report);
+    FMWCS_Discovery::PrepareForSpecs(Specs, Plan.Report);
+    Plan.Entries.Reserve(Specs.Num());
+    for (const FMWCS_WidgetSpec &Spec : Specs)
+    {
+        FMWCS_WidgetPlanner::PlanSpec(Spec, Plan.Entries.AddDefaulted_GetRef(), Plan.Report);
+    }
+    SavePlanJson(Plan);
+    SaveReportJson(Plan.Report, TEXT("Plan"));
+    return Plan;
+}
+
+TSharedPtr<FMWCS_AsyncRun> FMWCS_Service::StartRun(const FString &Label, const FMWCS_SpecFilter &Filter, FMWCS_AsyncRun::FStepFunction &&Step)
+{
+    if (ActiveRun.IsValid())
+    {
+        return nullptr;
+    }
+
+    // Collecting and parsing specs is cheap next to building them, so it happens up front.
+    FMWCS_Report Report;
+    TArray<FMWCS_WidgetSpec> Specs;
+    FMWCS_WidgetRegistry::CollectSpecs(Specs, Report);
+    Filter.Apply(Specs, Report);
+    FMWCS_Discovery::PrepareForSpecs(Specs, Report);
+
+    ActiveRun = MakeShared<FMWCS_AsyncRun>(Label, MoveTemp(Specs), MoveTemp(Report), MoveTemp(Step));
+    ActiveRun->Start();
+    return ActiveRun;
+}
+
+TSharedPtr<FMWCS_AsyncRun> FMWCS_Service::StartValidateAll(const FMWCS_SpecFilter &Filter)
+{
+    return StartRun(TEXT("Validate"), Filter, [](const FMWCS_WidgetSpec &Spec, FMWCS_Report &Report)
+    {
+        FMWCS_WidgetValidator::ValidateSpecAsset(Spec, Report);
+        MWCS_RunValidateLint(MakeArrayView(&Spec, 1), Report);
+    });
+}
+
+TSharedPtr<FMWCS_AsyncRun> FMWCS_Service::StartBuildAll(EMWCS_BuildMode Mode, const FMWCS_SpecFilter &Filter)
+{
+    return StartRun(TEXT("Build"), Filter, [Mode](const FMWCS_WidgetSpec &Spec, FMWCS_Report &Report)
+    {
+        FMWCS_WidgetBuilder::CreateOrUpdateFromSpec(Spec, Mode, Report);
+    });
+}
+
 FMWCS_Report FMWCS_Service::GenerateOrRepairToolEuw()
 {
     FMWCS_Report Report;
@@ -109,6 +396,7 @@ FMWCS_Report FMWCS_Service::GenerateOrRepairToolEuw()
     }
 
     FMWCS_WidgetBuilder::CreateOrUpdateToolEuwFromSpec(ToolSpec, EMWCS_BuildMode::Repair, Report);
+    FMWCS_AssetIndex::Get().SaveIfDirty();
     SaveReportJson(Report, TEXT("ToolEUW"));
     return Report;
 }
@@ -193,6 +481,7 @@ FMWCS_Report FMWCS_Service::GenerateOrRepairExternalToolEuw(const FString& ToolN
         Config->AssetName, 
         EMWCS_BuildMode::Repair, 
         Report);
+    FMWCS_AssetIndex::Get().SaveIfDirty();
     SaveReportJson(Report, ReportLabel);
     return Report;
 }
@@ -4,6 +4,7 @@
 
 UMWCS_Settings::UMWCS_Settings()
 {
+    bScopedDiscoveryInCommandlets = true;
     OutputRootPath = TEXT("/Game/UI/Widgets");
     ToolEuwOutputPath = TEXT("/Game/Editor/MWCS");
     ToolEuwAssetName = TEXT("EUW_MWCS_Tool");
@@ -11,6 +12,21 @@ UMWCS_Settings::UMWCS_Settings()
 
     DesignerZoomLevelMin = 0;
     DesignerZoomLevelMax = 20;
+
+    // Same defaults as MWCS_Core::FPerfLintOptions (mwcslint -Perf).
+    bPerfLintInValidateAll = true;
+    PerfLintDepth = FMWCS_PerfLintRule(EMWCS_LintSeverity::Warning, 16);
+    PerfLintWidgetCount = FMWCS_PerfLintRule(EMWCS_LintSeverity::Warning, 500);
+    PerfLintCanvasChildren = FMWCS_PerfLintRule(EMWCS_LintSeverity::Warning, 32);
+    PerfLintVariableCount = FMWCS_PerfLintRule(EMWCS_LintSeverity::Warning, 48);
+    PerfLintHitTestable = FMWCS_PerfLintRule(EMWCS_LintSeverity::Info, 0);
+
+    PipelineParseAhead = 2;
+    PipelineMaxPendingSaves = 8;
+
+    AsyncTimeSliceMs = 30;
+    bHotReloadSpecFiles = true;
+    HotReloadDebounceSeconds = 0.25f;
 }
 
 const UMWCS_Settings *UMWCS_Settings::Get()
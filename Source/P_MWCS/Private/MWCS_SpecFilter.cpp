@@ -0,0 +1,276 @@
+#include "MWCS_SpecFilter.h"
+
+#include "MWCS_Settings.h"
+#include "MWCS_SpecGraph.h"
+
+#include "MWCS_Utilities.h"
+using namespace MWCS_Utilities;
+
+#include "Misc/FileHelper.h"
+#include "Misc/Parse.h"
+#include "Misc/Paths.h"
+#include "SourceCodeNavigation.h"
+
+static void MWCS_ParseGlobList(const FString &Params, const TCHAR *Key, TArray<FString> &Out)
+{
+    FString Value;
+    if (FParse::Value(*Params, Key, Value, /*bShouldStopOnSeparator*/ false))
+    {
+        TArray<FString> Parts;
+        Value.TrimQuotes().ParseIntoArray(Parts, TEXT(","), /*bCullEmpty*/ true);
+        for (FString &Part : Parts)
+        {
+            Part.TrimStartAndEndInline();
+            if (!Part.IsEmpty())
+            {
+                Out.Add(MoveTemp(Part));
+            }
+        }
+    }
+}
+
+static bool MWCS_MatchesAnyGlob(const FString &Value, const TArray<FString> &Globs)
+{
+    for (const FString &Glob : Globs)
+    {
+        if (Value.MatchesWildcard(Glob, ESearchCase::IgnoreCase))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+static FString MWCS_NormalizeFilePath(const FString &Path)
+{
+    FString Full = FPaths::IsRelative(Path) ? FPaths::ConvertRelativePathToFull(FPaths::ProjectDir(), Path) : FPaths::ConvertRelativePathToFull(Path);
+    FPaths::NormalizeFilename(Full);
+    FPaths::CollapseRelativeDirectories(Full);
+    return Full.ToLower();
+}
+
+// Lookup keys a changed file can hit. Keys are prefixed by kind so a header basename never matches a package.
+static void MWCS_KeysForChangedFile(const FString &ChangedFile, TArray<FString> &OutKeys)
+{
+    const FString Full = MWCS_NormalizeFilePath(ChangedFile);
+    const FString Ext = FPaths::GetExtension(ChangedFile).ToLower();
+    const FString Base = FPaths::GetBaseFilename(ChangedFile).ToLower();
+
+    OutKeys.Add(TEXT("file:") + Full);
+    if (Ext == TEXT("h") || Ext == TEXT("hpp") || Ext == TEXT("cpp") || Ext == TEXT("inl"))
+    {
+        OutKeys.Add(TEXT("src:") + Base);
+    }
+    else if (Ext == TEXT("json"))
+    {
+        OutKeys.Add(TEXT("json:") + Base);
+    }
+    else if (Ext == TEXT("uasset") || Ext == TEXT("umap"))
+    {
+        FString PackageName;
+        if (FPackageName::TryConvertFilenameToLongPackageName(FPaths::ConvertRelativePathToFull(FPaths::ProjectDir(), ChangedFile), PackageName))
+        {
+            OutKeys.Add(TEXT("pkg:") + PackageName.ToLower());
+        }
+    }
+}
+
+static void MWCS_KeysForSpec(const FMWCS_WidgetSpec &Spec, const FString &OutputRootPath, TSet<FString> &OutKeys)
+{
+    const FString Name = Spec.BlueprintName.ToString();
+    OutKeys.Add(TEXT("json:") + Name.ToLower());
+    OutKeys.Add(FString::Printf(TEXT("pkg:%s/%s"), *OutputRootPath, *Name).ToLower());
+
+    for (const FString &Dep : Spec.Dependencies)
+    {
+        if (!Dep.IsEmpty())
+        {
+            OutKeys.Add(TEXT("pkg:") + FPackageName::ObjectPathToPackageName(Dep).ToLower());
+        }
+    }
+
+    if (Spec.ProviderPath.IsEmpty())
+    {
+        return;
+    }
+
+    // File-backed specs carry their file path as provider path.
+    if (FPaths::FileExists(Spec.ProviderPath))
+    {
+        OutKeys.Add(TEXT("file:") + MWCS_NormalizeFilePath(Spec.ProviderPath));
+        return;
+    }
+
+    if (Spec.ProviderPath.StartsWith(TEXT("/Script/")))
+    {
+        // Native provider: match by class name (MyModule.MySpecProvider -> MySpecProvider.h/.cpp)
+        // and by the actual header/source files when source navigation knows them.
+        FString ClassName;
+        Spec.ProviderPath.Split(TEXT("."), nullptr, &ClassName, ESearchCase::CaseSensitive, ESearchDir::FromEnd);
+        OutKeys.Add(TEXT("src:") + ClassName.ToLower());
+
+        if (const UClass *ProviderClass = FSoftClassPath(Spec.ProviderPath).ResolveClass())
+        {
+            FString SourcePath;
+            if (FSourceCodeNavigation::FindClassHeaderPath(ProviderClass, SourcePath))
+            {
+                OutKeys.Add(TEXT("file:") + MWCS_NormalizeFilePath(SourcePath));
+            }
+            if (FSourceCodeNavigation::FindClassSourcePath(ProviderClass, SourcePath))
+            {
+                OutKeys.Add(TEXT("file:") + MWCS_NormalizeFilePath(SourcePath));
+            }
+        }
+    }
+    else
+    {
+        // Blueprint provider: the provider asset itself.
+        OutKeys.Add(TEXT("pkg:") + FPackageName::ObjectPathToPackageName(Spec.ProviderPath).ToLower());
+    }
+}
+
+bool FMWCS_SpecFilter::IsEmpty() const
+{
+    return NameGlobs.Num() == 0 && ProviderGlobs.Num() == 0 && !bUseChangedFiles && ShardCount <= 0;
+}
+
+bool FMWCS_SpecFilter::FromParams(const FString &Params, FMWCS_SpecFilter &OutFilter, FMWCS_Report &InOutReport)
+{
+    OutFilter = FMWCS_SpecFilter();
+    MWCS_ParseGlobList(Params, TEXT("-Only="), OutFilter.NameGlobs);
+    MWCS_ParseGlobList(Params, TEXT("-Provider="), OutFilter.ProviderGlobs);
+
+    FString ListPath;
+    if (FParse::Value(*Params, TEXT("-ChangedFiles="), ListPath))
+    {
+        OutFilter.bUseChangedFiles = true;
+
+        TArray<FString> Lines;
+        if (!FFileHelper::LoadFileToStringArray(Lines, *ListPath))
+        {
+            AddIssue(InOutReport, EMWCS_IssueSeverity::Error, TEXT("Filter.ChangedFilesUnreadable"), TEXT("Failed to read the changed-files list."), ListPath);
+            return false;
+        }
+
+        for (FString &Line : Lines)
+        {
+            Line.TrimStartAndEndInline();
+            if (!Line.IsEmpty() && !Line.StartsWith(TEXT("#")))
+            {
+                OutFilter.ChangedFiles.Add(MoveTemp(Line));
+            }
+        }
+    }
+
+    FString Shard;
+    if (FParse::Value(*Params, TEXT("-Shard="), Shard))
+    {
+        FString IndexStr;
+        FString CountStr;
+        const bool bSplit = Shard.Split(TEXT("/"), &IndexStr, &CountStr);
+        const int32 Index = bSplit && IndexStr.IsNumeric() ? FCString::Atoi(*IndexStr) : -1;
+        const int32 Count = bSplit && CountStr.IsNumeric() ? FCString::Atoi(*CountStr) : 0;
+        if (Count <= 0 || Index < 0 || Index >= Count)
+        {
+            AddIssue(InOutReport, EMWCS_IssueSeverity::Error, TEXT("Filter.InvalidShard"), TEXT("Expected -Shard=<Index>/<Count> with 0 <= Index < Count."), Shard);
+            return false;
+        }
+        OutFilter.ShardIndex = Index;
+        OutFilter.ShardCount = Count;
+    }
+
+    return true;
+}
+
+void FMWCS_SpecFilter::Apply(TArray<FMWCS_WidgetSpec> &InOutSpecs, FMWCS_Report &InOutReport) const
+{
+    if (IsEmpty())
+    {
+        return;
+    }
+
+    const UMWCS_Settings *Settings = UMWCS_Settings::Get();
+    FString OutputRoot;
+    EnsureValidPackagePath(Settings ? Settings->OutputRootPath : FString(), OutputRoot);
+
+    const int32 Total = InOutSpecs.Num();
+    TArray<bool> Keep;
+    Keep.Init(true, Total);
+
+    for (int32 Index = 0; Index < Total; ++Index)
+    {
+        const FMWCS_WidgetSpec &Spec = InOutSpecs[Index];
+        if (NameGlobs.Num() > 0 && !MWCS_MatchesAnyGlob(Spec.BlueprintName.ToString(), NameGlobs))
+        {
+            Keep[Index] = false;
+        }
+        else if (ProviderGlobs.Num() > 0 && !MWCS_MatchesAnyGlob(Spec.ProviderPath, ProviderGlobs))
+        {
+            Keep[Index] = false;
+        }
+    }
+
+    if (bUseChangedFiles)
+    {
+        TSet<FString> ChangedKeys;
+        TArray<FString> Keys;
+        for (const FString &File : ChangedFiles)
+        {
+            Keys.Reset();
+            MWCS_KeysForChangedFile(File, Keys);
+            ChangedKeys.Append(Keys);
+        }
+
+        TSet<int32> Touched;
+        for (int32 Index = 0; Index < Total; ++Index)
+        {
+            TSet<FString> SpecKeys;
+            MWCS_KeysForSpec(InOutSpecs[Index], OutputRoot, SpecKeys);
+            if (SpecKeys.Intersect(ChangedKeys).Num() > 0)
+            {
+                Touched.Add(Index);
+            }
+        }
+
+        FMWCS_SpecGraph Graph;
+        Graph.Build(InOutSpecs, OutputRoot);
+        Graph.ExpandDependents(Touched);
+
+        for (int32 Index = 0; Index < Total; ++Index)
+        {
+            Keep[Index] = Keep[Index] && Touched.Contains(Index);
+        }
+    }
+
+    TArray<FMWCS_WidgetSpec> Selected;
+    for (int32 Index = 0; Index < Total; ++Index)
+    {
+        if (Keep[Index])
+        {
+            Selected.Add(MoveTemp(InOutSpecs[Index]));
+        }
+    }
+    InOutSpecs = MoveTemp(Selected);
+
+    if (ShardCount > 0)
+    {
+        // Every worker sees the same selection, so they all compute the same partition.
+        FMWCS_SpecGraph Graph;
+        Graph.Build(InOutSpecs, OutputRoot);
+        TArray<TArray<int32>> Shards;
+        Graph.Partition(ShardCount, Shards);
+
+        TArray<FMWCS_WidgetSpec> ShardSpecs;
+        ShardSpecs.Reserve(Shards[ShardIndex].Num());
+        for (const int32 Index : Shards[ShardIndex])
+        {
+            ShardSpecs.Add(MoveTemp(InOutSpecs[Index]));
+        }
+        InOutSpecs = MoveTemp(ShardSpecs);
+    }
+
+    InOutReport.SpecsProcessed = InOutSpecs.Num();
+
+    const FString Label = ShardCount > 0 ? FString::Printf(TEXT("Shard %d/%d"), ShardIndex, ShardCount) : FString(TEXT("Filter"));
+    AddIssue(InOutReport, EMWCS_IssueSeverity::Info, TEXT("Filter.Selected"), FString::Printf(TEXT("Selected %d of %d spec(s)."), InOutSpecs.Num(), Total), Label);
+}
@@ -0,0 +1,452 @@
+#include "MWCS_SpecGenerator.h"
+
+#include "MWCS_CanonicalJson.h"
+
+#include "HAL/FileManager.h"
+#include "Math/RandomStream.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+#include "MWCS_Utilities.h"
+
+using namespace MWCS_Utilities;
+
+// Listed in Dependencies by every spec that has a TextBlock (the Design entries set its size and typeface).
+static const TCHAR *GMWCS_GeneratorFontPath = TEXT("/Engine/EngineFonts/Roboto.Roboto");
+
+enum class EMWCS_GenKind : uint8
+{
+    CanvasPanel,
+    VerticalBox,
+    HorizontalBox,
+    Overlay,
+    Button,
+    TextBlock,
+    UserWidget,
+};
+
+struct FMWCS_GenColor
+{
+    double R = 1.0;
+    double G = 1.0;
+    double B = 1.0;
+    double A = 1.0;
+};
+
+// Design entries are written after the hierarchy, so they are recorded while the tree is generated.
+struct FMWCS_GenDesign
+{
+    FString Name;
+    bool bButton = false;
+    int32 FontSize = 0;
+    bool bBold = false;
+    bool bFocusable = false;
+    FMWCS_GenColor Colors[3]; // TextBlock: [0]; Button: Normal, Hovered, Pressed
+};
+
+struct FMWCS_GenContext
+{
+    const FMWCS_SpecGeneratorOptions &Options;
+    FRandomStream Stream;
+    int32 SpecIndex = 0;
+    int32 NextId = 0;
+    FMWCS_CanonicalJsonWriter Writer;
+    TArray<FMWCS_GenDesign> Design;
+    TArray<FString> Dependencies;
+    FMWCS_GeneratedSpec Result;
+
+    FMWCS_GenContext(const FMWCS_SpecGeneratorOptions &InOptions, int32 InSpecIndex)
+        : Options(InOptions), Stream(InOptions.Seed * 7919 + InSpecIndex), SpecIndex(InSpecIndex)
+    {
+    }
+
+    // Two decimals keep the canonical numbers short and stable.
+    double Unit()
+    {
+        return FMath::RoundToDouble(Stream.FRand() * 100.0) / 100.0;
+    }
+
+    FMWCS_GenColor Color()
+    {
+        FMWCS_GenColor Out;
+        Out.R = Unit();
+        Out.G = Unit();
+        Out.B = Unit();
+        return Out;
+    }
+};
+
+static FString MWCS_GeneratedName(const FMWCS_SpecGeneratorOptions &Options, int32 Index)
+{
+    return FString::Printf(TEXT("%s%04d"), *Options.NamePrefix, Index);
+}
+
+// Index into Weights, or INDEX_NONE when every weight is zero.
+static int32 MWCS_PickWeighted(FRandomStream &Stream, const TArray<float, TInlineAllocator<8>> &Weights)
+{
+    float Total = 0.0f;
+    for (const float Weight : Weights)
+    {
+        Total += FMath::Max(0.0f, Weight);
+    }
+    if (Total <= 0.0f)
+    {
+        return INDEX_NONE;
+    }
+
+    float Roll = Stream.FRand() * Total;
+    for (int32 Index = 0; Index < Weights.Num(); ++Index)
+    {
+        Roll -= FMath::Max(0.0f, Weights[Index]);
+        if (Roll < 0.0f)
+        {
+            return Index;
+        }
+    }
+    return Weights.Num() - 1;
+}
+
+static EMWCS_GenKind MWCS_PickKind(FMWCS_GenContext &Ctx, int32 Budget, EMWCS_GenKind ParentKind)
+{
+    const FMWCS_SpecGeneratorMix &Mix = Ctx.Options.Mix;
+    if (Budget <= 1)
+    {
+        // Nothing to nest in the first spec.
+        const float UserWidgetWeight = Ctx.SpecIndex > 0 ? Mix.UserWidget : 0.0f;
+        return MWCS_PickWeighted(Ctx.Stream, {Mix.TextBlock, UserWidgetWeight}) == 1 ? EMWCS_GenKind::UserWidget : EMWCS_GenKind::TextBlock;
+    }
+
+    // No Button directly inside a Button, which bounds the depth of single-child chains.
+    const float ButtonWeight = ParentKind == EMWCS_GenKind::Button ? 0.0f : Mix.Button;
+    switch (MWCS_PickWeighted(Ctx.Stream, {Mix.CanvasPanel, Mix.Box, Mix.Overlay, ButtonWeight}))
+    {
+    case 0:
+        return EMWCS_GenKind::CanvasPanel;
+    case 2:
+        return EMWCS_GenKind::Overlay;
+    case 3:
+        return EMWCS_GenKind::Button;
+    default:
+        return Ctx.Stream.FRand() < 0.5f ? EMWCS_GenKind::VerticalBox : EMWCS_GenKind::HorizontalBox;
+    }
+}
+
+static void MWCS_WriteMargin(FMWCS_CanonicalJsonWriter &Writer, const TCHAR *Key, double L, double T, double R, double B)
+{
+    Writer.BeginArray(Key);
+    Writer.WriteElement(L);
+    Writer.WriteElement(T);
+    Writer.WriteElement(R);
+    Writer.WriteElement(B);
+    Writer.EndArray();
+}
+
+static void MWCS_WriteSlot(FMWCS_GenContext &Ctx, EMWCS_GenKind ParentKind, int32 ChildIndex)
+{
+    static const TCHAR *HAligns[] = {TEXT("Fill"), TEXT("Left"), TEXT("Center"), TEXT("Right")};
+    static const TCHAR *VAligns[] = {TEXT("Fill"), TEXT("Top"), TEXT("Center"), TEXT("Bottom")};
+
+    FMWCS_CanonicalJsonWriter &Writer = Ctx.Writer;
+    FRandomStream &Stream = Ctx.Stream;
+    Writer.BeginObject(TEXT("Slot"));
+    switch (ParentKind)
+    {
+    case EMWCS_GenKind::CanvasPanel:
+    {
+        Writer.BeginObject(TEXT("Canvas"));
+        Writer.BeginObject(TEXT("Anchors"));
+        const bool bStretch = Stream.FRand() < 0.25f;
+        Writer.BeginArray(TEXT("Min"));
+        Writer.WriteElement(0.0);
+        Writer.WriteElement(0.0);
+        Writer.EndArray();
+        Writer.BeginArray(TEXT("Max"));
+        Writer.WriteElement(bStretch ? 1.0 : 0.0);
+        Writer.WriteElement(bStretch ? 1.0 : 0.0);
+        Writer.EndArray();
+        Writer.EndObject();
+        MWCS_WriteMargin(Writer, TEXT("Offsets"), Stream.RandRange(0, 64) * 8, Stream.RandRange(0, 64) * 8, Stream.RandRange(4, 40) * 8, Stream.RandRange(2, 20) * 8);
+        Writer.Write(TEXT("ZOrder"), ChildIndex);
+        Writer.EndObject();
+        break;
+    }
+    case EMWCS_GenKind::VerticalBox:
+    case EMWCS_GenKind::HorizontalBox:
+    {
+        const double Pad = Stream.RandRange(0, 4) * 2;
+        MWCS_WriteMargin(Writer, TEXT("Padding"), Pad, Pad, Pad, Pad);
+        Writer.Write(TEXT("HAlign"), HAligns[Stream.RandRange(0, 3)]);
+        if (Stream.FRand() < 0.5f)
+        {
+            Writer.Write(TEXT("Fill"), static_cast<double>(Stream.RandRange(1, 3)));
+        }
+        else
+        {
+            Writer.BeginObject(TEXT("Size"));
+            Writer.Write(TEXT("Rule"), TEXT("Auto"));
+            Writer.EndObject();
+        }
+        break;
+    }
+    default: // Overlay and Button
+    {
+        const double Pad = Stream.RandRange(0, 4) * 2;
+        MWCS_WriteMargin(Writer, TEXT("Padding"), Pad, Pad, Pad, Pad);
+        Writer.Write(TEXT("HAlign"), HAligns[Stream.RandRange(0, 3)]);
+        Writer.Write(TEXT("VAlign"), VAligns[Stream.RandRange(0, 3)]);
+        break;
+    }
+    }
+    Writer.EndObject();
+}
+
+// Writes a subtree of exactly Budget nodes as an element of the current Children array (or as Root).
+static void MWCS_WriteNode(FMWCS_GenContext &Ctx, int32 Budget, EMWCS_GenKind ParentKind, int32 ChildIndex, bool bRoot)
+{
+    FMWCS_CanonicalJsonWriter &Writer = Ctx.Writer;
+    FRandomStream &Stream = Ctx.Stream;
+    const int32 Id = Ctx.NextId++;
+    ++Ctx.Result.NumNodes;
+
+    const EMWCS_GenKind Kind = bRoot ? EMWCS_GenKind::CanvasPanel : MWCS_PickKind(Ctx, Budget, ParentKind);
+
+    if (bRoot)
+    {
+        Writer.BeginObject(TEXT("Root"));
+    }
+    else
+    {
+        Writer.BeginObject();
+        MWCS_WriteSlot(Ctx, ParentKind, ChildIndex);
+    }
+
+    switch (Kind)
+    {
+    case EMWCS_GenKind::TextBlock:
+    {
+        const FString Name = FString::Printf(TEXT("Text_%d"), Id);
+        Writer.Write(TEXT("Type"), TEXT("TextBlock"));
+        Writer.Write(TEXT("Name"), Name);
+        Writer.Write(TEXT("Text"), FString::Printf(TEXT("Label %d"), Id));
+        if (Stream.FRand() < 0.3f)
+        {
+            static const TCHAR *Justifications[] = {TEXT("Left"), TEXT("Center"), TEXT("Right")};
+            Writer.Write(TEXT("Justification"), Justifications[Stream.RandRange(0, 2)]);
+        }
+
+        FMWCS_GenDesign &Design = Ctx.Design.AddDefaulted_GetRef();
+        Design.Name = Name;
+        Design.FontSize = Stream.RandRange(10, 32);
+        Design.bBold = Stream.FRand() < 0.3f;
+        Design.Colors[0] = Ctx.Color();
+        Ctx.Dependencies.AddUnique(GMWCS_GeneratorFontPath);
+        break;
+    }
+    case EMWCS_GenKind::UserWidget:
+    {
+        const FString Target = MWCS_GeneratedName(Ctx.Options, Stream.RandRange(0, Ctx.SpecIndex - 1));
+        Writer.Write(TEXT("Type"), TEXT("UserWidget"));
+        Writer.Write(TEXT("Name"), FString::Printf(TEXT("Nested_%d"), Id));
+        Writer.Write(TEXT("WidgetClass"), FString::Printf(TEXT("%s/%s.%s_C"), *Ctx.Options.OutputRootPath, *Target, *Target));
+        Ctx.Dependencies.AddUnique(FString::Printf(TEXT("%s/%s.%s"), *Ctx.Options.OutputRootPath, *Target, *Target));
+        ++Ctx.Result.NumNested;
+        break;
+    }
+    case EMWCS_GenKind::Button:
+    {
+        const FString Name = FString::Printf(TEXT("Button_%d"), Id);
+        Writer.Write(TEXT("Type"), TEXT("Button"));
+        Writer.Write(TEXT("Name"), Name);
+
+        FMWCS_GenDesign &Design = Ctx.Design.AddDefaulted_GetRef();
+        Design.Name = Name;
+        Design.bButton = true;
+        Design.bFocusable = Stream.FRand() < 0.5f;
+        for (FMWCS_GenColor &Color : Design.Colors)
+        {
+            Color = Ctx.Color();
+        }
+
+        Writer.BeginArray(TEXT("Children"));
+        MWCS_WriteNode(Ctx, Budget - 1, Kind, 0, false);
+        Writer.EndArray();
+        break;
+    }
+    default:
+    {
+        static const TCHAR *TypeNames[] = {TEXT("CanvasPanel"), TEXT("VerticalBox"), TEXT("HorizontalBox"), TEXT("Overlay")};
+        const TCHAR *TypeName = TypeNames[static_cast<int32>(Kind)];
+        Writer.Write(TEXT("Type"), TypeName);
+        Writer.Write(TEXT("Name"), bRoot ? FString(TEXT("Root")) : FString::Printf(TEXT("%s_%d"), TypeName, Id));
+
+        // Split the remaining nodes between the children at random cut points, each child getting at least one.
+        const int32 Remaining = Budget - 1;
+        if (Remaining > 0)
+        {
+            const int32 NumChildren = Stream.RandRange(FMath::Min(2, Remaining), FMath::Min(FMath::Max(1, Ctx.Options.MaxChildren), Remaining));
+            const int32 Spare = Remaining - NumChildren;
+            TArray<int32, TInlineAllocator<16>> Cuts;
+            for (int32 Cut = 1; Cut < NumChildren; ++Cut)
+            {
+                Cuts.Add(Stream.RandRange(0, Spare));
+            }
+            Cuts.Sort();
+            Cuts.Add(Spare);
+
+            Writer.BeginArray(TEXT("Children"));
+            int32 Previous = 0;
+            for (int32 Child = 0; Child < NumChildren; ++Child)
+            {
+                MWCS_WriteNode(Ctx, 1 + Cuts[Child] - Previous, Kind, Child, false);
+                Previous = Cuts[Child];
+            }
+            Writer.EndArray();
+        }
+        break;
+    }
+    }
+
+    Writer.EndObject();
+}
+
+static void MWCS_WriteColor(FMWCS_CanonicalJsonWriter &Writer, const TCHAR *Key, const FMWCS_GenColor &Color)
+{
+    Writer.BeginObject(Key);
+    Writer.Write(TEXT("R"), Color.R);
+    Writer.Write(TEXT("G"), Color.G);
+    Writer.Write(TEXT("B"), Color.B);
+    Writer.Write(TEXT("A"), Color.A);
+    Writer.EndObject();
+}
+
+static FMWCS_GeneratedSpec MWCS_GenerateSpec(const FMWCS_SpecGeneratorOptions &Options, int32 SpecIndex)
+{
+    FMWCS_GenContext Ctx(Options, SpecIndex);
+    FMWCS_CanonicalJsonWriter &Writer = Ctx.Writer;
+    const FString Name = MWCS_GeneratedName(Options, SpecIndex);
+    Ctx.Result.BlueprintName = FName(*Name);
+
+    Writer.BeginObject();
+    Writer.Write(TEXT("BlueprintName"), Name);
+    Writer.Write(TEXT("ParentClass"), TEXT("/Script/UMG.UserWidget"));
+    Writer.Write(TEXT("Version"), TEXT("1.0.0"));
+
+    Writer.BeginObject(TEXT("Hierarchy"));
+    MWCS_WriteNode(Ctx, FMath::Max(1, Options.NodesPerSpec), EMWCS_GenKind::CanvasPanel, 0, true);
+    Writer.EndObject();
+
+    Writer.BeginObject(TEXT("Design"));
+    for (const FMWCS_GenDesign &Design : Ctx.Design)
+    {
+        Writer.BeginObject(Design.Name);
+        if (Design.bButton)
+        {
+            Writer.Write(TEXT("IsFocusable"), Design.bFocusable);
+            Writer.BeginObject(TEXT("Style"));
+            const TCHAR *States[] = {TEXT("Normal"), TEXT("Hovered"), TEXT("Pressed")};
+            for (int32 State = 0; State < 3; ++State)
+            {
+                Writer.BeginObject(States[State]);
+                MWCS_WriteColor(Writer, TEXT("TintColor"), Design.Colors[State]);
+                Writer.EndObject();
+            }
+            Writer.EndObject();
+        }
+        else
+        {
+            Writer.BeginObject(TEXT("Font"));
+            Writer.Write(TEXT("Size"), Design.FontSize);
+            Writer.Write(TEXT("Typeface"), Design.bBold ? TEXT("Bold") : TEXT("Regular"));
+            Writer.EndObject();
+            MWCS_WriteColor(Writer, TEXT("ColorAndOpacity"), Design.Colors[0]);
+        }
+        Writer.EndObject();
+    }
+    Writer.EndObject(true);
+
+    Ctx.Dependencies.Sort();
+    Writer.BeginArray(TEXT("Dependencies"));
+    for (const FString &Dependency : Ctx.Dependencies)
+    {
+        Writer.WriteElement(Dependency);
+    }
+    Writer.EndArray(true);
+
+    Writer.BeginObject(TEXT("Bindings"));
+    Writer.BeginArray(TEXT("Required"));
+    Writer.EndArray();
+    Writer.BeginArray(TEXT("Optional"));
+    Writer.EndArray();
+    Writer.EndObject();
+
+    Writer.EndObject();
+    Ctx.Result.Json = Writer.GetOutput();
+    return MoveTemp(Ctx.Result);
+}
+
+void FMWCS_SpecGenerator::Generate(const FMWCS_SpecGeneratorOptions &Options, TArray<FMWCS_GeneratedSpec> &OutSpecs)
+{
+    OutSpecs.Reset(Options.NumSpecs);
+    for (int32 Index = 0; Index < Options.NumSpecs; ++Index)
+    {
+        OutSpecs.Add(MWCS_GenerateSpec(Options, Index));
+    }
+}
+
+// Written into every corpus directory; WriteCorpus only deletes files from directories that carry it.
+static const TCHAR *GMWCS_CorpusMarkerName = TEXT(".mwcs_generated");
+
+bool FMWCS_SpecGenerator::WriteCorpus(const FMWCS_SpecGeneratorOptions &Options, const FString &Directory, FMWCS_Report &InOutReport)
+{
+    IFileManager &FileManager = IFileManager::Get();
+    const FString MarkerPath = FPaths::Combine(Directory, GMWCS_CorpusMarkerName);
+
+    // Only clean up after ourselves: a directory with JSON files that this generator did not create (e.g. a spec
+    // directory passed as -Corpus by mistake) is left untouched.
+    TArray<FString> Existing;
+    FileManager.FindFiles(Existing, *FPaths::Combine(Directory, TEXT("*.json")), true, false);
+    if (Existing.Num() > 0 && !FileManager.FileExists(*MarkerPath))
+    {
+        AddIssue(InOutReport, EMWCS_IssueSeverity::Error, TEXT("Generator.UnsafeDirectory"),
+                 FString::Printf(TEXT("Directory has %d JSON file(s) and no %s marker, so it was not written by the generator. Use an empty directory."), Existing.Num(), GMWCS_CorpusMarkerName),
+                 Directory);
+        return false;
+    }
+
+    TArray<FString> Stale;
+    FileManager.FindFiles(Stale, *FPaths::Combine(Directory, Options.NamePrefix + TEXT("*.json")), true, false);
+    for (const FString &File : Stale)
+    {
+        FileManager.Delete(*FPaths::Combine(Directory, File));
+    }
+    FileManager.MakeDirectory(*Directory, true);
+    FFileHelper::SaveStringToFile(FString(), *MarkerPath);
+
+    TArray<FMWCS_GeneratedSpec> Specs;
+    Generate(Options, Specs);
+
+    bool bOk = true;
+    int64 TotalNodes = 0;
+    int32 TotalNested = 0;
+    for (const FMWCS_GeneratedSpec &Spec : Specs)
+    {
+        const FString Path = FPaths::Combine(Directory, Spec.BlueprintName.ToString() + TEXT(".json"));
+        if (!FFileHelper::SaveStringToFile(Spec.Json, *Path, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM))
+        {
+            AddIssue(InOutReport, EMWCS_IssueSeverity::Error, TEXT("Generator.WriteFailed"), TEXT("Failed to write generated spec."), Path);
+            bOk = false;
+        }
+        TotalNodes += Spec.NumNodes;
+        TotalNested += Spec.NumNested;
+    }
+
+    AddIssue(InOutReport, EMWCS_IssueSeverity::Info, TEXT("Generator.Summary"),
+             FString::Printf(TEXT("Generated %d spec(s), %lld widget(s), %d nested UserWidget(s) (seed %d)."), Specs.Num(), TotalNodes, TotalNested, Options.Seed),
+             Directory);
+    return bOk;
+}
+
+FString FMWCS_SpecGenerator::GetDefaultCorpusDir()
+{
+    return FPaths::ConvertRelativePathToFull(FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("MWCS"), TEXT("Benchmark"), TEXT("Specs")));
+}
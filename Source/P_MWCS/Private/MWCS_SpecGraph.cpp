@@ -0,0 +1,237 @@
+#include "MWCS_SpecGraph.h"
+
+#include "Algo/StableSort.h"
+
+static void MWCS_CollectNestedWidgetClasses(const FMWCS_HierarchyNode &Node, TSet<FString> &OutClassPaths)
+{
+    if (!Node.WidgetClassPath.IsEmpty())
+    {
+        OutClassPaths.Add(Node.WidgetClassPath.ToLower());
+    }
+    for (const FMWCS_HierarchyNode &Child : Node.Children)
+    {
+        MWCS_CollectNestedWidgetClasses(Child, OutClassPaths);
+    }
+}
+
+void FMWCS_SpecGraph::Build(const TArray<FMWCS_WidgetSpec> &Specs, const FString &OutputRootPath)
+{
+    Dependencies.Reset();
+    Dependents.Reset();
+    Dependencies.SetNum(Specs.Num());
+    Dependents.SetNum(Specs.Num());
+
+    // Generated class path (lower-cased) -> the spec that produces it. A native ParentClass is shared by unrelated
+    // specs and is never built here, so it is not a provider.
+    TMap<FString, int32> Providers;
+    for (int32 Index = 0; Index < Specs.Num(); ++Index)
+    {
+        const FString Name = Specs[Index].BlueprintName.ToString();
+        Providers.Add(FString::Printf(TEXT("%s/%s.%s_C"), *OutputRootPath, *Name, *Name).ToLower(), Index);
+    }
+
+    auto AddEdge = [this](int32 Index, int32 Dep)
+    {
+        if (Dep != Index)
+        {
+            Dependencies[Index].AddUnique(Dep);
+            Dependents[Dep].AddUnique(Index);
+        }
+    };
+
+    for (int32 Index = 0; Index < Specs.Num(); ++Index)
+    {
+        // Nested UserWidget nodes.
+        TSet<FString> Nested;
+        MWCS_CollectNestedWidgetClasses(Specs[Index].HierarchyRoot, Nested);
+        for (const FString &ClassPath : Nested)
+        {
+            if (const int32 *Dep = Providers.Find(ClassPath))
+            {
+                AddEdge(Index, *Dep);
+            }
+        }
+
+        // A spec deriving from another spec's generated class needs that class built first.
+        if (const int32 *Parent = Providers.Find(Specs[Index].ParentClassPath.ToLower()))
+        {
+            AddEdge(Index, *Parent);
+        }
+    }
+
+    // Keep traversal order independent of hash iteration order.
+    for (int32 Index = 0; Index < Specs.Num(); ++Index)
+    {
+        Dependencies[Index].Sort();
+        Dependents[Index].Sort();
+    }
+}
+
+void FMWCS_SpecGraph::ExpandDependents(TSet<int32> &InOutSelected) const
+{
+    TArray<int32> Stack = InOutSelected.Array();
+    while (Stack.Num() > 0)
+    {
+        const int32 Index = Stack.Pop();
+        for (const int32 Dependent : Dependents[Index])
+        {
+            if (!InOutSelected.Contains(Dependent))
+            {
+                InOutSelected.Add(Dependent);
+                Stack.Add(Dependent);
+            }
+        }
+    }
+}
+
+void FMWCS_SpecGraph::GetComponents(TArray<TArray<int32>> &OutComponents) const
+{
+    OutComponents.Reset();
+
+    TArray<bool> Visited;
+    Visited.Init(false, Num());
+    TArray<int32> Stack;
+
+    for (int32 Start = 0; Start < Num(); ++Start)
+    {
+        if (Visited[Start])
+        {
+            continue;
+        }
+
+        TArray<int32> &Component = OutComponents.AddDefaulted_GetRef();
+        Visited[Start] = true;
+        Stack.Add(Start);
+        while (Stack.Num() > 0)
+        {
+            const int32 Index = Stack.Pop();
+            Component.Add(Index);
+            auto Visit = [&Visited, &Stack](const TArray<int32> &Edges)
+            {
+                for (const int32 Next : Edges)
+                {
+                    if (!Visited[Next])
+                    {
+                        Visited[Next] = true;
+                        Stack.Add(Next);
+                    }
+                }
+            };
+            Visit(Dependencies[Index]);
+            Visit(Dependents[Index]);
+        }
+        Component.Sort();
+    }
+}
+
+void FMWCS_SpecGraph::SortDependenciesFirst(TArray<int32> &InOutIndices) const
+{
+    // Kahn's algorithm restricted to InOutIndices; the ready set is a min-heap on input position
+    // so unrelated specs keep their original relative order.
+    TMap<int32, int32> PositionOf;
+    for (int32 Pos = 0; Pos < InOutIndices.Num(); ++Pos)
+    {
+        PositionOf.Add(InOutIndices[Pos], Pos);
+    }
+
+    TArray<int32> InDegree;
+    InDegree.Init(0, InOutIndices.Num());
+    for (int32 Pos = 0; Pos < InOutIndices.Num(); ++Pos)
+    {
+        for (const int32 Dep : Dependencies[InOutIndices[Pos]])
+        {
+            if (PositionOf.Contains(Dep))
+            {
+                ++InDegree[Pos];
+            }
+        }
+    }
+
+    TArray<int32> Ready;
+    for (int32 Pos = 0; Pos < InOutIndices.Num(); ++Pos)
+    {
+        if (InDegree[Pos] == 0)
+        {
+            Ready.HeapPush(Pos);
+        }
+    }
+
+    TArray<bool> Emitted;
+    Emitted.Init(false, InOutIndices.Num());
+    TArray<int32> Sorted;
+    Sorted.Reserve(InOutIndices.Num());
+
+    while (Sorted.Num() < InOutIndices.Num())
+    {
+        if (Ready.Num() == 0)
+        {
+            // Cycle: release the earliest remaining spec and carry on.
+            for (int32 Pos = 0; Pos < InOutIndices.Num(); ++Pos)
+            {
+                if (!Emitted[Pos])
+                {
+                    InDegree[Pos] = 0;
+                    Ready.HeapPush(Pos);
+                    break;
+                }
+            }
+        }
+
+        int32 Pos = INDEX_NONE;
+        Ready.HeapPop(Pos);
+        if (Emitted[Pos])
+        {
+            continue;
+        }
+        Emitted[Pos] = true;
+        Sorted.Add(InOutIndices[Pos]);
+
+        for (const int32 Dependent : Dependents[InOutIndices[Pos]])
+        {
+            if (const int32 *DependentPos = PositionOf.Find(Dependent))
+            {
+                if (!Emitted[*DependentPos] && --InDegree[*DependentPos] == 0)
+                {
+                    Ready.HeapPush(*DependentPos);
+                }
+            }
+        }
+    }
+
+    InOutIndices = MoveTemp(Sorted);
+}
+
+void FMWCS_SpecGraph::Partition(int32 ShardCount, TArray<TArray<int32>> &OutShards) const
+{
+    OutShards.Reset();
+    if (ShardCount <= 0)
+    {
+        return;
+    }
+    OutShards.SetNum(ShardCount);
+
+    TArray<TArray<int32>> Components;
+    GetComponents(Components);
+
+    // Components are already ordered by smallest index, so a stable sort by size keeps ties deterministic.
+    Algo::StableSortBy(Components, [](const TArray<int32> &Component) { return -Component.Num(); });
+
+    for (const TArray<int32> &Component : Components)
+    {
+        int32 Lightest = 0;
+        for (int32 Shard = 1; Shard < ShardCount; ++Shard)
+        {
+            if (OutShards[Shard].Num() < OutShards[Lightest].Num())
+            {
+                Lightest = Shard;
+            }
+        }
+        OutShards[Lightest].Append(Component);
+    }
+
+    for (TArray<int32> &Shard : OutShards)
+    {
+        Shard.Sort();
+        SortDependenciesFirst(Shard);
+    }
+}
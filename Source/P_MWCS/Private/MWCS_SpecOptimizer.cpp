@@ -0,0 +1,132 @@
+#include "MWCS_SpecOptimizer.h"
+
+#include "MWCS_Settings.h"
+
+#include "Blueprint/UserWidget.h"
+#include "Components/Widget.h"
+#include "UObject/UnrealType.h"
+
+// Names the optimizer must keep: spec bindings, Design entries, and BindWidget/BindWidgetOptional properties of a native
+// ParentClass (the widget compiler binds those by name).
+static void MWCS_CollectReferencedNames(const FMWCS_WidgetSpec &Spec, TSet<FName> &OutNames)
+{
+    OutNames.Append(Spec.Bindings.Required);
+    OutNames.Append(Spec.Bindings.Optional);
+    for (const TPair<FName, FString> &Entry : Spec.Bindings.Types)
+    {
+        OutNames.Add(Entry.Key);
+    }
+    for (const TPair<FName, TSharedPtr<FJsonObject>> &Entry : Spec.Design)
+    {
+        OutNames.Add(Entry.Key);
+    }
+
+#if WITH_EDITORONLY_DATA
+    if (UClass *ParentClass = Spec.ParentClassPath.IsEmpty() ? nullptr : FSoftClassPath(Spec.ParentClassPath).TryLoadClass<UUserWidget>())
+    {
+        for (TFieldIterator<FObjectPropertyBase> It(ParentClass); It; ++It)
+        {
+            if (It->PropertyClass && It->PropertyClass->IsChildOf(UWidget::StaticClass()) &&
+                (It->HasMetaData(TEXT("BindWidget")) || It->HasMetaData(TEXT("BindWidgetOptional"))))
+            {
+                OutNames.Add(It->GetFName());
+            }
+        }
+    }
+#endif
+}
+
+// Slot metadata describes the node's slot in its parent, so a hoisted child takes the removed container's.
+static void MWCS_CopySlot(const FMWCS_HierarchyNode &From, FMWCS_HierarchyNode &To)
+{
+    To.bHasSlotPadding = From.bHasSlotPadding;
+    To.SlotPadding = From.SlotPadding;
+    To.bHasSlotHAlign = From.bHasSlotHAlign;
+    To.SlotHAlign = From.SlotHAlign;
+    To.bHasSlotVAlign = From.bHasSlotVAlign;
+    To.SlotVAlign = From.SlotVAlign;
+    To.bHasSlotSize = From.bHasSlotSize;
+    To.SlotSizeRule = From.SlotSizeRule;
+    To.SlotSizeValue = From.SlotSizeValue;
+    To.bHasCanvasAnchors = From.bHasCanvasAnchors;
+    To.CanvasAnchorsMin = From.CanvasAnchorsMin;
+    To.CanvasAnchorsMax = From.CanvasAnchorsMax;
+    To.bHasCanvasOffsets = From.bHasCanvasOffsets;
+    To.CanvasOffsets = From.CanvasOffsets;
+    To.bHasCanvasAlignment = From.bHasCanvasAlignment;
+    To.CanvasAlignment = From.CanvasAlignment;
+    To.bHasCanvasAutoSize = From.bHasCanvasAutoSize;
+    To.bCanvasAutoSize = From.bCanvasAutoSize;
+    To.bHasCanvasZOrder = From.bHasCanvasZOrder;
+    To.CanvasZOrder = From.CanvasZOrder;
+}
+
+static bool MWCS_CanCollapse(const TSet<FName> &Referenced, const FName ParentType, const FMWCS_HierarchyNode &Node)
+{
+    static const FName VerticalBoxType(TEXT("VerticalBox"));
+    static const FName HorizontalBoxType(TEXT("HorizontalBox"));
+    static const FName OverlayType(TEXT("Overlay"));
+
+    if (Node.Children.Num() != 1 || (Node.Type != VerticalBoxType && Node.Type != HorizontalBoxType && Node.Type != OverlayType) || (Node.Name != NAME_None && Referenced.Contains(Node.Name)))
+    {
+        return false;
+    }
+
+    const FMWCS_HierarchyNode &Child = Node.Children[0];
+    if (Child.bHasSlotPadding && Child.SlotPadding != FMargin(0.0f))
+    {
+        return false;
+    }
+    // The builder leaves unset alignment at the slot default: Fill for box slots, Left/Top for overlay slots, where the
+    // child then sits at its desired size instead of spanning the overlay.
+    if (Node.Type == OverlayType)
+    {
+        return Child.bHasSlotHAlign && Child.SlotHAlign == HAlign_Fill && Child.bHasSlotVAlign && Child.SlotVAlign == VAlign_Fill;
+    }
+    if ((Child.bHasSlotHAlign && Child.SlotHAlign != HAlign_Fill) || (Child.bHasSlotVAlign && Child.SlotVAlign != VAlign_Fill))
+    {
+        return false;
+    }
+
+    // Box slots default to Auto: the child only spans the box along its axis when it fills it, or when the box is itself
+    // given its desired size by a box of the same orientation.
+    const bool bChildFills = Child.bHasSlotSize && Child.SlotSizeRule == ESlateSizeRule::Fill;
+    const bool bSizedToContent = ParentType == Node.Type && !(Node.bHasSlotSize && Node.SlotSizeRule == ESlateSizeRule::Fill);
+    return bChildFills || bSizedToContent;
+}
+
+static void MWCS_CollapseChildren(const TSet<FName> &Referenced, FMWCS_HierarchyNode &Node, TArray<FString> &OutRemoved)
+{
+    for (FMWCS_HierarchyNode &Child : Node.Children)
+    {
+        MWCS_CollapseChildren(Referenced, Child, OutRemoved);
+        while (MWCS_CanCollapse(Referenced, Node.Type, Child))
+        {
+            OutRemoved.Add(Child.Name.IsNone() ? FString::Printf(TEXT("<unnamed %s>"), *Child.Type.ToString()) : Child.Name.ToString());
+            FMWCS_HierarchyNode Hoisted = MoveTemp(Child.Children[0]);
+            MWCS_CopySlot(Child, Hoisted);
+            Child = MoveTemp(Hoisted);
+        }
+    }
+}
+
+bool FMWCS_SpecOptimizer::IsEnabled(const FMWCS_WidgetSpec &Spec)
+{
+    const UMWCS_Settings *Settings = UMWCS_Settings::Get();
+    return Settings && Settings->bCollapseRedundantContainers && !Spec.bIsToolEUW;
+}
+
+int32 FMWCS_SpecOptimizer::Optimize(FMWCS_WidgetSpec &InOutSpec, TArray<FString> *OutRemoved)
+{
+    TSet<FName> Referenced;
+    MWCS_CollectReferencedNames(InOutSpec, Referenced);
+
+    TArray<FString> Removed;
+    MWCS_CollapseChildren(Referenced, InOutSpec.HierarchyRoot, Removed);
+    const int32 NumRemoved = Removed.Num();
+    if (OutRemoved)
+    {
+        *OutRemoved = MoveTemp(Removed);
+    }
+    return NumRemoved;
+}
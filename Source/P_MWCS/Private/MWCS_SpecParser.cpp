@@ -1,403 +1,200 @@
 #include "MWCS_SpecParser.h"
 
+#include "MWCS_CoreLint.h"
+#include "MWCS_CoreSpec.h"
 #include "MWCS_Settings.h"
 #include "MWCS_Utilities.h"
 using namespace MWCS_Utilities;
 
 #include "Dom/JsonObject.h"
-#include "Serialization/JsonReader.h"
-#include "Serialization/JsonSerializer.h"
+#include "Dom/JsonValue.h"
 
-static bool ReadStringField(const TSharedPtr<FJsonObject> &Obj, const TCHAR *Field, FString &Out)
+using MWCS_Core::FJsonNode;
+
+// The spec is read once, into the core DOM. Identifiers, bindings, preview and dependencies come from the core spec;
+// slot and Properties metadata map onto UMG types and are read from the same FJsonNode here.
+
+static FString MWCS_ToFString(const std::string &Value)
 {
-    if (!Obj.IsValid())
-    {
-        return false;
-    }
-    return Obj->TryGetStringField(Field, Out);
+    return FString(UTF8_TO_TCHAR(Value.c_str()));
 }
 
-static bool ReadIntField(const TSharedPtr<FJsonObject> &Obj, const TCHAR *Field, int32 &Out)
+static FName MWCS_ToFName(const std::string &Value)
 {
-    if (!Obj.IsValid())
-    {
-        return false;
-    }
-    double Number = 0.0;
-    if (!Obj->TryGetNumberField(Field, Number))
-    {
-        return false;
-    }
-    Out = static_cast<int32>(Number);
-    return true;
+    return Value.empty() ? NAME_None : FName(UTF8_TO_TCHAR(Value.c_str()));
 }
 
-static bool ReadVersionField(const TSharedPtr<FJsonObject> &Obj, const TCHAR *Field, FString &Out)
+// FJsonValue::AsNumber: 0 for values that do not convert.
+static double MWCS_AsNumber(const FJsonNode &Value)
 {
-    if (!Obj.IsValid())
-    {
-        return false;
-    }
-
-    FString VersionString;
-    if (Obj->TryGetStringField(Field, VersionString))
-    {
-        Out = VersionString;
-        return true;
-    }
-
-    double VersionNumber = 0.0;
-    if (Obj->TryGetNumberField(Field, VersionNumber))
-    {
-        // Preserve integer-ish values without trailing .0 where possible.
-        const int64 AsInt = static_cast<int64>(VersionNumber);
-        if (FMath::IsNearlyEqual(VersionNumber, static_cast<double>(AsInt)))
-        {
-            Out = FString::Printf(TEXT("%lld"), AsInt);
-        }
-        else
-        {
-            Out = FString::SanitizeFloat(VersionNumber);
-        }
-        return true;
-    }
-
-    return false;
+    double Number = 0.0;
+    Value.TryGetNumber(Number);
+    return Number;
 }
 
-static bool TryParseSizeObject(const TSharedPtr<FJsonObject> &Obj, const TCHAR *Field, FVector2D &Out)
+static bool MWCS_TryGetStringField(const FJsonNode &Obj, const char *Field, FString &Out)
 {
-    if (!Obj.IsValid())
-    {
-        return false;
-    }
-
-    const TSharedPtr<FJsonObject> *SizeObjPtr = nullptr;
-    if (!Obj->TryGetObjectField(Field, SizeObjPtr) || !SizeObjPtr || !SizeObjPtr->IsValid())
-    {
-        return false;
-    }
-
-    const TSharedPtr<FJsonObject> SizeObj = *SizeObjPtr;
-
-    double W = 0.0;
-    double H = 0.0;
-    const bool bHasW = SizeObj->TryGetNumberField(TEXT("Width"), W) || SizeObj->TryGetNumberField(TEXT("X"), W);
-    const bool bHasH = SizeObj->TryGetNumberField(TEXT("Height"), H) || SizeObj->TryGetNumberField(TEXT("Y"), H);
-    if (!bHasW || !bHasH)
+    std::string Value;
+    if (!Obj.TryGetStringField(Field, Value))
     {
         return false;
     }
-
-    Out = FVector2D(static_cast<float>(W), static_cast<float>(H));
+    Out = MWCS_ToFString(Value);
     return true;
 }
 
-static bool TryParseIntFieldFlexible(const TSharedPtr<FJsonObject> &Obj, const TCHAR *Field, int32 &Out)
+// Design entries stay FJsonObjects (the builder applies them by reflection), converted from the core DOM.
+static TSharedPtr<FJsonValue> MWCS_ToJsonValue(const FJsonNode &Node)
 {
-    if (!Obj.IsValid())
+    switch (Node.Type)
     {
-        return false;
-    }
-
-    // Number
-    double Number = 0.0;
-    if (Obj->TryGetNumberField(Field, Number))
-    {
-        Out = static_cast<int32>(Number);
-        return true;
-    }
-
-    // String
-    FString Str;
-    if (Obj->TryGetStringField(Field, Str))
+    case MWCS_Core::EJsonType::Bool:
+        return MakeShared<FJsonValueBoolean>(Node.Bool);
+    case MWCS_Core::EJsonType::Number:
+        return MakeShared<FJsonValueNumber>(Node.Number);
+    case MWCS_Core::EJsonType::String:
+        return MakeShared<FJsonValueString>(MWCS_ToFString(Node.String));
+    case MWCS_Core::EJsonType::Array:
     {
-        int32 Parsed = 0;
-        if (LexTryParseString(Parsed, *Str))
+        TArray<TSharedPtr<FJsonValue>> Elements;
+        Elements.Reserve(static_cast<int32>(Node.Array.size()));
+        for (const FJsonNode &Element : Node.Array)
         {
-            Out = Parsed;
-            return true;
+            Elements.Add(MWCS_ToJsonValue(Element));
         }
+        return MakeShared<FJsonValueArray>(Elements);
     }
-
-    return false;
-}
-
-static bool ParseDesignerPreview(const TSharedPtr<FJsonObject> &RootObj, FMWCS_DesignerPreview &Out, FMWCS_Report &Report, const FString &Context)
-{
-    // Defaults
-    Out.SizeMode = EMWCS_PreviewSizeMode::FillScreen;
-    Out.CustomSize = FVector2D::ZeroVector;
-    Out.ZoomLevel = 14;
-    Out.bShowGrid = true;
-
-    if (!RootObj.IsValid())
+    case MWCS_Core::EJsonType::Object:
     {
-        return true;
-    }
-
-    const UMWCS_Settings *Settings = UMWCS_Settings::Get();
-    const int32 ZoomMin = Settings ? Settings->DesignerZoomLevelMin : 0;
-    const int32 ZoomMax = Settings ? Settings->DesignerZoomLevelMax : 20;
-
-    auto ClampZoom = [&](int32 InZoom)
-    {
-        const int32 Clamped = FMath::Clamp(InZoom, ZoomMin, ZoomMax);
-        if (Clamped != InZoom)
+        TSharedRef<FJsonObject> Obj = MakeShared<FJsonObject>();
+        for (const MWCS_Core::FJsonMember &Member : Node.Object)
         {
-            AddIssue(Report, EMWCS_IssueSeverity::Warning, TEXT("DesignerPreview.ZoomOutOfRange"),
-                     FString::Printf(TEXT("ZoomLevel %d clamped to [%d, %d]."), InZoom, ZoomMin, ZoomMax),
-                     Context);
+            Obj->SetField(MWCS_ToFString(Member.Key), MWCS_ToJsonValue(Member.Value));
         }
-        Out.ZoomLevel = Clamped;
-    };
-
-    // Root DesignerPreview section.
-    const TSharedPtr<FJsonObject> *PreviewObjPtr = nullptr;
-    if (RootObj->TryGetObjectField(TEXT("DesignerPreview"), PreviewObjPtr) && PreviewObjPtr && PreviewObjPtr->IsValid())
-    {
-        const TSharedPtr<FJsonObject> PreviewObj = *PreviewObjPtr;
-
-        FString ModeStr;
-        if (PreviewObj->TryGetStringField(TEXT("SizeMode"), ModeStr))
-        {
-            if (ModeStr.Equals(TEXT("FillScreen"), ESearchCase::IgnoreCase) || ModeStr.Equals(TEXT("Fill Screen"), ESearchCase::IgnoreCase))
-                Out.SizeMode = EMWCS_PreviewSizeMode::FillScreen;
-            else if (ModeStr.Equals(TEXT("Desired"), ESearchCase::IgnoreCase))
-                Out.SizeMode = EMWCS_PreviewSizeMode::Desired;
-            else if (ModeStr.Equals(TEXT("DesiredOnScreen"), ESearchCase::IgnoreCase) || ModeStr.Equals(TEXT("Desired On Screen"), ESearchCase::IgnoreCase))
-                Out.SizeMode = EMWCS_PreviewSizeMode::DesiredOnScreen;
-            else if (ModeStr.Equals(TEXT("Custom"), ESearchCase::IgnoreCase))
-                Out.SizeMode = EMWCS_PreviewSizeMode::Custom;
-            else
-                Out.SizeMode = EMWCS_PreviewSizeMode::FillScreen;
-        }
-
-        FVector2D CustomSize;
-        if (TryParseSizeObject(PreviewObj, TEXT("CustomSize"), CustomSize))
-        {
-            Out.CustomSize = CustomSize;
-        }
-
-        int32 Zoom = 0;
-        if (TryParseIntFieldFlexible(PreviewObj, TEXT("ZoomLevel"), Zoom))
-        {
-            ClampZoom(Zoom);
-        }
-
-        PreviewObj->TryGetBoolField(TEXT("ShowGrid"), Out.bShowGrid);
-
-        // Hard validation for Custom mode
-        if (Out.SizeMode == EMWCS_PreviewSizeMode::Custom)
-        {
-            if (Out.CustomSize.X <= 0.0f || Out.CustomSize.Y <= 0.0f)
-            {
-                AddIssue(Report, EMWCS_IssueSeverity::Error, TEXT("DesignerPreview.InvalidCustomSize"),
-                         TEXT("Custom preview size must be positive when SizeMode is Custom."),
-                         Context);
-                return false;
-            }
-        }
-
-        return true;
+        return MakeShared<FJsonValueObject>(Obj);
+    }
+    default:
+        return MakeShared<FJsonValueNull>();
     }
-
-    return true;
 }
 
-static bool ParseBindings(const TSharedPtr<FJsonObject> &RootObj, FMWCS_Bindings &OutBindings)
+static void MWCS_ConvertDesignerPreview(const MWCS_Core::FDesignerPreview &In, FMWCS_DesignerPreview &Out)
 {
-    const TSharedPtr<FJsonObject> *BindingsObj = nullptr;
-    if (!RootObj->TryGetObjectField(TEXT("Bindings"), BindingsObj) || !BindingsObj || !BindingsObj->IsValid())
-    {
-        return false;
-    }
-
-    auto ParseStringArray = [](const TSharedPtr<FJsonObject> &Obj, const TCHAR *Field, TArray<FName> &OutArr)
-    {
-        const TArray<TSharedPtr<FJsonValue>> *Values = nullptr;
-        if (!Obj->TryGetArrayField(Field, Values) || !Values)
-        {
-            return;
-        }
-        for (const TSharedPtr<FJsonValue> &V : *Values)
-        {
-            FString S;
-            if (V.IsValid() && V->TryGetString(S))
-            {
-                OutArr.Add(FName(*S));
-            }
-            else if (V.IsValid() && V->Type == EJson::Object)
-            {
-                TSharedPtr<FJsonObject> ObjVal = V->AsObject();
-                FString Name;
-                if (ObjVal.IsValid() && ObjVal->TryGetStringField(TEXT("Name"), Name))
-                {
-                    OutArr.Add(FName(*Name));
-                }
-            }
-        }
-    };
-
-    auto ParseStringArrayWithTypes = [&OutBindings](const TSharedPtr<FJsonObject> &Obj, const TCHAR *Field, TArray<FName> &OutArr)
-    {
-        const TArray<TSharedPtr<FJsonValue>> *Values = nullptr;
-        if (!Obj->TryGetArrayField(Field, Values) || !Values)
-        {
-            return;
-        }
-        for (const TSharedPtr<FJsonValue> &V : *Values)
-        {
-            FString S;
-            if (V.IsValid() && V->TryGetString(S))
-            {
-                OutArr.Add(FName(*S));
-                continue;
-            }
-            if (V.IsValid() && V->Type == EJson::Object)
-            {
-                TSharedPtr<FJsonObject> ObjVal = V->AsObject();
-                FString Name;
-                if (ObjVal.IsValid() && ObjVal->TryGetStringField(TEXT("Name"), Name))
-                {
-                    const FName NameF(*Name);
-                    OutArr.Add(NameF);
-
-                    FString Type;
-                    if (ObjVal->TryGetStringField(TEXT("Type"), Type) && !Type.IsEmpty())
-                    {
-                        OutBindings.Types.Add(NameF, Type);
-                    }
-                }
-            }
-        }
-    };
-
-    // Backwards-compatible parsing (strings or objects). Also capture per-binding type hints when present.
-    ParseStringArrayWithTypes(*BindingsObj, TEXT("Required"), OutBindings.Required);
-    ParseStringArrayWithTypes(*BindingsObj, TEXT("Optional"), OutBindings.Optional);
-    return true;
+    switch (In.SizeMode)
+    {
+    case MWCS_Core::EPreviewSizeMode::Desired:
+        Out.SizeMode = EMWCS_PreviewSizeMode::Desired;
+        break;
+    case MWCS_Core::EPreviewSizeMode::DesiredOnScreen:
+        Out.SizeMode = EMWCS_PreviewSizeMode::DesiredOnScreen;
+        break;
+    case MWCS_Core::EPreviewSizeMode::Custom:
+        Out.SizeMode = EMWCS_PreviewSizeMode::Custom;
+        break;
+    default:
+        Out.SizeMode = EMWCS_PreviewSizeMode::FillScreen;
+        break;
+    }
+    // The core has already clamped ZoomLevel to the settings range and rejected a non-positive custom size.
+    Out.CustomSize = FVector2D(In.CustomWidth, In.CustomHeight);
+    Out.ZoomLevel = In.ZoomLevel;
+    Out.bShowGrid = In.bShowGrid;
 }
 
-static bool ParseHierarchyNode(const TSharedPtr<FJsonObject> &NodeObj, FMWCS_HierarchyNode &OutNode)
+static void MWCS_ConvertBindings(const MWCS_Core::FBindings &In, FMWCS_Bindings &Out)
 {
-    FString Type;
-    if (!NodeObj.IsValid() || !NodeObj->TryGetStringField(TEXT("Type"), Type))
-    {
-        return false;
-    }
-    OutNode.Type = FName(*Type);
-
-    FString Name;
-    if (NodeObj->TryGetStringField(TEXT("Name"), Name))
+    for (const std::string &Name : In.Required)
     {
-        OutNode.Name = FName(*Name);
+        Out.Required.Add(MWCS_ToFName(Name));
     }
-    else
+    for (const std::string &Name : In.Optional)
     {
-        OutNode.Name = NAME_None;
+        Out.Optional.Add(MWCS_ToFName(Name));
     }
-
-    // IMPORTANT:
-    // If IsVariable is omitted in JSON, preserve the struct default (true).
-    // Many specs (e.g. P_MiniFootball) rely on the default so BindWidget validation works.
-    bool bIsVariable = false;
-    if (NodeObj->TryGetBoolField(TEXT("IsVariable"), bIsVariable))
+    for (const std::pair<std::string, std::string> &Type : In.Types)
     {
-        OutNode.bIsVariable = bIsVariable;
-    }
-
-    FString Text;
-    if (NodeObj->TryGetStringField(TEXT("Text"), Text))
-    {
-        OutNode.Text = Text;
-    }
-
-    FString WidgetClassPath;
-    if (NodeObj->TryGetStringField(TEXT("WidgetClass"), WidgetClassPath))
-    {
-        OutNode.WidgetClassPath = WidgetClassPath;
-    }
-
-    double FontSize = 0.0;
-    if (NodeObj->TryGetNumberField(TEXT("FontSize"), FontSize))
-    {
-        OutNode.FontSize = FMath::Max(0, static_cast<int32>(FontSize));
+        Out.Types.Add(MWCS_ToFName(Type.first), MWCS_ToFString(Type.second));
     }
+}
 
-    FString Justification;
-    if (NodeObj->TryGetStringField(TEXT("Justification"), Justification))
-    {
-        OutNode.Justification = Justification;
-    }
+// CoreNode is the core parse of NodeObj; their children pair up because the core keeps exactly the object children
+// with a "Type" string (anything over the Spec.Limit.* caps has already failed the whole parse).
+static void ParseHierarchyNode(const MWCS_Core::FHierarchyNode &CoreNode, const FJsonNode &NodeObj, FMWCS_HierarchyNode &OutNode)
+{
+    OutNode.Type = MWCS_ToFName(CoreNode.Type);
+    OutNode.Name = MWCS_ToFName(CoreNode.Name);
+    // An omitted IsVariable keeps the default (true); BindWidget validation relies on it.
+    OutNode.bIsVariable = CoreNode.bIsVariable;
+    OutNode.bHasIsVariable = CoreNode.bHasIsVariable;
+    OutNode.Text = MWCS_ToFString(CoreNode.Text);
+    OutNode.WidgetClassPath = MWCS_ToFString(CoreNode.WidgetClassPath);
+    OutNode.FontSize = CoreNode.FontSize;
+    OutNode.Justification = MWCS_ToFString(CoreNode.Justification);
 
     // Optional slot metadata
-    const TSharedPtr<FJsonObject> *SlotObjPtr = nullptr;
-    if (NodeObj->TryGetObjectField(TEXT("Slot"), SlotObjPtr) && SlotObjPtr && SlotObjPtr->IsValid())
+    if (const FJsonNode *SlotObj = NodeObj.TryGetObjectField("Slot"))
     {
-        const TSharedPtr<FJsonObject> SlotObj = *SlotObjPtr;
-
-        auto TryReadVec2 = [](const TSharedPtr<FJsonObject> &Obj, const TCHAR *Field, FVector2D &Out) -> bool
+        auto TryReadVec2 = [](const FJsonNode &Obj, const char *Field, FVector2D &Out) -> bool
         {
-            if (!Obj.IsValid())
-            {
-                return false;
-            }
-            const TSharedPtr<FJsonObject> *VecObjPtr = nullptr;
-            if (Obj->TryGetObjectField(Field, VecObjPtr) && VecObjPtr && VecObjPtr->IsValid())
+            if (const FJsonNode *VecObj = Obj.TryGetObjectField(Field))
             {
                 double X = 0.0, Y = 0.0;
-                if ((*VecObjPtr)->TryGetNumberField(TEXT("X"), X) && (*VecObjPtr)->TryGetNumberField(TEXT("Y"), Y))
+                if (VecObj->TryGetNumberField("X", X) && VecObj->TryGetNumberField("Y", Y))
                 {
                     Out = FVector2D(static_cast<float>(X), static_cast<float>(Y));
                     return true;
                 }
             }
-            const TArray<TSharedPtr<FJsonValue>> *Arr = nullptr;
-            if (Obj->TryGetArrayField(Field, Arr) && Arr && Arr->Num() == 2)
+            const FJsonNode *Arr = Obj.TryGetArrayField(Field);
+            if (Arr && Arr->Array.size() == 2)
             {
-                Out = FVector2D(static_cast<float>((*Arr)[0]->AsNumber()), static_cast<float>((*Arr)[1]->AsNumber()));
+                Out = FVector2D(static_cast<float>(MWCS_AsNumber(Arr->Array[0])), static_cast<float>(MWCS_AsNumber(Arr->Array[1])));
                 return true;
             }
             return false;
         };
 
-        // Padding
-        const TArray<TSharedPtr<FJsonValue>> *PaddingArr = nullptr;
-        if (SlotObj->TryGetArrayField(TEXT("Padding"), PaddingArr) && PaddingArr && PaddingArr->Num() == 4)
+        auto TryReadMargin4 = [](const FJsonNode &Obj, const char *Field, FMargin &Out) -> bool
         {
-            auto NumAt = [&PaddingArr](int32 Index, double DefaultValue)
+            const FJsonNode *Arr = Obj.TryGetArrayField(Field);
+            if (!Arr || Arr->Array.size() != 4)
             {
-                if (!PaddingArr->IsValidIndex(Index) || !(*PaddingArr)[Index].IsValid())
-                {
-                    return DefaultValue;
-                }
-                if ((*PaddingArr)[Index]->Type == EJson::Number)
-                {
-                    return (*PaddingArr)[Index]->AsNumber();
-                }
-                return DefaultValue;
+                return false;
+            }
+            Out = FMargin(
+                static_cast<float>(MWCS_AsNumber(Arr->Array[0])),
+                static_cast<float>(MWCS_AsNumber(Arr->Array[1])),
+                static_cast<float>(MWCS_AsNumber(Arr->Array[2])),
+                static_cast<float>(MWCS_AsNumber(Arr->Array[3])));
+            return true;
+        };
+
+        auto ReadMarginObject = [](const FJsonNode &MarginObj)
+        {
+            double L = 0, T = 0, R = 0, B = 0;
+            MarginObj.TryGetNumberField("Left", L);
+            MarginObj.TryGetNumberField("Top", T);
+            MarginObj.TryGetNumberField("Right", R);
+            MarginObj.TryGetNumberField("Bottom", B);
+            return FMargin(static_cast<float>(L), static_cast<float>(T), static_cast<float>(R), static_cast<float>(B));
+        };
+
+        // Padding: [L,T,R,B] (non-numbers read as 0) or {Left,Top,Right,Bottom}
+        const FJsonNode *PaddingArr = SlotObj->TryGetArrayField("Padding");
+        if (PaddingArr && PaddingArr->Array.size() == 4)
+        {
+            auto NumAt = [PaddingArr](size_t Index)
+            {
+                const FJsonNode &Value = PaddingArr->Array[Index];
+                return Value.Type == MWCS_Core::EJsonType::Number ? static_cast<float>(Value.Number) : 0.0f;
             };
             OutNode.bHasSlotPadding = true;
-            OutNode.SlotPadding = FMargin(
-                static_cast<float>(NumAt(0, 0.0)),
-                static_cast<float>(NumAt(1, 0.0)),
-                static_cast<float>(NumAt(2, 0.0)),
-                static_cast<float>(NumAt(3, 0.0)));
+            OutNode.SlotPadding = FMargin(NumAt(0), NumAt(1), NumAt(2), NumAt(3));
         }
-        else
+        else if (const FJsonNode *PaddingObj = SlotObj->TryGetObjectField("Padding"))
         {
-            const TSharedPtr<FJsonObject> *PaddingObjPtr = nullptr;
-            if (SlotObj->TryGetObjectField(TEXT("Padding"), PaddingObjPtr) && PaddingObjPtr && PaddingObjPtr->IsValid())
-            {
-                double L = 0, T = 0, R = 0, B = 0;
-                (*PaddingObjPtr)->TryGetNumberField(TEXT("Left"), L);
-                (*PaddingObjPtr)->TryGetNumberField(TEXT("Top"), T);
-                (*PaddingObjPtr)->TryGetNumberField(TEXT("Right"), R);
-                (*PaddingObjPtr)->TryGetNumberField(TEXT("Bottom"), B);
-                OutNode.bHasSlotPadding = true;
-                OutNode.SlotPadding = FMargin(static_cast<float>(L), static_cast<float>(T), static_cast<float>(R), static_cast<float>(B));
-            }
+            OutNode.bHasSlotPadding = true;
+            OutNode.SlotPadding = ReadMarginObject(*PaddingObj);
         }
 
         auto ParseHAlign = [](const FString &S, bool &bOutHas, EHorizontalAlignment &Out)
@@ -439,13 +236,13 @@ static bool ParseHierarchyNode(const TSharedPtr<FJsonObject> &NodeObj, FMWCS_Hie
         };
 
         FString HAlignStr;
-        if (SlotObj->TryGetStringField(TEXT("HAlign"), HAlignStr))
+        if (MWCS_TryGetStringField(*SlotObj, "HAlign", HAlignStr))
         {
             ParseHAlign(HAlignStr, OutNode.bHasSlotHAlign, OutNode.SlotHAlign);
         }
 
         FString VAlignStr;
-        if (SlotObj->TryGetStringField(TEXT("VAlign"), VAlignStr))
+        if (MWCS_TryGetStringField(*SlotObj, "VAlign", VAlignStr))
         {
             ParseVAlign(VAlignStr, OutNode.bHasSlotVAlign, OutNode.SlotVAlign);
         }
@@ -456,94 +253,76 @@ static bool ParseHierarchyNode(const TSharedPtr<FJsonObject> &NodeObj, FMWCS_Hie
         //  - "Size": 1.0            (treated as Fill)
         //  - "Size": { "Rule": "Fill|Auto", "Value": 1.0 }
         double FillValue = 0.0;
-        if (SlotObj->TryGetNumberField(TEXT("Fill"), FillValue))
+        double SizeNumber = 0.0;
+        if (SlotObj->TryGetNumberField("Fill", FillValue))
         {
             OutNode.bHasSlotSize = true;
             OutNode.SlotSizeRule = ESlateSizeRule::Fill;
             OutNode.SlotSizeValue = static_cast<float>(FillValue);
         }
-        else
+        else if (SlotObj->TryGetNumberField("Size", SizeNumber))
+        {
+            OutNode.bHasSlotSize = true;
+            OutNode.SlotSizeRule = ESlateSizeRule::Fill;
+            OutNode.SlotSizeValue = static_cast<float>(SizeNumber);
+        }
+        else if (const FJsonNode *SizeObj = SlotObj->TryGetObjectField("Size"))
         {
-            double SizeNumber = 0.0;
-            if (SlotObj->TryGetNumberField(TEXT("Size"), SizeNumber))
+            FString RuleStr;
+            MWCS_TryGetStringField(*SizeObj, "Rule", RuleStr);
+
+            double Value = 1.0;
+            SizeObj->TryGetNumberField("Value", Value);
+
+            OutNode.bHasSlotSize = true;
+            if (RuleStr.Equals(TEXT("Auto"), ESearchCase::IgnoreCase) || RuleStr.Equals(TEXT("Automatic"), ESearchCase::IgnoreCase))
             {
-                OutNode.bHasSlotSize = true;
-                OutNode.SlotSizeRule = ESlateSizeRule::Fill;
-                OutNode.SlotSizeValue = static_cast<float>(SizeNumber);
+                OutNode.SlotSizeRule = ESlateSizeRule::Automatic;
+                OutNode.SlotSizeValue = 1.0f;
             }
             else
             {
-                const TSharedPtr<FJsonObject> *SizeObjPtr = nullptr;
-                if (SlotObj->TryGetObjectField(TEXT("Size"), SizeObjPtr) && SizeObjPtr && SizeObjPtr->IsValid())
-                {
-                    FString RuleStr;
-                    (*SizeObjPtr)->TryGetStringField(TEXT("Rule"), RuleStr);
-
-                    double Value = 1.0;
-                    (*SizeObjPtr)->TryGetNumberField(TEXT("Value"), Value);
-
-                    OutNode.bHasSlotSize = true;
-                    if (RuleStr.Equals(TEXT("Auto"), ESearchCase::IgnoreCase) || RuleStr.Equals(TEXT("Automatic"), ESearchCase::IgnoreCase))
-                    {
-                        OutNode.SlotSizeRule = ESlateSizeRule::Automatic;
-                        OutNode.SlotSizeValue = 1.0f;
-                    }
-                    else
-                    {
-                        OutNode.SlotSizeRule = ESlateSizeRule::Fill;
-                        OutNode.SlotSizeValue = static_cast<float>(Value);
-                    }
-                }
+                OutNode.SlotSizeRule = ESlateSizeRule::Fill;
+                OutNode.SlotSizeValue = static_cast<float>(Value);
             }
         }
+
         // Canvas slot
-        const TSharedPtr<FJsonObject> *CanvasObjPtr = nullptr;
-        if (SlotObj->TryGetObjectField(TEXT("Canvas"), CanvasObjPtr) && CanvasObjPtr && CanvasObjPtr->IsValid())
+        if (const FJsonNode *CanvasObj = SlotObj->TryGetObjectField("Canvas"))
         {
-            const TSharedPtr<FJsonObject> CanvasObj = *CanvasObjPtr;
-
-            const TSharedPtr<FJsonObject> *AnchorsObjPtr = nullptr;
-            if (CanvasObj->TryGetObjectField(TEXT("Anchors"), AnchorsObjPtr) && AnchorsObjPtr && AnchorsObjPtr->IsValid())
+            if (const FJsonNode *AnchorsObj = CanvasObj->TryGetObjectField("Anchors"))
             {
-                const TArray<TSharedPtr<FJsonValue>> *MinArr = nullptr;
-                const TArray<TSharedPtr<FJsonValue>> *MaxArr = nullptr;
-
-                if ((*AnchorsObjPtr)->TryGetArrayField(TEXT("Min"), MinArr) && MinArr && MinArr->Num() == 2 &&
-                    (*AnchorsObjPtr)->TryGetArrayField(TEXT("Max"), MaxArr) && MaxArr && MaxArr->Num() == 2)
+                const FJsonNode *MinArr = AnchorsObj->TryGetArrayField("Min");
+                const FJsonNode *MaxArr = AnchorsObj->TryGetArrayField("Max");
+                if (MinArr && MinArr->Array.size() == 2 && MaxArr && MaxArr->Array.size() == 2)
                 {
                     OutNode.bHasCanvasAnchors = true;
-                    OutNode.CanvasAnchorsMin = FVector2D(static_cast<float>((*MinArr)[0]->AsNumber()), static_cast<float>((*MinArr)[1]->AsNumber()));
-                    OutNode.CanvasAnchorsMax = FVector2D(static_cast<float>((*MaxArr)[0]->AsNumber()), static_cast<float>((*MaxArr)[1]->AsNumber()));
+                    OutNode.CanvasAnchorsMin = FVector2D(static_cast<float>(MWCS_AsNumber(MinArr->Array[0])), static_cast<float>(MWCS_AsNumber(MinArr->Array[1])));
+                    OutNode.CanvasAnchorsMax = FVector2D(static_cast<float>(MWCS_AsNumber(MaxArr->Array[0])), static_cast<float>(MWCS_AsNumber(MaxArr->Array[1])));
                 }
             }
 
-            const TArray<TSharedPtr<FJsonValue>> *OffsetsArr = nullptr;
-            if (CanvasObj->TryGetArrayField(TEXT("Offsets"), OffsetsArr) && OffsetsArr && OffsetsArr->Num() == 4)
+            if (TryReadMargin4(*CanvasObj, "Offsets", OutNode.CanvasOffsets))
             {
                 OutNode.bHasCanvasOffsets = true;
-                OutNode.CanvasOffsets = FMargin(
-                    static_cast<float>((*OffsetsArr)[0]->AsNumber()),
-                    static_cast<float>((*OffsetsArr)[1]->AsNumber()),
-                    static_cast<float>((*OffsetsArr)[2]->AsNumber()),
-                    static_cast<float>((*OffsetsArr)[3]->AsNumber()));
             }
 
-            const TArray<TSharedPtr<FJsonValue>> *AlignmentArr = nullptr;
-            if (CanvasObj->TryGetArrayField(TEXT("Alignment"), AlignmentArr) && AlignmentArr && AlignmentArr->Num() == 2)
+            const FJsonNode *AlignmentArr = CanvasObj->TryGetArrayField("Alignment");
+            if (AlignmentArr && AlignmentArr->Array.size() == 2)
             {
                 OutNode.bHasCanvasAlignment = true;
-                OutNode.CanvasAlignment = FVector2D(static_cast<float>((*AlignmentArr)[0]->AsNumber()), static_cast<float>((*AlignmentArr)[1]->AsNumber()));
+                OutNode.CanvasAlignment = FVector2D(static_cast<float>(MWCS_AsNumber(AlignmentArr->Array[0])), static_cast<float>(MWCS_AsNumber(AlignmentArr->Array[1])));
             }
 
             bool bAutoSize = false;
-            if (CanvasObj->TryGetBoolField(TEXT("AutoSize"), bAutoSize))
+            if (CanvasObj->TryGetBoolField("AutoSize", bAutoSize))
             {
                 OutNode.bHasCanvasAutoSize = true;
                 OutNode.bCanvasAutoSize = bAutoSize;
             }
 
             double ZOrder = 0.0;
-            if (CanvasObj->TryGetNumberField(TEXT("ZOrder"), ZOrder))
+            if (CanvasObj->TryGetNumberField("ZOrder", ZOrder))
             {
                 OutNode.bHasCanvasZOrder = true;
                 OutNode.CanvasZOrder = static_cast<int32>(ZOrder);
@@ -555,11 +334,10 @@ static bool ParseHierarchyNode(const TSharedPtr<FJsonObject> &NodeObj, FMWCS_Hie
             // Common in P_MiniFootball specs: Anchors/Position/Size/Alignment/Offsets/AutoSize/ZOrder.
 
             // Anchors: { Min:{X,Y}, Max:{X,Y} }
-            const TSharedPtr<FJsonObject> *AnchorsObjPtr = nullptr;
-            if (SlotObj->TryGetObjectField(TEXT("Anchors"), AnchorsObjPtr) && AnchorsObjPtr && AnchorsObjPtr->IsValid())
+            if (const FJsonNode *AnchorsObj = SlotObj->TryGetObjectField("Anchors"))
             {
                 FVector2D Min, Max;
-                if (TryReadVec2(*AnchorsObjPtr, TEXT("Min"), Min) && TryReadVec2(*AnchorsObjPtr, TEXT("Max"), Max))
+                if (TryReadVec2(*AnchorsObj, "Min", Min) && TryReadVec2(*AnchorsObj, "Max", Max))
                 {
                     OutNode.bHasCanvasAnchors = true;
                     OutNode.CanvasAnchorsMin = Min;
@@ -568,29 +346,14 @@ static bool ParseHierarchyNode(const TSharedPtr<FJsonObject> &NodeObj, FMWCS_Hie
             }
 
             // Offsets: {Left,Top,Right,Bottom} or [L,T,R,B]
-            if (!OutNode.bHasCanvasOffsets)
+            if (TryReadMargin4(*SlotObj, "Offsets", OutNode.CanvasOffsets))
             {
-                const TSharedPtr<FJsonObject> *OffsetsObjPtr = nullptr;
-                const TArray<TSharedPtr<FJsonValue>> *OffsetsArr = nullptr;
-                if (SlotObj->TryGetArrayField(TEXT("Offsets"), OffsetsArr) && OffsetsArr && OffsetsArr->Num() == 4)
-                {
-                    OutNode.bHasCanvasOffsets = true;
-                    OutNode.CanvasOffsets = FMargin(
-                        static_cast<float>((*OffsetsArr)[0]->AsNumber()),
-                        static_cast<float>((*OffsetsArr)[1]->AsNumber()),
-                        static_cast<float>((*OffsetsArr)[2]->AsNumber()),
-                        static_cast<float>((*OffsetsArr)[3]->AsNumber()));
-                }
-                else if (SlotObj->TryGetObjectField(TEXT("Offsets"), OffsetsObjPtr) && OffsetsObjPtr && OffsetsObjPtr->IsValid())
-                {
-                    double L = 0, T = 0, R = 0, B = 0;
-                    (*OffsetsObjPtr)->TryGetNumberField(TEXT("Left"), L);
-                    (*OffsetsObjPtr)->TryGetNumberField(TEXT("Top"), T);
-                    (*OffsetsObjPtr)->TryGetNumberField(TEXT("Right"), R);
-                    (*OffsetsObjPtr)->TryGetNumberField(TEXT("Bottom"), B);
-                    OutNode.bHasCanvasOffsets = true;
-                    OutNode.CanvasOffsets = FMargin(static_cast<float>(L), static_cast<float>(T), static_cast<float>(R), static_cast<float>(B));
-                }
+                OutNode.bHasCanvasOffsets = true;
+            }
+            else if (const FJsonNode *OffsetsObj = SlotObj->TryGetObjectField("Offsets"))
+            {
+                OutNode.bHasCanvasOffsets = true;
+                OutNode.CanvasOffsets = ReadMarginObject(*OffsetsObj);
             }
 
             // Position + Size -> Offsets (when not already specified)
@@ -598,8 +361,8 @@ static bool ParseHierarchyNode(const TSharedPtr<FJsonObject> &NodeObj, FMWCS_Hie
             {
                 FVector2D Pos;
                 FVector2D Size;
-                const bool bHasPos = TryReadVec2(SlotObj, TEXT("Position"), Pos);
-                const bool bHasSize = TryReadVec2(SlotObj, TEXT("Size"), Size);
+                const bool bHasPos = TryReadVec2(*SlotObj, "Position", Pos);
+                const bool bHasSize = TryReadVec2(*SlotObj, "Size", Size);
                 if (bHasPos)
                 {
                     OutNode.bHasCanvasOffsets = true;
@@ -609,7 +372,7 @@ static bool ParseHierarchyNode(const TSharedPtr<FJsonObject> &NodeObj, FMWCS_Hie
 
             // Alignment
             FVector2D Align;
-            if (TryReadVec2(SlotObj, TEXT("Alignment"), Align))
+            if (TryReadVec2(*SlotObj, "Alignment", Align))
             {
                 OutNode.bHasCanvasAlignment = true;
                 OutNode.CanvasAlignment = Align;
@@ -617,7 +380,7 @@ static bool ParseHierarchyNode(const TSharedPtr<FJsonObject> &NodeObj, FMWCS_Hie
 
             // AutoSize
             bool bAutoSize = false;
-            if (SlotObj->TryGetBoolField(TEXT("AutoSize"), bAutoSize))
+            if (SlotObj->TryGetBoolField("AutoSize", bAutoSize))
             {
                 OutNode.bHasCanvasAutoSize = true;
                 OutNode.bCanvasAutoSize = bAutoSize;
@@ -625,7 +388,7 @@ static bool ParseHierarchyNode(const TSharedPtr<FJsonObject> &NodeObj, FMWCS_Hie
 
             // ZOrder
             double ZOrder = 0.0;
-            if (SlotObj->TryGetNumberField(TEXT("ZOrder"), ZOrder))
+            if (SlotObj->TryGetNumberField("ZOrder", ZOrder))
             {
                 OutNode.bHasCanvasZOrder = true;
                 OutNode.CanvasZOrder = static_cast<int32>(ZOrder);
@@ -634,261 +397,208 @@ static bool ParseHierarchyNode(const TSharedPtr<FJsonObject> &NodeObj, FMWCS_Hie
     }
 
     // Parse Properties section for specialized widgets
-    const TSharedPtr<FJsonObject> *PropsPtr = nullptr;
-    const bool bHasProps = NodeObj->TryGetObjectField(TEXT("Properties"), PropsPtr) && PropsPtr && PropsPtr->IsValid();
+    const FJsonNode *Props = NodeObj.TryGetObjectField("Properties");
 
     // ScrollBox: Orientation, ScrollBarVisibility
     if (OutNode.Type == TEXT("ScrollBox"))
     {
         FString OrientStr;
         // Check Properties first, then inline
-        if ((bHasProps && (*PropsPtr)->TryGetStringField(TEXT("Orientation"), OrientStr)) || 
-            NodeObj->TryGetStringField(TEXT("Orientation"), OrientStr))
+        if ((Props && MWCS_TryGetStringField(*Props, "Orientation", OrientStr)) || MWCS_TryGetStringField(NodeObj, "Orientation", OrientStr))
         {
             OutNode.bHasOrientation = true;
             OutNode.Orientation = OrientStr.Equals(TEXT("Horizontal"), ESearchCase::IgnoreCase) ? EOrientation::Orient_Horizontal : EOrientation::Orient_Vertical;
         }
 
         FString VisStr;
-        if ((bHasProps && (*PropsPtr)->TryGetStringField(TEXT("ScrollBarVisibility"), VisStr)) ||
-            NodeObj->TryGetStringField(TEXT("ScrollBarVisibility"), VisStr))
+        if ((Props && MWCS_TryGetStringField(*Props, "ScrollBarVisibility", VisStr)) || MWCS_TryGetStringField(NodeObj, "ScrollBarVisibility", VisStr))
         {
             OutNode.bHasScrollBarVisibility = true;
             if (VisStr.Equals(TEXT("Collapsed"), ESearchCase::IgnoreCase)) OutNode.ScrollBarVisibility = ESlateVisibility::Collapsed;
             else if (VisStr.Equals(TEXT("Hidden"), ESearchCase::IgnoreCase)) OutNode.ScrollBarVisibility = ESlateVisibility::Hidden;
             else if (VisStr.Equals(TEXT("HitTestInvisible"), ESearchCase::IgnoreCase)) OutNode.ScrollBarVisibility = ESlateVisibility::HitTestInvisible;
             else if (VisStr.Equals(TEXT("SelfHitTestInvisible"), ESearchCase::IgnoreCase)) OutNode.ScrollBarVisibility = ESlateVisibility::SelfHitTestInvisible;
-            else OutNode.ScrollBarVisibility = ESlateVisibility::Visible; 
+            else OutNode.ScrollBarVisibility = ESlateVisibility::Visible;
         }
     }
     // Spacer: Size
     else if (OutNode.Type == TEXT("Spacer"))
     {
         // Check Properties.Size
-        const TSharedPtr<FJsonObject> *SizeObjPtr = nullptr;
-        if (bHasProps && (*PropsPtr)->TryGetObjectField(TEXT("Size"), SizeObjPtr) && SizeObjPtr && SizeObjPtr->IsValid())
+        if (const FJsonNode *SizeObj = Props ? Props->TryGetObjectField("Size") : nullptr)
         {
             double SizeX = 0.0, SizeY = 0.0;
-            (*SizeObjPtr)->TryGetNumberField(TEXT("X"), SizeX);
-            (*SizeObjPtr)->TryGetNumberField(TEXT("Y"), SizeY);
+            SizeObj->TryGetNumberField("X", SizeX);
+            SizeObj->TryGetNumberField("Y", SizeY);
             OutNode.bHasSpacerSize = true;
             OutNode.SpacerSize = FVector2D(SizeX, SizeY);
         }
     }
 
-    const TArray<TSharedPtr<FJsonValue>> *Children = nullptr;
-    if (NodeObj->TryGetArrayField(TEXT("Children"), Children) && Children)
+    if (const FJsonNode *Children = NodeObj.TryGetArrayField("Children"))
     {
-        for (const TSharedPtr<FJsonValue> &ChildVal : *Children)
+        size_t CoreIndex = 0;
+        for (const FJsonNode &ChildVal : Children->Array)
         {
-            if (!ChildVal.IsValid() || ChildVal->Type != EJson::Object)
+            std::string ChildType;
+            if (!ChildVal.IsObject() || !ChildVal.TryGetStringField("Type", ChildType))
             {
                 continue;
             }
-            FMWCS_HierarchyNode ChildNode;
-            if (ParseHierarchyNode(ChildVal->AsObject(), ChildNode))
-            {
-                OutNode.Children.Add(MoveTemp(ChildNode));
-            }
+            check(CoreIndex < CoreNode.Children.size());
+            ParseHierarchyNode(CoreNode.Children[CoreIndex++], ChildVal, OutNode.Children.AddDefaulted_GetRef());
         }
     }
 
     // Apply Container Properties Macro (Spacing / SizeToContent)
-    if (OutNode.Type == TEXT("VerticalBox") || OutNode.Type == TEXT("HorizontalBox"))
+    if (Props && (OutNode.Type == TEXT("VerticalBox") || OutNode.Type == TEXT("HorizontalBox")))
     {
-        // Reuse PropsPtr and bHasProps from earlier in the function
-        if (bHasProps)
+        // Spacing
+        double Spacing = 0.0;
+        if (Props->TryGetNumberField("Spacing", Spacing) && Spacing > 0.0)
         {
-            // Spacing
-            double Spacing = 0.0;
-            if ((*PropsPtr)->TryGetNumberField(TEXT("Spacing"), Spacing) && Spacing > 0.0)
+            // Apply as padding to children (index > 0)
+            // VBox: Top, HBox: Left
+            const bool bIsVBox = OutNode.Type == TEXT("VerticalBox");
+
+            for (int32 i = 1; i < OutNode.Children.Num(); ++i)
             {
-                // Apply as padding to children (index > 0)
-                // VBox: Top, HBox: Left
-                bool bIsVBox = OutNode.Type == TEXT("VerticalBox");
-                
-                for (int32 i = 1; i < OutNode.Children.Num(); ++i)
+                FMWCS_HierarchyNode &Child = OutNode.Children[i];
+
+                if (!Child.bHasSlotPadding)
                 {
-                    FMWCS_HierarchyNode &Child = OutNode.Children[i];
-                    
-                    if (!Child.bHasSlotPadding)
-                    {
-                        Child.bHasSlotPadding = true;
-                        Child.SlotPadding = FMargin(0);
-                    }
-                    
-                    if (bIsVBox)
-                        Child.SlotPadding.Top = static_cast<float>(Spacing);
-                    else
-                        Child.SlotPadding.Left = static_cast<float>(Spacing);
+                    Child.bHasSlotPadding = true;
+                    Child.SlotPadding = FMargin(0);
                 }
+
+                if (bIsVBox)
+                    Child.SlotPadding.Top = static_cast<float>(Spacing);
+                else
+                    Child.SlotPadding.Left = static_cast<float>(Spacing);
             }
-            
-            // SizeToContent
-            bool bSizeToContent = false;
-            if ((*PropsPtr)->TryGetBoolField(TEXT("SizeToContent"), bSizeToContent) && bSizeToContent)
+        }
+
+        // SizeToContent
+        bool bSizeToContent = false;
+        if (Props->TryGetBoolField("SizeToContent", bSizeToContent) && bSizeToContent)
+        {
+            // Force all children to Auto size
+            for (FMWCS_HierarchyNode &Child : OutNode.Children)
             {
-                // Force all children to Auto size
-                for (FMWCS_HierarchyNode &Child : OutNode.Children)
-                {
-                    Child.bHasSlotSize = true;
-                    Child.SlotSizeRule = ESlateSizeRule::Automatic;
-                    Child.SlotSizeValue = 1.0f;
-                }
+                Child.bHasSlotSize = true;
+                Child.SlotSizeRule = ESlateSizeRule::Automatic;
+                Child.SlotSizeValue = 1.0f;
             }
         }
     }
-
-    return true;
 }
 
-static void ParseDependencies(const TSharedPtr<FJsonObject> &RootObj, TArray<FString> &OutDeps)
+static void MWCS_AddCoreDiagnostics(std::vector<MWCS_Core::FDiagnostic> &Diagnostics, FMWCS_Report &Report, const FString &Context)
 {
-    OutDeps.Reset();
-
-    if (!RootObj.IsValid())
-    {
-        return;
-    }
-
-    const TArray<TSharedPtr<FJsonValue>> *DepsArr = nullptr;
-    if (!RootObj->TryGetArrayField(TEXT("Dependencies"), DepsArr) || !DepsArr)
-    {
-        return;
-    }
-
-    for (const TSharedPtr<FJsonValue> &V : *DepsArr)
+    for (const MWCS_Core::FDiagnostic &Diagnostic : Diagnostics)
     {
-        FString S;
-        if (V.IsValid() && V->TryGetString(S) && !S.IsEmpty())
-        {
-            OutDeps.Add(S);
-        }
+        AddIssue(Report, static_cast<EMWCS_IssueSeverity>(Diagnostic.Severity), UTF8_TO_TCHAR(Diagnostic.Code.c_str()), UTF8_TO_TCHAR(Diagnostic.Message.c_str()), Context);
     }
+    Diagnostics.clear();
 }
 
-static void ParseDesign(const TSharedPtr<FJsonObject> &RootObj, TMap<FName, TSharedPtr<FJsonObject>> &OutDesign)
+MWCS_Core::FSpecParseOptions FMWCS_SpecParser::GetCoreParseOptions()
 {
-    OutDesign.Reset();
-
-    if (!RootObj.IsValid())
+    MWCS_Core::FSpecParseOptions Options;
+    if (const UMWCS_Settings *Settings = UMWCS_Settings::Get())
     {
-        return;
+        Options.ZoomLevelMin = Settings->DesignerZoomLevelMin;
+        Options.ZoomLevelMax = Settings->DesignerZoomLevelMax;
+        Options.MaxHierarchyDepth = FMath::Max(1, Settings->MaxSpecHierarchyDepth);
+        Options.MaxWidgets = FMath::Max(1, Settings->MaxSpecWidgets);
+        Options.Json.MaxStringBytes = static_cast<size_t>(FMath::Max(1, Settings->MaxSpecStringBytes));
     }
+    return Options;
+}
 
-    const TSharedPtr<FJsonObject> *DesignObjPtr = nullptr;
-    if (!RootObj->TryGetObjectField(TEXT("Design"), DesignObjPtr) || !DesignObjPtr || !DesignObjPtr->IsValid())
-    {
-        return;
-    }
-
-    const TSharedPtr<FJsonObject> DesignObj = *DesignObjPtr;
-    for (const TPair<FString, TSharedPtr<FJsonValue>> &KV : DesignObj->Values)
-    {
-        if (KV.Key.IsEmpty() || !KV.Value.IsValid() || KV.Value->Type != EJson::Object)
-        {
-            continue;
-        }
-
-        TSharedPtr<FJsonObject> EntryObj = KV.Value->AsObject();
-        if (!EntryObj.IsValid())
-        {
-            continue;
-        }
-
-        // Support both:
-        //  - "Design": { "WidgetName": { ... } }
-        //  - "Design": { "WidgetName": { "Properties": { ... } } }
-        const TSharedPtr<FJsonObject> *PropsObjPtr = nullptr;
-        if (EntryObj->TryGetObjectField(TEXT("Properties"), PropsObjPtr) && PropsObjPtr && PropsObjPtr->IsValid())
-        {
-            EntryObj = *PropsObjPtr;
-        }
-
-        OutDesign.Add(FName(*KV.Key), EntryObj);
-    }
+static bool MWCS_ParseCoreSpec(const FString &JsonString, MWCS_Core::FWidgetSpec &OutSpec, FMWCS_Report &InOutReport, const FString &Context)
+{
+    const FTCHARToUTF8 Utf8(*JsonString);
+    std::vector<MWCS_Core::FDiagnostic> Diagnostics;
+    const bool bParsed = MWCS_Core::ParseSpec(std::string_view(Utf8.Get(), Utf8.Length()), OutSpec, Diagnostics, FMWCS_SpecParser::GetCoreParseOptions());
+    MWCS_AddCoreDiagnostics(Diagnostics, InOutReport, Context);
+    return bParsed;
 }
 
 bool FMWCS_SpecParser::ParseSpecJson(const FString &JsonString, FMWCS_WidgetSpec &OutSpec, FMWCS_Report &InOutReport, const FString &Context)
 {
-    TSharedPtr<FJsonObject> RootObj;
-    TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(JsonString);
-    if (!FJsonSerializer::Deserialize(Reader, RootObj) || !RootObj.IsValid())
+    const FTCHARToUTF8 Utf8(*JsonString);
+    MWCS_Core::FJsonNode Root;
+    MWCS_Core::FJsonError Error;
+    if (!MWCS_Core::ParseJson(std::string_view(Utf8.Get(), Utf8.Length()), Root, &Error, GetCoreParseOptions().GetJsonLimits()))
     {
-        AddIssue(InOutReport, EMWCS_IssueSeverity::Error, TEXT("Spec.InvalidJson"), TEXT("Failed to parse JSON."), Context);
+        const MWCS_Core::FDiagnostic Diagnostic = MWCS_Core::MakeJsonErrorDiagnostic(Error);
+        AddIssue(InOutReport, EMWCS_IssueSeverity::Error, UTF8_TO_TCHAR(Diagnostic.Code.c_str()), UTF8_TO_TCHAR(Diagnostic.Message.c_str()), Context);
         return false;
     }
+    return ParseSpecNode(Root, OutSpec, InOutReport, Context);
+}
 
-    FString BlueprintName;
-    FString ParentClass;
-    FString Version;
-
-    if (!ReadStringField(RootObj, TEXT("BlueprintName"), BlueprintName))
-    {
-        AddIssue(InOutReport, EMWCS_IssueSeverity::Error, TEXT("Spec.MissingBlueprintName"), TEXT("Missing required field: BlueprintName"), Context);
-        return false;
-    }
-    if (!ReadStringField(RootObj, TEXT("ParentClass"), ParentClass))
+bool FMWCS_SpecParser::ParseSpecNode(const MWCS_Core::FJsonNode &Root, FMWCS_WidgetSpec &OutSpec, FMWCS_Report &InOutReport, const FString &Context)
+{
+    // The core reports every Spec.* / DesignerPreview.* issue and enforces the Spec.Limit.* caps, which bound the
+    // recursion in ParseHierarchyNode below.
+    MWCS_Core::FWidgetSpec CoreSpec;
+    std::vector<MWCS_Core::FDiagnostic> Diagnostics;
+    const bool bParsed = MWCS_Core::ParseSpec(Root, CoreSpec, Diagnostics, GetCoreParseOptions());
+    MWCS_AddCoreDiagnostics(Diagnostics, InOutReport, Context);
+    if (!bParsed)
     {
-        AddIssue(InOutReport, EMWCS_IssueSeverity::Error, TEXT("Spec.MissingParentClass"), TEXT("Missing required field: ParentClass"), Context);
         return false;
     }
 
-    {
-        bool bIsToolEUW = false;
-        RootObj->TryGetBoolField(TEXT("IsToolEUW"), bIsToolEUW);
-        OutSpec.bIsToolEUW = bIsToolEUW;
-    }
-    if (!ReadVersionField(RootObj, TEXT("Version"), Version))
-    {
-        AddIssue(InOutReport, EMWCS_IssueSeverity::Error, TEXT("Spec.MissingVersion"), TEXT("Missing required field: Version"), Context);
-        return false;
-    }
+    // "Hierarchy": { "Type": ..., "Children": [...] } or "Hierarchy": { "Root": { "Type": ..., ... } }
+    const FJsonNode *HierarchyObj = Root.TryGetObjectField("Hierarchy");
+    const FJsonNode *HierarchyRootObj = HierarchyObj->TryGetObjectField("Root");
 
-    const TSharedPtr<FJsonObject> *HierarchyObj = nullptr;
-    if (!RootObj->TryGetObjectField(TEXT("Hierarchy"), HierarchyObj) || !HierarchyObj || !HierarchyObj->IsValid())
-    {
-        AddIssue(InOutReport, EMWCS_IssueSeverity::Error, TEXT("Spec.MissingHierarchy"), TEXT("Missing required field: Hierarchy"), Context);
-        return false;
-    }
+    OutSpec.BlueprintName = MWCS_ToFName(CoreSpec.BlueprintName);
+    OutSpec.ParentClassPath = MWCS_ToFString(CoreSpec.ParentClassPath);
+    OutSpec.Version = MWCS_ToFString(CoreSpec.Version);
+    OutSpec.bIsToolEUW = CoreSpec.bIsToolEUW;
+    OutSpec.ProviderPath = Context;
+    // Canonical form, so whitespace, key order and float noise do not count as changes.
+    OutSpec.SpecHash = MWCS_ToFString(CoreSpec.SpecHash);
+    MWCS_ConvertDesignerPreview(CoreSpec.DesignerPreview, OutSpec.DesignerPreview);
+    OutSpec.HierarchyRoot = FMWCS_HierarchyNode();
+    ParseHierarchyNode(CoreSpec.HierarchyRoot, HierarchyRootObj ? *HierarchyRootObj : *HierarchyObj, OutSpec.HierarchyRoot);
+    OutSpec.Bindings = FMWCS_Bindings();
+    MWCS_ConvertBindings(CoreSpec.Bindings, OutSpec.Bindings);
 
-    FMWCS_Bindings Bindings;
-    if (!ParseBindings(RootObj, Bindings))
+    // "Design": { "WidgetName": { ... } } or { "WidgetName": { "Properties": { ... } } }; the core unwraps Properties.
+    OutSpec.Design.Reset();
+    for (const MWCS_Core::FDesignEntry &Entry : CoreSpec.Design)
     {
-        AddIssue(InOutReport, EMWCS_IssueSeverity::Warning, TEXT("Spec.MissingBindings"), TEXT("Bindings missing or invalid; continuing."), Context);
+        OutSpec.Design.Add(MWCS_ToFName(Entry.Name), MWCS_ToJsonValue(Entry.Properties)->AsObject());
     }
 
-    // Support both:
-    //   - "Hierarchy": { "Type": ..., "Name": ..., "Children": [...] }
-    //   - "Hierarchy": { "Root": { "Type": ..., ... } }
-    const TSharedPtr<FJsonObject> *HierarchyRootObj = nullptr;
-    if ((*HierarchyObj)->HasTypedField<EJson::Object>(TEXT("Root")) && (*HierarchyObj)->TryGetObjectField(TEXT("Root"), HierarchyRootObj) && HierarchyRootObj && HierarchyRootObj->IsValid())
+    OutSpec.Dependencies.Reset();
+    for (const std::string &Dependency : CoreSpec.Dependencies)
     {
-        // ok
-    }
-    else
-    {
-        HierarchyRootObj = HierarchyObj;
+        OutSpec.Dependencies.Add(MWCS_ToFString(Dependency));
     }
+    return true;
+}
 
-    FMWCS_HierarchyNode RootNode;
-    if (!ParseHierarchyNode(*HierarchyRootObj, RootNode))
-    {
-        AddIssue(InOutReport, EMWCS_IssueSeverity::Error, TEXT("Spec.InvalidHierarchy"), TEXT("Hierarchy root node is invalid."), Context);
-        return false;
-    }
+bool FMWCS_SpecParser::ParseSpecSource(const FMWCS_SpecSource &Source, FMWCS_WidgetSpec &OutSpec, FMWCS_Report &InOutReport)
+{
+    return Source.Root.IsValid() ? ParseSpecNode(*Source.Root, OutSpec, InOutReport, Source.Context) : ParseSpecJson(Source.Json, OutSpec, InOutReport, Source.Context);
+}
 
-    OutSpec.BlueprintName = FName(*BlueprintName);
-    OutSpec.ParentClassPath = ParentClass;
-    OutSpec.Version = Version;
-    if (!ParseDesignerPreview(RootObj, OutSpec.DesignerPreview, InOutReport, Context))
+bool FMWCS_SpecParser::LintSpecJson(const FString &JsonString, FMWCS_Report &InOutReport, const FString &Context)
+{
+    MWCS_Core::FWidgetSpec CoreSpec;
+    if (!MWCS_ParseCoreSpec(JsonString, CoreSpec, InOutReport, Context))
     {
         return false;
     }
-    OutSpec.HierarchyRoot = MoveTemp(RootNode);
-    OutSpec.Bindings = MoveTemp(Bindings);
 
-    ParseDesign(RootObj, OutSpec.Design);
-    ParseDependencies(RootObj, OutSpec.Dependencies);
+    std::vector<MWCS_Core::FDiagnostic> Diagnostics;
+    MWCS_Core::LintSpec(CoreSpec, Diagnostics);
+    MWCS_AddCoreDiagnostics(Diagnostics, InOutReport, Context);
     return true;
 }
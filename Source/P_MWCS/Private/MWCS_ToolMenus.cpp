@@ -1,12 +1,97 @@
 #include "MWCS_ToolMenus.h"
 
+#include "MWCS_Report.h"
+#include "MWCS_Service.h"
 #include "MWCS_ToolTab.h"
+#include "MWCS_WidgetExtractor.h"
 
+#include "ContentBrowserMenuContexts.h"
+#include "Framework/Notifications/NotificationManager.h"
 #include "ToolMenus.h"
+#include "WidgetBlueprint.h"
+#include "Widgets/Notifications/SNotificationList.h"
 
 static void *GMWCSMenuOwner = nullptr;
 static FDelegateHandle GMWCS_MenuRegistrationHandle;
 
+static void MWCS_NotifyReport(const FString &Title, const FMWCS_Report &Report)
+{
+    for (const FMWCS_Issue &Issue : Report.Issues)
+    {
+        if (Issue.Severity == EMWCS_IssueSeverity::Error)
+        {
+            UE_LOG(LogTemp, Error, TEXT("MWCS[%s] %s | %s"), *Issue.Code, *Issue.Context, *Issue.Message);
+        }
+        else if (Issue.Severity == EMWCS_IssueSeverity::Warning)
+        {
+            UE_LOG(LogTemp, Warning, TEXT("MWCS[%s] %s | %s"), *Issue.Code, *Issue.Context, *Issue.Message);
+        }
+    }
+
+    FNotificationInfo Info(FText::FromString(FString::Printf(TEXT("MWCS %s: %d spec(s), %d error(s), %d warning(s)"),
+                                                             *Title, Report.SpecsProcessed, Report.NumErrors(), Report.NumWarnings())));
+    Info.ExpireDuration = 5.0f;
+    FSlateNotificationManager::Get().AddNotification(Info);
+}
+
+static void MWCS_ExtractAssets(const TArray<FAssetData> &Assets)
+{
+    FMWCS_Report Report;
+    for (const FAssetData &Asset : Assets)
+    {
+        if (UWidgetBlueprint *WidgetBP = Cast<UWidgetBlueprint>(Asset.GetAsset()))
+        {
+            FString Written;
+            if (FMWCS_WidgetExtractor::ExtractToFile(WidgetBP, FMWCS_ExtractOptions(), FString(), Written, Report))
+            {
+                Report.SpecsProcessed++;
+                UE_LOG(LogTemp, Display, TEXT("MWCS: extracted %s -> %s"), *WidgetBP->GetPathName(), *Written);
+            }
+        }
+    }
+    MWCS_NotifyReport(TEXT("Extract"), Report);
+}
+
+// Validate / Repair / Extract for the selected Widget Blueprints. Validate and Repair only invoke the providers
+// the asset index maps the selection to.
+static void MWCS_AddAssetContextMenuEntries(FToolMenuSection &Section)
+{
+    const UContentBrowserAssetContextMenuContext *Context = Section.FindContext<UContentBrowserAssetContextMenuContext>();
+    if (!Context || Context->SelectedAssets.Num() == 0)
+    {
+        return;
+    }
+
+    const TArray<FAssetData> Assets = Context->SelectedAssets;
+    TArray<FString> AssetPaths;
+    for (const FAssetData &Asset : Assets)
+    {
+        AssetPaths.Add(Asset.PackageName.ToString());
+    }
+
+    Section.AddMenuEntry(
+        TEXT("MWCS.ValidateSelected"),
+        FText::FromString(TEXT("MWCS: Validate Selected")),
+        FText::FromString(TEXT("Validate the selected widgets against the specs of the providers that generated them")),
+        FSlateIcon(),
+        FUIAction(FExecuteAction::CreateLambda([AssetPaths]()
+                                               { MWCS_NotifyReport(TEXT("Validate"), FMWCS_Service::Get().ValidateAssets(AssetPaths)); })));
+    Section.AddMenuEntry(
+        TEXT("MWCS.RepairSelected"),
+        FText::FromString(TEXT("MWCS: Repair Selected")),
+        FText::FromString(TEXT("Rebuild only the selected widgets from their specs")),
+        FSlateIcon(),
+        FUIAction(FExecuteAction::CreateLambda([AssetPaths]()
+                                               { MWCS_NotifyReport(TEXT("Repair"), FMWCS_Service::Get().BuildAssets(EMWCS_BuildMode::Repair, AssetPaths)); })));
+    Section.AddMenuEntry(
+        TEXT("MWCS.ExtractSelected"),
+        FText::FromString(TEXT("MWCS: Extract Selected")),
+        FText::FromString(TEXT("Write a spec JSON for each selected widget to Saved/MWCS/ExtractedSpecs")),
+        FSlateIcon(),
+        FUIAction(FExecuteAction::CreateLambda([Assets]()
+                                               { MWCS_ExtractAssets(Assets); })));
+}
+
 static void RegisterMWCSMenus()
 {
     if (!GMWCSMenuOwner)
@@ -23,6 +108,11 @@ static void RegisterMWCSMenus()
         FText::FromString(TEXT("Open Modular Widget Creation System")),
         FSlateIcon(),
         FUIAction(FExecuteAction::CreateStatic(&FMWCS_ToolTab::Open)));
+
+    UToolMenu *AssetMenu = UToolMenus::Get()->ExtendMenu(TEXT("ContentBrowser.AssetContextMenu.WidgetBlueprint"));
+    FToolMenuSection &AssetSection = AssetMenu->FindOrAddSection(TEXT("MWCSAssetActions"));
+    AssetSection.Label = FText::FromString(TEXT("MWCS"));
+    AssetSection.AddDynamicEntry(TEXT("MWCS.AssetActions"), FNewToolMenuSectionDelegate::CreateStatic(&MWCS_AddAssetContextMenuEntries));
 }
 
 FDelegateHandle MWCS_RegisterToolMenus(void *Owner)
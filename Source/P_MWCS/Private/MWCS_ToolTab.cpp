@@ -1,5 +1,6 @@
 #include "MWCS_ToolTab.h"
 
+#include "MWCS_LogView.h"
 #include "MWCS_Service.h"
 
 #include "Framework/Docking/TabManager.h"
@@ -9,7 +10,7 @@
 #include "Widgets/Layout/SScrollBox.h"
 #include "Widgets/Layout/SSeparator.h"
 #include "Widgets/SBoxPanel.h"
-#include "Widgets/Input/SMultiLineEditableTextBox.h"
+#include "Widgets/Notifications/SProgressBar.h"
 #include "Widgets/Text/STextBlock.h"
 
 const FName FMWCS_ToolTab::TabName(TEXT("MWCS.ToolTab"));
@@ -23,64 +24,101 @@ public:
     void Construct(const FArguments &InArgs)
     {
         ChildSlot
-            [SNew(SVerticalBox) + SVerticalBox::Slot().AutoHeight().Padding(8)[SNew(STextBlock).Text(FText::FromString(TEXT("MWCS — Modular Widget Creation System")))] + SVerticalBox::Slot().AutoHeight().Padding(8)[SNew(SHorizontalBox) + SHorizontalBox::Slot().AutoWidth().Padding(2)[SNew(SButton).Text(FText::FromString(TEXT("Validate"))).OnClicked(this, &SMWCS_ToolPanel::OnValidate)] + SHorizontalBox::Slot().AutoWidth().Padding(2)[SNew(SButton).Text(FText::FromString(TEXT("Create Missing"))).OnClicked(this, &SMWCS_ToolPanel::OnCreateMissing)] + SHorizontalBox::Slot().AutoWidth().Padding(2)[SNew(SButton).Text(FText::FromString(TEXT("Repair"))).OnClicked(this, &SMWCS_ToolPanel::OnRepair)] + SHorizontalBox::Slot().AutoWidth().Padding(2)[SNew(SButton).Text(FText::FromString(TEXT("Force Recreate"))).OnClicked(this, &SMWCS_ToolPanel::OnForceRecreate)] + SHorizontalBox::Slot().AutoWidth().Padding(2)[SNew(SButton).Text(FText::FromString(TEXT("Generate/Repair Tool EUW"))).OnClicked(this, &SMWCS_ToolPanel::OnGenerateToolEuw)]] + SVerticalBox::Slot().AutoHeight().Padding(8)[SNew(SSeparator)] + SVerticalBox::Slot().FillHeight(1.0f).Padding(8)[SAssignNew(LogBox, SMultiLineEditableTextBox).IsReadOnly(true).Text(FText::FromString(TEXT("")))]];
+            [SNew(SVerticalBox) + SVerticalBox::Slot().AutoHeight().Padding(8)[SNew(STextBlock).Text(FText::FromString(TEXT("MWCS — Modular Widget Creation System")))] + SVerticalBox::Slot().AutoHeight().Padding(8)[SNew(SHorizontalBox) + SHorizontalBox::Slot().AutoWidth().Padding(2)[SNew(SButton).Text(FText::FromString(TEXT("Validate"))).IsEnabled(this, &SMWCS_ToolPanel::IsIdle).OnClicked(this, &SMWCS_ToolPanel::OnValidate)] + SHorizontalBox::Slot().AutoWidth().Padding(2)[SNew(SButton).Text(FText::FromString(TEXT("Create Missing"))).IsEnabled(this, &SMWCS_ToolPanel::IsIdle).OnClicked(this, &SMWCS_ToolPanel::OnCreateMissing)] + SHorizontalBox::Slot().AutoWidth().Padding(2)[SNew(SButton).Text(FText::FromString(TEXT("Repair"))).IsEnabled(this, &SMWCS_ToolPanel::IsIdle).OnClicked(this, &SMWCS_ToolPanel::OnRepair)] + SHorizontalBox::Slot().AutoWidth().Padding(2)[SNew(SButton).Text(FText::FromString(TEXT("Force Recreate"))).IsEnabled(this, &SMWCS_ToolPanel::IsIdle).OnClicked(this, &SMWCS_ToolPanel::OnForceRecreate)] + SHorizontalBox::Slot().AutoWidth().Padding(2)[SNew(SButton).Text(FText::FromString(TEXT("Generate/Repair Tool EUW"))).IsEnabled(this, &SMWCS_ToolPanel::IsIdle).OnClicked(this, &SMWCS_ToolPanel::OnGenerateToolEuw)]] + SVerticalBox::Slot().AutoHeight().Padding(8, 0)[SNew(SHorizontalBox) + SHorizontalBox::Slot().FillWidth(1.0f).VAlign(VAlign_Center).Padding(2)[SNew(SProgressBar).Percent(this, &SMWCS_ToolPanel::GetRunProgress)] + SHorizontalBox::Slot().AutoWidth().VAlign(VAlign_Center).Padding(6, 2)[SNew(STextBlock).Text(this, &SMWCS_ToolPanel::GetRunStatusText)] + SHorizontalBox::Slot().AutoWidth().Padding(2)[SNew(SButton).Text(FText::FromString(TEXT("Cancel"))).IsEnabled(this, &SMWCS_ToolPanel::IsRunActive).OnClicked(this, &SMWCS_ToolPanel::OnCancel)]] + SVerticalBox::Slot().AutoHeight().Padding(8)[SNew(SSeparator)] + SVerticalBox::Slot().FillHeight(1.0f).Padding(8)[SAssignNew(LogView, SMWCS_LogView)]];
     }
 
 private:
-    TSharedPtr<SMultiLineEditableTextBox> LogBox;
+    TSharedPtr<SMWCS_LogView> LogView;
 
     void AppendLine(const FString &Line)
     {
-        if (!LogBox.IsValid())
+        if (LogView.IsValid())
         {
-            return;
+            LogView->AddLine(Line);
         }
-        FString Existing = LogBox->GetText().ToString();
-        if (!Existing.IsEmpty())
+    }
+
+    void AppendReport(const FString &Title, const FMWCS_Report &Report)
+    {
+        if (LogView.IsValid())
         {
-            Existing += TEXT("\n");
+            LogView->AddReport(Title, Report);
         }
-        Existing += Line;
-        LogBox->SetText(FText::FromString(Existing));
     }
 
-    void AppendReport(const FString &Title, const FMWCS_Report &Report)
+    // Progress reflects whichever run is active, including one started from the Tool EUW.
+    bool IsRunActive() const
+    {
+        return FMWCS_Service::Get().GetActiveRun().IsValid();
+    }
+
+    bool IsIdle() const
+    {
+        return !IsRunActive();
+    }
+
+    TOptional<float> GetRunProgress() const
+    {
+        const TSharedPtr<FMWCS_AsyncRun> Run = FMWCS_Service::Get().GetActiveRun();
+        return Run.IsValid() ? Run->GetProgressFraction() : 0.0f;
+    }
+
+    FText GetRunStatusText() const
     {
-        AppendLine(FString::Printf(TEXT("[%s] Specs=%d Created=%d Repaired=%d Recreated=%d Errors=%d Warnings=%d"),
-                                   *Title,
-                                   Report.SpecsProcessed,
-                                   Report.AssetsCreated,
-                                   Report.AssetsRepaired,
-                                   Report.AssetsRecreated,
-                                   Report.NumErrors(),
-                                   Report.NumWarnings()));
-        for (const FMWCS_Issue &Issue : Report.Issues)
+        const TSharedPtr<FMWCS_AsyncRun> Run = FMWCS_Service::Get().GetActiveRun();
+        if (!Run.IsValid())
         {
-            AppendLine(FString::Printf(TEXT("- %s: %s (%s)"), *Issue.Code, *Issue.Message, *Issue.Context));
+            return FText::FromString(TEXT("Idle"));
         }
+        return FText::FromString(FString::Printf(TEXT("%s %d/%d %s"), *Run->GetLabel(), Run->GetNumCompleted(), Run->GetNumTotal(), *Run->GetCurrentSpecName()));
+    }
+
+    void StartRun(const FString &Title, const TSharedPtr<FMWCS_AsyncRun> &Run)
+    {
+        if (!Run.IsValid())
+        {
+            AppendLine(FString::Printf(TEXT("[%s] Another MWCS run is still in progress."), *Title));
+            return;
+        }
+        AppendLine(FString::Printf(TEXT("[%s] Started: %d spec(s)"), *Title, Run->GetNumTotal()));
+        Run->OnFinished.BindSP(this, &SMWCS_ToolPanel::OnRunFinished, Title);
+    }
+
+    void OnRunFinished(const FMWCS_Report &Report, FString Title)
+    {
+        AppendReport(Title, Report);
+    }
+
+    FReply OnCancel()
+    {
+        if (const TSharedPtr<FMWCS_AsyncRun> Run = FMWCS_Service::Get().GetActiveRun())
+        {
+            Run->Cancel();
+        }
+        return FReply::Handled();
     }
 
     FReply OnValidate()
     {
-        AppendReport(TEXT("Validate"), FMWCS_Service::Get().ValidateAll());
+        StartRun(TEXT("Validate"), FMWCS_Service::Get().StartValidateAll());
         return FReply::Handled();
     }
 
     FReply OnCreateMissing()
     {
-        AppendReport(TEXT("CreateMissing"), FMWCS_Service::Get().BuildAll(EMWCS_BuildMode::CreateMissing));
+        StartRun(TEXT("CreateMissing"), FMWCS_Service::Get().StartBuildAll(EMWCS_BuildMode::CreateMissing));
         return FReply::Handled();
     }
 
     FReply OnRepair()
     {
-        AppendReport(TEXT("Repair"), FMWCS_Service::Get().BuildAll(EMWCS_BuildMode::Repair));
+        StartRun(TEXT("Repair"), FMWCS_Service::Get().StartBuildAll(EMWCS_BuildMode::Repair));
         return FReply::Handled();
     }
 
     FReply OnForceRecreate()
     {
-        AppendReport(TEXT("ForceRecreate"), FMWCS_Service::Get().BuildAll(EMWCS_BuildMode::ForceRecreate));
+        StartRun(TEXT("ForceRecreate"), FMWCS_Service::Get().StartBuildAll(EMWCS_BuildMode::ForceRecreate));
         return FReply::Handled();
     }
 
@@ -40,8 +40,18 @@ FString UMWCS_ToolWidgetSpecProvider::GetWidgetSpec()
 					{ "Type": "Button", "Name": "Btn_ExtractSelectedWBP", "Slot": { "Padding": [2, 0, 2, 0] }, "Children": [ { "Type": "TextBlock", "Name": "Txt_ExtractSelectedWBP", "Text": "Extract Selected WBP", "FontSize": 13, "Justification": "Center", "Slot": { "HAlign": "Center", "VAlign": "Center", "Padding": [10, 4, 10, 4] } } ] }
 				]
 			},
+			{
+				"Type": "HorizontalBox",
+				"Name": "ProgressRow",
+				"Slot": { "Padding": [8, 0, 8, 8] },
+				"Children": [
+					{ "Type": "ProgressBar", "Name": "RunProgress", "Slot": { "Fill": 1, "VAlign": "Center" } },
+					{ "Type": "TextBlock", "Name": "RunStatusText", "Text": "Idle", "FontSize": 12, "Slot": { "VAlign": "Center", "Padding": [6, 0, 6, 0] } },
+					{ "Type": "Button", "Name": "Btn_Cancel", "Slot": { "Padding": [2, 0, 2, 0] }, "Children": [ { "Type": "TextBlock", "Name": "Txt_Cancel", "Text": "Cancel", "FontSize": 13, "Justification": "Center", "Slot": { "HAlign": "Center", "VAlign": "Center", "Padding": [10, 4, 10, 4] } } ] }
+				]
+			},
 			{ "Type": "TextBlock", "Name": "SettingsSummaryText", "Text": "", "FontSize": 12, "Slot": { "Padding": [8, 0, 8, 8] } },
-			{ "Type": "MultiLineEditableTextBox", "Name": "OutputLog", "Slot": { "Padding": [8, 0, 8, 8], "Size": { "Rule": "Fill", "Value": 1 } } }
+			{ "Type": "NativeWidgetHost", "Name": "LogHost", "Slot": { "Padding": [8, 0, 8, 8], "Size": { "Rule": "Fill", "Value": 1 } } }
 		]
 	}
 }
@@ -1,6 +1,8 @@
 #include "MWCS_WidgetBuilder.h"
 
+#include "MWCS_AssetIndex.h"
 #include "MWCS_Settings.h"
+#include "MWCS_SpecOptimizer.h"
 
 #include "UObject/SavePackage.h"
 
@@ -30,7 +32,9 @@
 #include "Components/HorizontalBox.h"
 #include "Components/Image.h"
 #include "Components/MultiLineEditableTextBox.h"
+#include "Components/NativeWidgetHost.h"
 #include "Components/Overlay.h"
+#include "Components/ProgressBar.h"
 #include "Components/Spacer.h"
 #include "Components/TextBlock.h"
 #include "Components/Throbber.h"
@@ -194,6 +198,10 @@ static UWidget *ConstructWidget(UWidgetTree *Tree, const FMWCS_HierarchyNode &No
         WidgetClass = UThrobber::StaticClass();
     else if (Type == TEXT("ComboBoxString"))
         WidgetClass = UComboBoxString::StaticClass();
+    else if (Type == TEXT("ProgressBar"))
+        WidgetClass = UProgressBar::StaticClass();
+    else if (Type == TEXT("NativeWidgetHost"))
+        WidgetClass = UNativeWidgetHost::StaticClass();
     else if (Type == TEXT("WidgetSwitcher"))
         WidgetClass = UWidgetSwitcher::StaticClass();
     else if (Type == TEXT("UserWidget"))
@@ -252,6 +260,10 @@ static UClass *GetWidgetClassForType(const FName Type)
         return UThrobber::StaticClass();
     if (Type == TEXT("ComboBoxString"))
         return UComboBoxString::StaticClass();
+    if (Type == TEXT("ProgressBar"))
+        return UProgressBar::StaticClass();
+    if (Type == TEXT("NativeWidgetHost"))
+        return UNativeWidgetHost::StaticClass();
     if (Type == TEXT("WidgetSwitcher"))
         return UWidgetSwitcher::StaticClass();
     if (Type == TEXT("UserWidget"))
@@ -851,6 +863,17 @@ static void ApplyDesignMeta(UWidget *Widget, const TSharedPtr<FJsonObject> &Desi
         return;
     }
 
+    // Any widget: "Visibility": "HitTestInvisible" etc. (ESlateVisibility names, case-insensitive).
+    FString VisibilityStr;
+    if (DesignObj->TryGetStringField(TEXT("Visibility"), VisibilityStr))
+    {
+        const int64 Value = StaticEnum<ESlateVisibility>()->GetValueByNameString(VisibilityStr);
+        if (Value != INDEX_NONE)
+        {
+            Widget->SetVisibility(static_cast<ESlateVisibility>(Value));
+        }
+    }
+
     if (UButton *Button = Cast<UButton>(Widget))
     {
         bool bIsFocusable = Button->GetIsFocusable();
@@ -1103,7 +1126,7 @@ static bool ApplyDesignerPreviewMetadata(UWidgetBlueprint *Blueprint, const FMWC
 #endif
 }
 
-static bool CompileAndSave(UWidgetBlueprint *Blueprint, const FMWCS_WidgetSpec &Spec, FMWCS_Report &Report, const FString &Context)
+static bool CompileAndSave(UWidgetBlueprint *Blueprint, const FMWCS_WidgetSpec &Spec, const FMWCS_BuildOptions &Options, FMWCS_Report &Report, const FString &Context)
 {
     if (!Blueprint)
     {
@@ -1130,6 +1153,11 @@ static bool CompileAndSave(UWidgetBlueprint *Blueprint, const FMWCS_WidgetSpec &
         AddIssue(Report, EMWCS_IssueSeverity::Warning, TEXT("Builder.CompileFailed"), TEXT("Blueprint compilation failed; skipping designer preview sizing."), Context);
     }
 
+    if (Options.bSkipSave)
+    {
+        return true;
+    }
+
     UPackage *Package = Blueprint->GetOutermost();
     if (!Package)
     {
@@ -1141,7 +1169,8 @@ static bool CompileAndSave(UWidgetBlueprint *Blueprint, const FMWCS_WidgetSpec &
 
     FSavePackageArgs Args;
     Args.TopLevelFlags = RF_Public | RF_Standalone;
-    Args.SaveFlags = SAVE_None;
+    // Async saves hand serialization off to the file writer; the pipelined scheduler flushes them in batches.
+    Args.SaveFlags = Options.bAsyncSave ? SAVE_Async : SAVE_None;
     const FString Filename = FPackageName::LongPackageNameToFilename(Package->GetName(), FPackageName::GetAssetPackageExtension());
     
     UE_LOG(LogTemp, Warning, TEXT("MWCS: Saving package '%s' to '%s'"), *Package->GetName(), *Filename);
@@ -1220,7 +1249,7 @@ static void ValidateBuiltBindings(UWidgetBlueprint *Blueprint, const FMWCS_Widge
     }
 }
 
-static bool CreateOrUpdateInternal(const FString &PackagePath, const FString &AssetName, UClass *AssetClass, UFactory *Factory, UClass *ParentClass, const FMWCS_WidgetSpec &Spec, EMWCS_BuildMode Mode, FMWCS_Report &Report, const FString &Context)
+static bool CreateOrUpdateInternal(const FString &PackagePath, const FString &AssetName, UClass *AssetClass, UFactory *Factory, UClass *ParentClass, const FMWCS_WidgetSpec &Spec, EMWCS_BuildMode Mode, const FMWCS_BuildOptions &Options, FMWCS_Report &Report, const FString &Context, UWidgetBlueprint **OutBlueprint = nullptr)
 {
     if (!Factory || !AssetClass)
     {
@@ -1256,7 +1285,15 @@ static bool CreateOrUpdateInternal(const FString &PackagePath, const FString &As
     if (bExists && Mode == EMWCS_BuildMode::CreateMissing)
     {
         UE_LOG(LogTemp, Display, TEXT("MWCS: %s -> SKIP (asset already exists): %s"), ModeToString(Mode), *Context);
+        if (!Options.bSkipSave)
+        {
+            FMWCS_AssetIndex::Get().RecordExisting(PackagePath / AssetName, Spec);
+        }
         // CreateMissing should not modify existing assets.
+        if (OutBlueprint)
+        {
+            *OutBlueprint = Cast<UWidgetBlueprint>(Existing.GetAsset());
+        }
         return true;
     }
 
@@ -1359,17 +1396,39 @@ static bool CreateOrUpdateInternal(const FString &PackagePath, const FString &As
 
     TSet<FName> SeenSpecNames;
 
-    if (!BuildNode(Blueprint->WidgetTree, Spec.HierarchyRoot, /*Parent*/ nullptr, ParentClass, RequiredVarNames, ForceVariableNames, Spec.Bindings.Types, Spec.Design, bStrictNaming, SeenSpecNames, Report, Context))
+    // Optional optimizer pass; ValidateBlueprint compares against the same collapsed hierarchy.
+    FMWCS_WidgetSpec OptimizedSpec;
+    const bool bOptimize = FMWCS_SpecOptimizer::IsEnabled(Spec);
+    if (bOptimize)
+    {
+        OptimizedSpec = Spec;
+        TArray<FString> Removed;
+        const int32 NumRemoved = FMWCS_SpecOptimizer::Optimize(OptimizedSpec, &Removed);
+        AddIssue(Report, EMWCS_IssueSeverity::Info, TEXT("Optimizer.Collapsed"),
+                 NumRemoved > 0 ? FString::Printf(TEXT("Removed %d redundant container(s): %s."), NumRemoved, *FString::Join(Removed, TEXT(", "))) : FString(TEXT("Removed 0 redundant containers.")),
+                 Context);
+    }
+
+    if (!BuildNode(Blueprint->WidgetTree, bOptimize ? OptimizedSpec.HierarchyRoot : Spec.HierarchyRoot, /*Parent*/ nullptr, ParentClass, RequiredVarNames, ForceVariableNames, Spec.Bindings.Types, Spec.Design, bStrictNaming, SeenSpecNames, Report, Context))
     {
         return false;
     }
 
     ValidateBuiltBindings(Blueprint, Spec, Report, Context);
 
-    if (!CompileAndSave(Blueprint, Spec, Report, Context))
+    if (!CompileAndSave(Blueprint, Spec, Options, Report, Context))
     {
         return false;
     }
+    if (!Options.bSkipSave)
+    {
+        FMWCS_AssetIndex::Get().Record(PackagePath / AssetName, Spec);
+    }
+
+    if (OutBlueprint)
+    {
+        *OutBlueprint = Blueprint;
+    }
 
     if (!bExists)
     {
@@ -1389,6 +1448,11 @@ static bool CreateOrUpdateInternal(const FString &PackagePath, const FString &As
 }
 
 bool FMWCS_WidgetBuilder::CreateOrUpdateFromSpec(const FMWCS_WidgetSpec &Spec, EMWCS_BuildMode Mode, FMWCS_Report &InOutReport)
+{
+    return CreateOrUpdateFromSpec(Spec, Mode, FMWCS_BuildOptions(), InOutReport);
+}
+
+bool FMWCS_WidgetBuilder::CreateOrUpdateFromSpec(const FMWCS_WidgetSpec &Spec, EMWCS_BuildMode Mode, const FMWCS_BuildOptions &Options, FMWCS_Report &InOutReport, UWidgetBlueprint **OutBlueprint)
 {
     const UMWCS_Settings *Settings = UMWCS_Settings::Get();
     if (!Settings)
@@ -1397,10 +1461,11 @@ bool FMWCS_WidgetBuilder::CreateOrUpdateFromSpec(const FMWCS_WidgetSpec &Spec, E
         return false;
     }
 
+    const FString &OutputRoot = Options.OutputPathOverride.IsEmpty() ? Settings->OutputRootPath : Options.OutputPathOverride;
     FString PackagePath;
-    if (!EnsureValidPackagePath(Settings->OutputRootPath, PackagePath))
+    if (!EnsureValidPackagePath(OutputRoot, PackagePath))
     {
-        AddIssue(InOutReport, EMWCS_IssueSeverity::Error, TEXT("Builder.InvalidOutputPath"), TEXT("OutputRootPath is not a valid long package path."), Settings->OutputRootPath);
+        AddIssue(InOutReport, EMWCS_IssueSeverity::Error, TEXT("Builder.InvalidOutputPath"), TEXT("OutputRootPath is not a valid long package path."), OutputRoot);
         return false;
     }
 
@@ -1423,7 +1488,7 @@ bool FMWCS_WidgetBuilder::CreateOrUpdateFromSpec(const FMWCS_WidgetSpec &Spec, E
     // Create with a safe base parent and reparent before our explicit compile.
     Factory->ParentClass = UUserWidget::StaticClass();
 
-    return CreateOrUpdateInternal(PackagePath, AssetName, UWidgetBlueprint::StaticClass(), Factory.Get(), ParentClass, Spec, Mode, InOutReport, Context);
+    return CreateOrUpdateInternal(PackagePath, AssetName, UWidgetBlueprint::StaticClass(), Factory.Get(), ParentClass, Spec, Mode, Options, InOutReport, Context, OutBlueprint);
 }
 
 bool FMWCS_WidgetBuilder::CreateOrUpdateToolEuwFromSpec(const FMWCS_WidgetSpec &Spec, EMWCS_BuildMode Mode, FMWCS_Report &InOutReport)
@@ -1464,7 +1529,7 @@ bool FMWCS_WidgetBuilder::CreateOrUpdateToolEuwFromSpec(const FMWCS_WidgetSpec &
     }
     Factory->ParentClass = Parent;
 
-    return CreateOrUpdateInternal(PackagePath, AssetName, UEditorUtilityWidgetBlueprint::StaticClass(), Factory.Get(), Parent, Spec, Mode, InOutReport, Context);
+    return CreateOrUpdateInternal(PackagePath, AssetName, UEditorUtilityWidgetBlueprint::StaticClass(), Factory.Get(), Parent, Spec, Mode, FMWCS_BuildOptions(), InOutReport, Context);
 }
 
 bool FMWCS_WidgetBuilder::CreateOrUpdateToolEuwFromSpecWithPath(const FMWCS_WidgetSpec &Spec, const FString &OutputPath, const FString &AssetName, EMWCS_BuildMode Mode, FMWCS_Report &InOutReport)
@@ -1494,6 +1559,6 @@ bool FMWCS_WidgetBuilder::CreateOrUpdateToolEuwFromSpecWithPath(const FMWCS_Widg
     }
     Factory->ParentClass = Parent;
 
-    return CreateOrUpdateInternal(PackagePath, FinalAssetName, UEditorUtilityWidgetBlueprint::StaticClass(), Factory.Get(), Parent, Spec, Mode, InOutReport, Context);
+    return CreateOrUpdateInternal(PackagePath, FinalAssetName, UEditorUtilityWidgetBlueprint::StaticClass(), Factory.Get(), Parent, Spec, Mode, FMWCS_BuildOptions(), InOutReport, Context);
 }
 
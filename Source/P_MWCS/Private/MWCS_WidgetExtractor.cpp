@@ -0,0 +1,1397 @@
+#include "MWCS_WidgetExtractor.h"
+
+#include "MWCS_CanonicalJson.h"
+#include "MWCS_SpecParser.h"
+#include "MWCS_WidgetBuilder.h"
+#include "MWCS_WidgetSpec.h"
+
+#include "MWCS_Utilities.h"
+using namespace MWCS_Utilities;
+
+#include "WidgetBlueprint.h"
+#include "Blueprint/UserWidget.h"
+#include "Blueprint/WidgetBlueprintGeneratedClass.h"
+#include "Blueprint/WidgetTree.h"
+
+#include "Components/Border.h"
+#include "Components/BorderSlot.h"
+#include "Components/Button.h"
+#include "Components/ButtonSlot.h"
+#include "Components/CanvasPanel.h"
+#include "Components/CanvasPanelSlot.h"
+#include "Components/ComboBoxString.h"
+#include "Components/ContentWidget.h"
+#include "Components/HorizontalBox.h"
+#include "Components/HorizontalBoxSlot.h"
+#include "Components/Image.h"
+#include "Components/MultiLineEditableTextBox.h"
+#include "Components/NativeWidgetHost.h"
+#include "Components/Overlay.h"
+#include "Components/OverlaySlot.h"
+#include "Components/PanelWidget.h"
+#include "Components/ProgressBar.h"
+#include "Components/ScrollBox.h"
+#include "Components/ScrollBoxSlot.h"
+#include "Components/Spacer.h"
+#include "Components/TextBlock.h"
+#include "Components/Throbber.h"
+#include "Components/VerticalBox.h"
+#include "Components/VerticalBoxSlot.h"
+#include "Components/Widget.h"
+#include "Components/WidgetSwitcher.h"
+
+#include "UObject/UnrealType.h"
+
+#include "Dom/JsonObject.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+
+#include "AssetRegistry/AssetData.h"
+#include "Async/Async.h"
+#include "Async/ParallelFor.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/PackageName.h"
+#include "Misc/Paths.h"
+#include "Misc/SecureHash.h"
+#include "Serialization/JsonReader.h"
+#include "UObject/UObjectGlobals.h"
+
+static FString MWCS_NormalizeWidgetType(const UWidget *Widget)
+{
+    if (!Widget)
+    {
+        return TEXT("<null>");
+    }
+
+    // Prefer MWCS-supported base widget type names so the exported spec can be re-built.
+    if (Widget->IsA<UCanvasPanel>())
+        return TEXT("CanvasPanel");
+    if (Widget->IsA<UVerticalBox>())
+        return TEXT("VerticalBox");
+    if (Widget->IsA<UHorizontalBox>())
+        return TEXT("HorizontalBox");
+    if (Widget->IsA<UOverlay>())
+        return TEXT("Overlay");
+    if (Widget->IsA<UBorder>())
+        return TEXT("Border");
+    if (Widget->IsA<UButton>())
+        return TEXT("Button");
+    if (Widget->IsA<UTextBlock>())
+        return TEXT("TextBlock");
+    if (Widget->IsA<UImage>())
+        return TEXT("Image");
+    if (Widget->IsA<USpacer>())
+        return TEXT("Spacer");
+    if (Widget->IsA<UMultiLineEditableTextBox>())
+        return TEXT("MultiLineEditableTextBox");
+    if (Widget->IsA<UScrollBox>())
+        return TEXT("ScrollBox");
+    if (Widget->IsA<UThrobber>())
+        return TEXT("Throbber");
+    if (Widget->IsA<UComboBoxString>())
+        return TEXT("ComboBoxString");
+    if (Widget->IsA<UProgressBar>())
+        return TEXT("ProgressBar");
+    if (Widget->IsA<UNativeWidgetHost>())
+        return TEXT("NativeWidgetHost");
+    if (Widget->IsA<UWidgetSwitcher>())
+        return TEXT("WidgetSwitcher");
+    if (Widget->IsA<UUserWidget>())
+        return TEXT("UserWidget");
+
+    FString Type = Widget->GetClass()->GetName();
+    if (Type.StartsWith(TEXT("U")))
+    {
+        Type.RightChopInline(1);
+    }
+
+    if (Type.EndsWith(TEXT("Widget")))
+    {
+        Type.LeftChopInline(6);
+    }
+
+    return Type;
+}
+
+static bool MWCS_TryGetBoolPropertyValue(const UObject *Obj, const FName PropertyName, bool &bOutValue)
+{
+    if (!Obj)
+    {
+        return false;
+    }
+
+    const FProperty *Prop = Obj->GetClass()->FindPropertyByName(PropertyName);
+    const FBoolProperty *BoolProp = CastField<FBoolProperty>(Prop);
+    if (!BoolProp)
+    {
+        return false;
+    }
+
+    bOutValue = BoolProp->GetPropertyValue_InContainer(Obj);
+    return true;
+}
+
+static bool MWCS_TryGetBytePropertyValue(const UObject *Obj, const FName PropertyName, uint8 &OutValue)
+{
+    if (!Obj)
+    {
+        return false;
+    }
+
+    const FProperty *Prop = Obj->GetClass()->FindPropertyByName(PropertyName);
+    const FByteProperty *ByteProp = CastField<FByteProperty>(Prop);
+    if (!ByteProp)
+    {
+        return false;
+    }
+
+    OutValue = ByteProp->GetPropertyValue_InContainer(Obj);
+    return true;
+}
+
+// Minimal extraction: true when Obj's property differs from its class default object. Unknown properties count
+// as overridden so nothing is dropped by accident.
+static bool MWCS_IsOverridden(const UObject *Obj, const TCHAR *PropertyName)
+{
+    if (!Obj)
+    {
+        return false;
+    }
+    const UObject *Defaults = Obj->GetClass()->GetDefaultObject();
+    const FProperty *Prop = Obj->GetClass()->FindPropertyByName(PropertyName);
+    if (!Defaults || !Prop)
+    {
+        return true;
+    }
+    return !Prop->Identical_InContainer(Obj, Defaults);
+}
+
+// Full extraction writes every field; minimal extraction only fields whose property is overridden.
+static bool MWCS_ShouldWrite(bool bMinimal, const UObject *Obj, const TCHAR *PropertyName)
+{
+    return !bMinimal || MWCS_IsOverridden(Obj, PropertyName);
+}
+
+static void MWCS_WriteMarginObject4(FMWCS_CanonicalJsonWriter &Writer, const TCHAR *Field, const FMargin &M)
+{
+    Writer.BeginObject(Field);
+    Writer.Write(TEXT("Left"), M.Left);
+    Writer.Write(TEXT("Top"), M.Top);
+    Writer.Write(TEXT("Right"), M.Right);
+    Writer.Write(TEXT("Bottom"), M.Bottom);
+    Writer.EndObject();
+}
+
+static void MWCS_WriteVector2Object(FMWCS_CanonicalJsonWriter &Writer, const TCHAR *Field, const FVector2D &V)
+{
+    Writer.BeginObject(Field);
+    Writer.Write(TEXT("X"), V.X);
+    Writer.Write(TEXT("Y"), V.Y);
+    Writer.EndObject();
+}
+
+static void MWCS_WriteColorObject(FMWCS_CanonicalJsonWriter &Writer, const TCHAR *Field, const FLinearColor &C)
+{
+    Writer.BeginObject(Field);
+    Writer.Write(TEXT("R"), C.R);
+    Writer.Write(TEXT("G"), C.G);
+    Writer.Write(TEXT("B"), C.B);
+    Writer.Write(TEXT("A"), C.A);
+    Writer.EndObject();
+}
+
+static void MWCS_WritePaddingMinimal(FMWCS_CanonicalJsonWriter &Writer, const TCHAR *Field, const FMargin &M)
+{
+    if (FMath::IsNearlyZero(M.Left) && FMath::IsNearlyZero(M.Top) && FMath::IsNearlyZero(M.Right) && FMath::IsNearlyZero(M.Bottom))
+    {
+        return;
+    }
+
+    Writer.BeginObject(Field);
+    if (!FMath::IsNearlyZero(M.Left))
+        Writer.Write(TEXT("Left"), M.Left);
+    if (!FMath::IsNearlyZero(M.Top))
+        Writer.Write(TEXT("Top"), M.Top);
+    if (!FMath::IsNearlyZero(M.Right))
+        Writer.Write(TEXT("Right"), M.Right);
+    if (!FMath::IsNearlyZero(M.Bottom))
+        Writer.Write(TEXT("Bottom"), M.Bottom);
+    Writer.EndObject();
+}
+
+static FString MWCS_HAlignToString(EHorizontalAlignment Align)
+{
+    switch (Align)
+    {
+    case HAlign_Left:
+        return TEXT("Left");
+    case HAlign_Center:
+        return TEXT("Center");
+    case HAlign_Right:
+        return TEXT("Right");
+    case HAlign_Fill:
+    default:
+        return TEXT("Fill");
+    }
+}
+
+static FString MWCS_VAlignToString(EVerticalAlignment Align)
+{
+    switch (Align)
+    {
+    case VAlign_Top:
+        return TEXT("Top");
+    case VAlign_Center:
+        return TEXT("Center");
+    case VAlign_Bottom:
+        return TEXT("Bottom");
+    case VAlign_Fill:
+    default:
+        return TEXT("Fill");
+    }
+}
+
+static void MWCS_ExportSlotLayout(UWidget *Widget, FMWCS_CanonicalJsonWriter &Writer, bool bIncludeSlotLayout, bool bIncludeCanvasSlot, bool bMinimal)
+{
+    if (!bIncludeSlotLayout || !Widget)
+    {
+        return;
+    }
+
+    UPanelSlot *Slot = Widget->Slot;
+    if (!Slot)
+    {
+        return;
+    }
+
+    // Dropped again by EndObject when nothing was written.
+    Writer.BeginObject(TEXT("Slot"));
+
+    auto WriteSlotSizeObj = [&Writer, Slot, bMinimal](const FSlateChildSize &Size)
+    {
+        if (!MWCS_ShouldWrite(bMinimal, Slot, TEXT("Size")))
+        {
+            return;
+        }
+        Writer.BeginObject(TEXT("Size"));
+        if (Size.SizeRule == ESlateSizeRule::Fill)
+        {
+            Writer.Write(TEXT("Rule"), TEXT("Fill"));
+            Writer.Write(TEXT("Value"), Size.Value);
+        }
+        else
+        {
+            Writer.Write(TEXT("Rule"), TEXT("Auto"));
+        }
+        Writer.EndObject();
+    };
+
+    auto WritePaddingHAlignVAlign = [&Writer, Slot, bMinimal](const FMargin &Padding, EHorizontalAlignment HAlign, EVerticalAlignment VAlign, bool bHasPadding, bool bHasH, bool bHasV)
+    {
+        if (bHasPadding && MWCS_ShouldWrite(bMinimal, Slot, TEXT("Padding")))
+        {
+            // An overridden padding may be all zeros, which the compact form would drop.
+            if (bMinimal)
+            {
+                MWCS_WriteMarginObject4(Writer, TEXT("Padding"), Padding);
+            }
+            else
+            {
+                MWCS_WritePaddingMinimal(Writer, TEXT("Padding"), Padding);
+            }
+        }
+        if (bHasH && MWCS_ShouldWrite(bMinimal, Slot, TEXT("HorizontalAlignment")))
+        {
+            Writer.Write(TEXT("HAlign"), MWCS_HAlignToString(HAlign));
+        }
+        if (bHasV && MWCS_ShouldWrite(bMinimal, Slot, TEXT("VerticalAlignment")))
+        {
+            Writer.Write(TEXT("VAlign"), MWCS_VAlignToString(VAlign));
+        }
+    };
+
+    if (UHorizontalBoxSlot *HB = Cast<UHorizontalBoxSlot>(Slot))
+    {
+        WritePaddingHAlignVAlign(HB->GetPadding(), HB->GetHorizontalAlignment(), HB->GetVerticalAlignment(), true, true, true);
+
+        WriteSlotSizeObj(HB->GetSize());
+    }
+    else if (UVerticalBoxSlot *VB = Cast<UVerticalBoxSlot>(Slot))
+    {
+        WritePaddingHAlignVAlign(VB->GetPadding(), VB->GetHorizontalAlignment(), VB->GetVerticalAlignment(), true, true, true);
+
+        WriteSlotSizeObj(VB->GetSize());
+    }
+    else if (UOverlaySlot *OV = Cast<UOverlaySlot>(Slot))
+    {
+        WritePaddingHAlignVAlign(OV->GetPadding(), OV->GetHorizontalAlignment(), OV->GetVerticalAlignment(), true, true, true);
+    }
+    else if (UBorderSlot *BS = Cast<UBorderSlot>(Slot))
+    {
+        WritePaddingHAlignVAlign(BS->GetPadding(), BS->GetHorizontalAlignment(), BS->GetVerticalAlignment(), true, true, true);
+    }
+    else if (UScrollBoxSlot *SS = Cast<UScrollBoxSlot>(Slot))
+    {
+        WritePaddingHAlignVAlign(SS->GetPadding(), SS->GetHorizontalAlignment(), SS->GetVerticalAlignment(), true, true, true);
+
+        WriteSlotSizeObj(SS->GetSize());
+    }
+    else if (UButtonSlot *BtnSlot = Cast<UButtonSlot>(Slot))
+    {
+        WritePaddingHAlignVAlign(BtnSlot->GetPadding(), BtnSlot->GetHorizontalAlignment(), BtnSlot->GetVerticalAlignment(), true, true, true);
+    }
+
+    if (bIncludeCanvasSlot)
+    {
+        if (UCanvasPanelSlot *CS = Cast<UCanvasPanelSlot>(Slot))
+        {
+            // LayoutData is one property, so minimal extraction compares its parts with the default slot.
+            const UCanvasPanelSlot *DefaultCS = bMinimal ? CastChecked<UCanvasPanelSlot>(CS->GetClass()->GetDefaultObject()) : nullptr;
+
+            // Match GetWidgetSpec slot format used in project: Anchors/Position/Size/Alignment
+            if (!DefaultCS || !(CS->GetAnchors() == DefaultCS->GetAnchors()))
+            {
+                const FAnchors Anchors = CS->GetAnchors();
+                Writer.BeginObject(TEXT("Anchors"));
+                MWCS_WriteVector2Object(Writer, TEXT("Min"), FVector2D(Anchors.Minimum.X, Anchors.Minimum.Y));
+                MWCS_WriteVector2Object(Writer, TEXT("Max"), FVector2D(Anchors.Maximum.X, Anchors.Maximum.Y));
+                Writer.EndObject();
+            }
+
+            // Position and Size become the offsets together, so they are written as a pair.
+            if (!DefaultCS || !(CS->GetOffsets() == DefaultCS->GetOffsets()))
+            {
+                MWCS_WriteVector2Object(Writer, TEXT("Position"), CS->GetPosition());
+                MWCS_WriteVector2Object(Writer, TEXT("Size"), CS->GetSize());
+            }
+            if (!DefaultCS || !CS->GetAlignment().Equals(DefaultCS->GetAlignment()))
+            {
+                MWCS_WriteVector2Object(Writer, TEXT("Alignment"), CS->GetAlignment());
+            }
+
+            if (CS->GetZOrder() != 0)
+            {
+                Writer.Write(TEXT("ZOrder"), CS->GetZOrder());
+            }
+
+            if (CS->GetAutoSize())
+            {
+                Writer.Write(TEXT("AutoSize"), true);
+            }
+        }
+    }
+
+    Writer.EndObject(/*bOmitIfEmpty*/ true);
+}
+
+// ============================================================================
+// BRUSH EXTRACTION HELPERS
+// ============================================================================
+
+static FString ConvertDrawAsToString(ESlateBrushDrawType::Type DrawAs)
+{
+	switch (DrawAs)
+	{
+		case ESlateBrushDrawType::Image: return TEXT("Image");
+		case ESlateBrushDrawType::Box: return TEXT("Box");
+		case ESlateBrushDrawType::Border: return TEXT("Border");
+		case ESlateBrushDrawType::RoundedBox: return TEXT("RoundedBox");
+		case ESlateBrushDrawType::NoDrawType: return TEXT("NoDrawType");
+		default: return TEXT("Image");
+	}
+}
+
+static FString ConvertTilingToString(ESlateBrushTileType::Type Tiling)
+{
+	switch (Tiling)
+	{
+		case ESlateBrushTileType::NoTile: return TEXT("NoTile");
+		case ESlateBrushTileType::Horizontal: return TEXT("Horizontal");
+		case ESlateBrushTileType::Vertical: return TEXT("Vertical");
+		case ESlateBrushTileType::Both: return TEXT("Both");
+		default: return TEXT("NoTile");
+	}
+}
+
+static void MWCS_ExtractBrushProperties(
+	const FSlateBrush &Brush,
+	FMWCS_CanonicalJsonWriter &Writer,
+	const FString &BrushFieldName = TEXT("Brush"),
+	bool bIncludeImageSize = false)
+{
+	// Dropped again by EndObject when every field is at its default.
+	Writer.BeginObject(BrushFieldName);
+	
+	// DrawAs (if non-default)
+	if (Brush.DrawAs != ESlateBrushDrawType::Image)
+	{
+		Writer.Write(TEXT("DrawAs"), ConvertDrawAsToString(Brush.DrawAs));
+	}
+	
+	// ImageSize (optional - controlled by caller)
+	if (bIncludeImageSize && (Brush.ImageSize.X > 0.01f || Brush.ImageSize.Y > 0.01f))
+	{
+		MWCS_WriteVector2Object(Writer, TEXT("ImageSize"), Brush.ImageSize);
+	}
+	
+	// TintColor (if not default white)
+	const FLinearColor TintColor = Brush.TintColor.GetSpecifiedColor();
+	if (!TintColor.Equals(FLinearColor::White, 0.001f))
+	{
+		MWCS_WriteColorObject(Writer, TEXT("TintColor"), TintColor);
+	}
+	
+	// Tiling (if not NoTile)
+	if (Brush.Tiling != ESlateBrushTileType::NoTile)
+	{
+		Writer.Write(TEXT("Tiling"), ConvertTilingToString(Brush.Tiling));
+	}
+	
+	// Margin (if non-zero)
+	const FMargin &Margin = Brush.Margin;
+	if (Margin.Left > 0.001f || Margin.Top > 0.001f || Margin.Right > 0.001f || Margin.Bottom > 0.001f)
+	{
+		MWCS_WriteMarginObject4(Writer, TEXT("Margin"), Margin);
+	}
+	
+	Writer.EndObject(/*bOmitIfEmpty*/ true);
+}
+
+static void MWCS_TryAddDependency(TSet<FString> &OutDeps, const UObject *Obj)
+{
+    if (!Obj)
+    {
+        return;
+    }
+
+    const FString Path = Obj->GetPathName();
+    if (!Path.IsEmpty())
+    {
+        OutDeps.Add(Path);
+    }
+}
+
+static bool MWCS_TryGetBoolPropertyByName(UObject *Obj, const TCHAR *PropName, bool &OutValue)
+{
+    if (!Obj)
+    {
+        return false;
+    }
+
+    if (FProperty *Prop = Obj->GetClass()->FindPropertyByName(FName(PropName)))
+    {
+        if (FBoolProperty *BoolProp = CastField<FBoolProperty>(Prop))
+        {
+            OutValue = BoolProp->GetPropertyValue_InContainer(Obj);
+            return true;
+        }
+    }
+
+    return false;
+}
+
+static bool MWCS_TryGetIntPropertyByName(UObject *Obj, const TCHAR *PropName, int32 &OutValue)
+{
+    if (!Obj)
+    {
+        return false;
+    }
+
+    if (FProperty *Prop = Obj->GetClass()->FindPropertyByName(FName(PropName)))
+    {
+        if (FIntProperty *IntProp = CastField<FIntProperty>(Prop))
+        {
+            OutValue = IntProp->GetPropertyValue_InContainer(Obj);
+            return true;
+        }
+    }
+
+    return false;
+}
+
+static void MWCS_ExportDesignerPreview(UWidgetBlueprint *WidgetBlueprint, FMWCS_CanonicalJsonWriter &Writer)
+{
+    if (!WidgetBlueprint)
+    {
+        return;
+    }
+
+    // Persistent tier: DesignSizeMode + DesignTimeSize (when Custom)
+    FString SizeModeStr = TEXT("FillScreen");
+    FVector2D CustomSize = FVector2D::ZeroVector;
+
+    if (UWidgetBlueprintGeneratedClass *GeneratedClass = Cast<UWidgetBlueprintGeneratedClass>(WidgetBlueprint->GeneratedClass))
+    {
+        if (UUserWidget *CDO = Cast<UUserWidget>(GeneratedClass->GetDefaultObject()))
+        {
+#if WITH_EDITORONLY_DATA
+            switch (CDO->DesignSizeMode)
+            {
+            case EDesignPreviewSizeMode::Desired:
+                SizeModeStr = TEXT("Desired");
+                break;
+            case EDesignPreviewSizeMode::DesiredOnScreen:
+                SizeModeStr = TEXT("DesiredOnScreen");
+                break;
+            case EDesignPreviewSizeMode::Custom:
+                SizeModeStr = TEXT("Custom");
+                CustomSize = CDO->DesignTimeSize;
+                break;
+            case EDesignPreviewSizeMode::FillScreen:
+            default:
+                SizeModeStr = TEXT("FillScreen");
+                break;
+            }
+#endif
+        }
+    }
+
+    Writer.BeginObject(TEXT("DesignerPreview"));
+    Writer.Write(TEXT("SizeMode"), SizeModeStr);
+    if (SizeModeStr.Equals(TEXT("Custom"), ESearchCase::IgnoreCase) && CustomSize.X > 0.0f && CustomSize.Y > 0.0f)
+    {
+        MWCS_WriteVector2Object(Writer, TEXT("CustomSize"), CustomSize);
+    }
+
+    // Best-effort tier: ZoomLevel + ShowGrid (may not exist on all engine versions)
+    int32 ZoomLevel = 14;
+    bool bShowGrid = true;
+
+    (void)MWCS_TryGetIntPropertyByName(WidgetBlueprint, TEXT("ZoomLevel"), ZoomLevel);
+    (void)MWCS_TryGetIntPropertyByName(WidgetBlueprint, TEXT("DesignerZoomLevel"), ZoomLevel);
+    (void)MWCS_TryGetIntPropertyByName(WidgetBlueprint, TEXT("PreviewZoomLevel"), ZoomLevel);
+
+    (void)MWCS_TryGetBoolPropertyByName(WidgetBlueprint, TEXT("bShowDesignGrid"), bShowGrid);
+    (void)MWCS_TryGetBoolPropertyByName(WidgetBlueprint, TEXT("bShowGrid"), bShowGrid);
+    (void)MWCS_TryGetBoolPropertyByName(WidgetBlueprint, TEXT("bShowDesignerGrid"), bShowGrid);
+
+    Writer.Write(TEXT("ZoomLevel"), ZoomLevel);
+    Writer.Write(TEXT("ShowGrid"), bShowGrid);
+    Writer.EndObject();
+}
+
+static bool MWCS_ExportInlineProperties(UWidget *Widget, FMWCS_CanonicalJsonWriter &Writer, bool bIncludePropertiesSection, bool bMinimal)
+{
+    if (!bIncludePropertiesSection || !Widget)
+{
+    return false;
+}
+
+Writer.BeginObject(TEXT("Properties"));
+
+// Infer properties for VerticalBox (SizeToContent, Spacing)
+if (UVerticalBox *VBox = Cast<UVerticalBox>(Widget))
+{
+    bool bAllAuto = true;
+    float UniformSpacing = -1.0f;
+    bool bUniformSpacing = true;
+    int32 ChildCount = VBox->GetChildrenCount();
+
+    for (int32 i = 0; i < ChildCount; ++i)
+    {
+        if (UWidget *Child = VBox->GetChildAt(i))
+        {
+            if (UVerticalBoxSlot *VBSlot = Cast<UVerticalBoxSlot>(Child->Slot))
+            {
+                if (VBSlot->GetSize().SizeRule != ESlateSizeRule::Automatic)
+                {
+                    bAllAuto = false;
+                }
+
+                // Check uniform spacing (top padding for items after first)
+                // We treat the first item (i=0) as having 0 'spacing' padding usually, or ignore it.
+                // The 'Spacing' property conceptually applies between items.
+                // Implementation: If we see Spacing=N, we expect Child[1].Top=N, Child[2].Top=N...
+
+                float TopPad = VBSlot->GetPadding().Top;
+                if (i == 1)
+                {
+                    UniformSpacing = TopPad;
+                }
+                else if (i > 1)
+                {
+                    if (!FMath::IsNearlyEqual(TopPad, UniformSpacing, 0.001f))
+                    {
+                        bUniformSpacing = false;
+                    }
+                }
+            }
+        }
+    }
+
+    if (bAllAuto && ChildCount > 0)
+    {
+        Writer.Write(TEXT("SizeToContent"), true);
+    }
+
+    // Only emit spacing if we have at least 2 items and positive consistent spacing
+    if (bUniformSpacing && UniformSpacing > 0.001f && ChildCount > 1)
+    {
+        Writer.Write(TEXT("Spacing"), UniformSpacing);
+    }
+}
+// Infer properties for HorizontalBox (SizeToContent, Spacing)
+else if (UHorizontalBox *HBox = Cast<UHorizontalBox>(Widget))
+{
+    bool bAllAuto = true;
+    float UniformSpacing = -1.0f;
+    bool bUniformSpacing = true;
+    int32 ChildCount = HBox->GetChildrenCount();
+
+    for (int32 i = 0; i < ChildCount; ++i)
+    {
+        if (UWidget *Child = HBox->GetChildAt(i))
+        {
+            if (UHorizontalBoxSlot *HBSlot = Cast<UHorizontalBoxSlot>(Child->Slot))
+            {
+                if (HBSlot->GetSize().SizeRule != ESlateSizeRule::Automatic)
+                {
+                    bAllAuto = false;
+                }
+
+                float LeftPad = HBSlot->GetPadding().Left;
+                if (i == 1)
+                {
+                    UniformSpacing = LeftPad;
+                }
+                else if (i > 1)
+                {
+                    if (!FMath::IsNearlyEqual(LeftPad, UniformSpacing, 0.001f))
+                    {
+                        bUniformSpacing = false;
+                    }
+                }
+            }
+        }
+    }
+
+    if (bAllAuto && ChildCount > 0)
+    {
+        Writer.Write(TEXT("SizeToContent"), true);
+    }
+
+    if (bUniformSpacing && UniformSpacing > 0.001f && ChildCount > 1)
+    {
+        Writer.Write(TEXT("Spacing"), UniformSpacing);
+    }
+}
+// ScrollBox Properties
+else if (UScrollBox *SB = Cast<UScrollBox>(Widget))
+{
+    if (SB->GetOrientation() == EOrientation::Orient_Horizontal)
+    {
+        Writer.Write(TEXT("Orientation"), TEXT("Horizontal"));
+    }
+
+    ESlateVisibility Vis = SB->GetScrollBarVisibility();
+    if (Vis != ESlateVisibility::Visible)
+    {
+        FString VisStr;
+        switch (Vis)
+        {
+        case ESlateVisibility::Collapsed:
+            VisStr = TEXT("Collapsed");
+            break;
+        case ESlateVisibility::Hidden:
+            VisStr = TEXT("Hidden");
+            break;
+        case ESlateVisibility::HitTestInvisible:
+            VisStr = TEXT("HitTestInvisible");
+            break;
+        case ESlateVisibility::SelfHitTestInvisible:
+            VisStr = TEXT("SelfHitTestInvisible");
+            break;
+        default:
+            break;
+        }
+        if (!VisStr.IsEmpty())
+        {
+            Writer.Write(TEXT("ScrollBarVisibility"), VisStr);
+        }
+    }
+}
+// Spacer Properties
+else if (USpacer *Sp = Cast<USpacer>(Widget))
+{
+    FVector2D Size = Sp->GetSize();
+    if ((Size.X > 0.0f || Size.Y > 0.0f) && MWCS_ShouldWrite(bMinimal, Sp, TEXT("Size")))
+    {
+        MWCS_WriteVector2Object(Writer, TEXT("Size"), Size);
+    }
+}
+
+    return Writer.EndObject(/*bOmitIfEmpty*/ true);
+}
+
+// Writes one member of the root "Design" map. Design is a separate writer because entries are produced
+// during the hierarchy walk but belong to a sibling of "Hierarchy".
+static void MWCS_ExportDesignEntry(UWidget *Widget,
+                                   FMWCS_CanonicalJsonWriter *DesignWriter,
+                                   TSet<FString> &OutDependencies,
+                                   bool bIncludeDesignSection,
+                                   bool bMinimal)
+{
+    if (!bIncludeDesignSection || !Widget || !DesignWriter)
+    {
+        return;
+    }
+
+    FMWCS_CanonicalJsonWriter &Writer = *DesignWriter;
+    Writer.BeginObject(Widget->GetFName().ToString());
+
+    if (UButton *Button = Cast<UButton>(Widget))
+    {
+        // Match project style: Style.Normal/Hovered/Pressed.TintColor as {R,G,B,A}
+        const FButtonStyle &Style = Button->GetStyle();
+        const FButtonStyle &DefaultStyle = CastChecked<UButton>(Button->GetClass()->GetDefaultObject())->GetStyle();
+        Writer.BeginObject(TEXT("Style"));
+
+        auto AddBrushTint = [&Writer, &OutDependencies, bMinimal](const TCHAR *StateName, const FSlateBrush &Brush, const FSlateBrush &DefaultBrush)
+        {
+            MWCS_TryAddDependency(OutDependencies, Brush.GetResourceObject());
+            if (bMinimal && Brush.TintColor == DefaultBrush.TintColor)
+            {
+                return;
+            }
+
+            // TintColor is FSlateColor; use the specified color if available.
+            Writer.BeginObject(StateName);
+            MWCS_WriteColorObject(Writer, TEXT("TintColor"), Brush.TintColor.GetSpecifiedColor());
+            Writer.EndObject();
+        };
+
+        AddBrushTint(TEXT("Normal"), Style.Normal, DefaultStyle.Normal);
+        AddBrushTint(TEXT("Hovered"), Style.Hovered, DefaultStyle.Hovered);
+        AddBrushTint(TEXT("Pressed"), Style.Pressed, DefaultStyle.Pressed);
+
+        Writer.EndObject(/*bOmitIfEmpty*/ true);
+
+        // Also match spec field
+        if (MWCS_ShouldWrite(bMinimal, Button, TEXT("IsFocusable")))
+        {
+            Writer.Write(TEXT("IsFocusable"), Button->GetIsFocusable());
+        }
+    }
+    else if (UImage *Img = Cast<UImage>(Widget))
+    {
+        const FSlateBrush &Brush = Img->GetBrush();
+        const bool bWriteBrush = MWCS_ShouldWrite(bMinimal, Img, TEXT("Brush"));
+        
+        // Legacy "Size" field (for backward compatibility)
+        if (bWriteBrush && (Brush.ImageSize.X > 0.01f || Brush.ImageSize.Y > 0.01f))
+        {
+            MWCS_WriteVector2Object(Writer, TEXT("Size"), Brush.ImageSize);
+        }
+        
+        // ColorAndOpacity
+        if (MWCS_ShouldWrite(bMinimal, Img, TEXT("ColorAndOpacity")))
+        {
+            MWCS_WriteColorObject(Writer, TEXT("ColorAndOpacity"), Img->GetColorAndOpacity());
+        }
+        
+        // NEW: Complete brush properties  (ImageSize in legacy "Size", not in Brush)
+        if (bWriteBrush)
+        {
+            MWCS_ExtractBrushProperties(Brush, Writer, TEXT("Brush"), false);
+        }
+        
+        MWCS_TryAddDependency(OutDependencies, Brush.GetResourceObject());
+    }
+    else if (UTextBlock *TB = Cast<UTextBlock>(Widget))
+    {
+        const FSlateFontInfo &Font = TB->GetFont();
+        if (Font.Size > 0 && MWCS_ShouldWrite(bMinimal, TB, TEXT("Font")))
+        {
+            Writer.BeginObject(TEXT("Font"));
+            Writer.Write(TEXT("Size"), Font.Size);
+            if (!Font.TypefaceFontName.IsNone())
+            {
+                Writer.Write(TEXT("Typeface"), Font.TypefaceFontName.ToString());
+            }
+            Writer.EndObject();
+        }
+
+        // UTextBlock color is SlateColor; pull specified color.
+        if (MWCS_ShouldWrite(bMinimal, TB, TEXT("ColorAndOpacity")))
+        {
+            MWCS_WriteColorObject(Writer, TEXT("ColorAndOpacity"), TB->GetColorAndOpacity().GetSpecifiedColor());
+        }
+
+        MWCS_TryAddDependency(OutDependencies, Font.FontObject);
+    }
+    else if (UBorder *Border = Cast<UBorder>(Widget))
+    {
+        // Commonly used for panels
+        if (MWCS_ShouldWrite(bMinimal, Border, TEXT("BrushColor")))
+        {
+            MWCS_WriteColorObject(Writer, TEXT("BrushColor"), Border->GetBrushColor());
+        }
+        if (!bMinimal)
+        {
+            MWCS_WritePaddingMinimal(Writer, TEXT("Padding"), Border->GetPadding());
+        }
+        else if (MWCS_IsOverridden(Border, TEXT("Padding")))
+        {
+            MWCS_WriteMarginObject4(Writer, TEXT("Padding"), Border->GetPadding());
+        }
+        MWCS_TryAddDependency(OutDependencies, Border->Background.GetResourceObject());
+    }
+    else if (UThrobber *Throbber = Cast<UThrobber>(Widget))
+    {
+        // NumberOfPieces (if non-default 3)
+        const int32 NumPieces = Throbber->GetNumberOfPieces();
+        if (NumPieces != 3)
+        {
+            Writer.Write(TEXT("NumberOfPieces"), NumPieces);
+        }
+        
+        // Animation flags (only if NOT all true)
+        if (!Throbber->IsAnimateHorizontally())
+        {
+            Writer.Write(TEXT("bAnimateHorizontally"), false);
+        }
+        if (!Throbber->IsAnimateVertically())
+        {
+            Writer.Write(TEXT("bAnimateVertically"), false);
+        }
+        if (!Throbber->IsAnimateOpacity())
+        {
+            Writer.Write(TEXT("bAnimateOpacity"), false);
+        }
+        
+        // Image brush (include ImageSize for Throbber)
+        const FSlateBrush &ImageBrush = Throbber->GetImage();
+        if (MWCS_ShouldWrite(bMinimal, Throbber, TEXT("Image")))
+        {
+            MWCS_ExtractBrushProperties(ImageBrush, Writer, TEXT("Image"), true);
+        }
+        
+        MWCS_TryAddDependency(OutDependencies, ImageBrush.GetResourceObject());
+    }
+
+    // Any widget (ApplyDesignMeta): Visibility, only when it differs from the class default.
+    if (MWCS_IsOverridden(Widget, TEXT("Visibility")))
+    {
+        Writer.Write(TEXT("Visibility"), StaticEnum<ESlateVisibility>()->GetNameStringByValue(static_cast<int64>(Widget->GetVisibility())));
+    }
+
+    Writer.EndObject(/*bOmitIfEmpty*/ true);
+}
+
+static void MWCS_ExportTextProps(UWidget *Widget, FMWCS_CanonicalJsonWriter &Writer, bool bIncludeTextProperties, bool bMinimal)
+{
+    if (!bIncludeTextProperties || !Widget)
+    {
+        return;
+    }
+
+    if (UTextBlock *TB = Cast<UTextBlock>(Widget))
+    {
+        const FString Text = TB->GetText().ToString();
+        if (!Text.IsEmpty() && MWCS_ShouldWrite(bMinimal, TB, TEXT("Text")))
+        {
+            Writer.Write(TEXT("Text"), Text);
+        }
+
+        const int32 FontSize = TB->GetFont().Size;
+        if (FontSize > 0 && (!bMinimal || FontSize != CastChecked<UTextBlock>(TB->GetClass()->GetDefaultObject())->GetFont().Size))
+        {
+            Writer.Write(TEXT("FontSize"), FontSize);
+        }
+
+        uint8 JustValue = 0;
+        if (MWCS_ShouldWrite(bMinimal, TB, TEXT("Justification")) && MWCS_TryGetBytePropertyValue(TB, TEXT("Justification"), JustValue))
+        {
+            const ETextJustify::Type Just = static_cast<ETextJustify::Type>(JustValue);
+            switch (Just)
+            {
+            case ETextJustify::Left:
+                Writer.Write(TEXT("Justification"), TEXT("Left"));
+                break;
+            case ETextJustify::Center:
+                Writer.Write(TEXT("Justification"), TEXT("Center"));
+                break;
+            case ETextJustify::Right:
+                Writer.Write(TEXT("Justification"), TEXT("Right"));
+                break;
+            default:
+                break;
+            }
+        }
+    }
+}
+
+static void MWCS_ExportIsVariable(UWidget *Widget, FMWCS_CanonicalJsonWriter &Writer, bool bIncludeIsVariable)
+{
+    if (!bIncludeIsVariable || !Widget)
+    {
+        return;
+    }
+
+    bool bIsVar = true;
+    if (MWCS_TryGetBoolPropertyValue(Widget, TEXT("bIsVariable"), bIsVar))
+    {
+        Writer.Write(TEXT("IsVariable"), bIsVar);
+    }
+}
+
+static void MWCS_ExportUserWidgetClassPath(UWidget *Widget, FMWCS_CanonicalJsonWriter &Writer, bool bIncludeWidgetClassPaths)
+{
+    if (!bIncludeWidgetClassPaths || !Widget)
+    {
+        return;
+    }
+
+    if (Widget->IsA<UUserWidget>())
+    {
+        // When Type is UserWidget, MWCS builder uses WidgetClass to resolve the class.
+        Writer.Write(TEXT("WidgetClass"), Widget->GetClass()->GetPathName());
+    }
+}
+
+// Writes Widget as member Key of the open object, or as the next element of the open "Children" array.
+static void MWCS_ExportWidgetRecursive(UWidget *Widget,
+                                       FMWCS_CanonicalJsonWriter &Writer,
+                                       const TCHAR *Key,
+                                       FMWCS_CanonicalJsonWriter *DesignWriter,
+                                       TSet<FString> &OutDependencies,
+                                       const FMWCS_ExtractOptions &Options)
+{
+    if (!Widget)
+    {
+        return;
+    }
+
+    Writer.BeginObject(Key);
+    Writer.Write(TEXT("Type"), MWCS_NormalizeWidgetType(Widget));
+    Writer.Write(TEXT("Name"), Widget->GetFName().ToString());
+
+    MWCS_ExportInlineProperties(Widget, Writer, Options.bIncludePropertiesSection, Options.bMinimal);
+    MWCS_ExportDesignEntry(Widget, DesignWriter, OutDependencies, Options.bIncludeDesignSection, Options.bMinimal);
+
+    MWCS_ExportIsVariable(Widget, Writer, Options.bIncludeIsVariable);
+    MWCS_ExportTextProps(Widget, Writer, Options.bIncludeTextProperties, Options.bMinimal);
+    MWCS_ExportSlotLayout(Widget, Writer, Options.bIncludeSlotLayout, Options.bIncludeCanvasSlot, Options.bMinimal);
+
+    if (MWCS_NormalizeWidgetType(Widget) == TEXT("UserWidget"))
+    {
+        MWCS_ExportUserWidgetClassPath(Widget, Writer, Options.bIncludeWidgetClassPaths);
+    }
+
+    Writer.BeginArray(TEXT("Children"));
+
+    if (UPanelWidget *Panel = Cast<UPanelWidget>(Widget))
+    {
+        const int32 Count = Panel->GetChildrenCount();
+        for (int32 i = 0; i < Count; ++i)
+        {
+            MWCS_ExportWidgetRecursive(Panel->GetChildAt(i), Writer, TEXT(""), DesignWriter, OutDependencies, Options);
+        }
+    }
+    else if (UContentWidget *Content = Cast<UContentWidget>(Widget))
+    {
+        MWCS_ExportWidgetRecursive(Content->GetContent(), Writer, TEXT(""), DesignWriter, OutDependencies, Options);
+    }
+
+    Writer.EndArray(/*bOmitIfEmpty*/ true);
+    Writer.EndObject();
+}
+
+FString FMWCS_WidgetExtractor::GetDefaultOutputDir()
+{
+    return FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("MWCS"), TEXT("ExtractedSpecs"));
+}
+
+bool FMWCS_WidgetExtractor::ExtractToJson(UWidgetBlueprint *WidgetBlueprint, const FMWCS_ExtractOptions &Options, FString &OutJson, FMWCS_Report &InOutReport)
+{
+    OutJson.Reset();
+
+    if (!WidgetBlueprint)
+    {
+        AddIssue(InOutReport, EMWCS_IssueSeverity::Error, TEXT("Extract.NoBlueprint"), TEXT("No WidgetBlueprint provided."), TEXT("Extract"));
+        return false;
+    }
+
+    if (!WidgetBlueprint->WidgetTree || !WidgetBlueprint->WidgetTree->RootWidget)
+    {
+        AddIssue(InOutReport, EMWCS_IssueSeverity::Error, TEXT("Extract.NoWidgetTree"), TEXT("WidgetBlueprint has no WidgetTree/RootWidget."), WidgetBlueprint->GetPathName());
+        return false;
+    }
+
+    const bool bPretty = !Options.bMinified;
+    FMWCS_CanonicalJsonWriter Writer(bPretty);
+    Writer.BeginObject();
+    Writer.Write(TEXT("BlueprintName"), WidgetBlueprint->GetName());
+    Writer.Write(TEXT("Version"), TEXT("1.0.0"));
+    if (Options.bIncludeSourceAssetField)
+    {
+        // Not part of GetWidgetSpec in project, but still useful for traceability when enabled.
+        Writer.Write(TEXT("SourceAsset"), WidgetBlueprint->GetPathName());
+    }
+
+    if (WidgetBlueprint->ParentClass)
+    {
+        Writer.Write(TEXT("ParentClass"), WidgetBlueprint->ParentClass->GetPathName());
+    }
+
+    // Match GetWidgetSpec: DesignerPreview exists at root.
+    // Extract from the blueprint when possible instead of hardcoding.
+    MWCS_ExportDesignerPreview(WidgetBlueprint, Writer);
+
+    // Design entries are stored at the root keyed by widget name; the design writer is embedded at depth 1.
+    TOptional<FMWCS_CanonicalJsonWriter> DesignWriter;
+    if (Options.bIncludeDesignSection)
+    {
+        DesignWriter.Emplace(bPretty, /*BaseDepth*/ 1);
+        DesignWriter->BeginObject();
+    }
+
+    // Dependencies gathered from brushes/fonts during export.
+    TSet<FString> DependencySet;
+
+    // Wrap root node to match expected schema: { "Hierarchy": { "Root": { ... } } }
+    Writer.BeginObject(TEXT("Hierarchy"));
+    MWCS_ExportWidgetRecursive(WidgetBlueprint->WidgetTree->RootWidget, Writer, TEXT("Root"), DesignWriter.GetPtrOrNull(), DependencySet, Options);
+    Writer.EndObject();
+
+    if (DesignWriter.IsSet())
+    {
+        DesignWriter->EndObject();
+        Writer.WriteRaw(TEXT("Design"), DesignWriter->GetOutput());
+    }
+
+    // Dependencies array (best-effort).
+    {
+        TArray<FString> SortedDeps = DependencySet.Array();
+        SortedDeps.Sort();
+
+        Writer.BeginArray(TEXT("Dependencies"));
+        for (const FString &Dep : SortedDeps)
+        {
+            Writer.WriteElement(Dep);
+        }
+        Writer.EndArray();
+    }
+
+    Writer.EndObject();
+    OutJson = Writer.GetOutput();
+    return true;
+}
+
+bool FMWCS_WidgetExtractor::ExtractToFile(UWidgetBlueprint *WidgetBlueprint, const FMWCS_ExtractOptions &Options, const FString &OutputDir, FString &OutPath, FMWCS_Report &InOutReport)
+{
+    FString Json;
+    if (!ExtractToJson(WidgetBlueprint, Options, Json, InOutReport))
+    {
+        return false;
+    }
+
+    const FString Dir = OutputDir.IsEmpty() ? GetDefaultOutputDir() : OutputDir;
+    IFileManager::Get().MakeDirectory(*Dir, true);
+
+    OutPath = FPaths::Combine(Dir, WidgetBlueprint->GetName() + TEXT(".json"));
+    if (!FFileHelper::SaveStringToFile(Json, *OutPath, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM))
+    {
+        AddIssue(InOutReport, EMWCS_IssueSeverity::Error, TEXT("Extract.WriteFailed"), TEXT("Failed to write extracted spec JSON."), OutPath);
+        return false;
+    }
+    return true;
+}
+
+bool FMWCS_WidgetExtractor::CheckMinimalParity(UWidgetBlueprint *WidgetBlueprint, const FMWCS_ExtractOptions &Options, FMWCS_Report &InOutReport)
+{
+    if (!WidgetBlueprint)
+    {
+        return false;
+    }
+    const FString Context = WidgetBlueprint->GetPathName();
+
+    FMWCS_ExtractOptions MinimalOptions = Options;
+    MinimalOptions.bMinimal = true;
+    MinimalOptions.bIncludeSourceAssetField = false;
+    FMWCS_ExtractOptions FullOptions = MinimalOptions;
+    FullOptions.bMinimal = false;
+
+    FString MinimalJson;
+    FMWCS_WidgetSpec Spec;
+    if (!ExtractToJson(WidgetBlueprint, MinimalOptions, MinimalJson, InOutReport) ||
+        !FMWCS_SpecParser::ParseSpecJson(MinimalJson, Spec, InOutReport, Context))
+    {
+        return false;
+    }
+
+    FMWCS_BuildOptions BuildOptions;
+    BuildOptions.OutputPathOverride = TEXT("/Temp/MWCS_Parity");
+    BuildOptions.bSkipSave = true;
+    FMWCS_Report BuildReport;
+    UWidgetBlueprint *Rebuilt = nullptr;
+    const bool bBuilt = FMWCS_WidgetBuilder::CreateOrUpdateFromSpec(Spec, EMWCS_BuildMode::ForceRecreate, BuildOptions, BuildReport, &Rebuilt);
+    for (const FMWCS_Issue &Issue : BuildReport.Issues)
+    {
+        if (Issue.Severity != EMWCS_IssueSeverity::Info)
+        {
+            InOutReport.Issues.Add(Issue);
+        }
+    }
+    if (!bBuilt || !Rebuilt)
+    {
+        AddIssue(InOutReport, EMWCS_IssueSeverity::Error, TEXT("Extract.ParityBuildFailed"), TEXT("The minimal spec did not build."), Context);
+        return false;
+    }
+
+    // The full extraction covers every field MWCS can express, so equal output means an equivalent asset.
+    FString Expected;
+    FString Actual;
+    ExtractToJson(WidgetBlueprint, FullOptions, Expected, InOutReport);
+    ExtractToJson(Rebuilt, FullOptions, Actual, InOutReport);
+    if (Expected == Actual)
+    {
+        AddIssue(InOutReport, EMWCS_IssueSeverity::Info, TEXT("Extract.ParityOk"),
+                 FString::Printf(TEXT("Minimal spec rebuilds identically (%d of %d characters)."), MinimalJson.Len(), Expected.Len()), Context);
+        return true;
+    }
+
+    TArray<FString> ExpectedLines;
+    TArray<FString> ActualLines;
+    Expected.ParseIntoArrayLines(ExpectedLines, /*bCullEmpty*/ false);
+    Actual.ParseIntoArrayLines(ActualLines, /*bCullEmpty*/ false);
+    int32 Line = 0;
+    while (Line < ExpectedLines.Num() && Line < ActualLines.Num() && ExpectedLines[Line] == ActualLines[Line])
+    {
+        ++Line;
+    }
+    AddIssue(InOutReport, EMWCS_IssueSeverity::Error, TEXT("Extract.ParityMismatch"),
+             FString::Printf(TEXT("Rebuilt asset differs at line %d: expected '%s', got '%s'."), Line + 1,
+                             ExpectedLines.IsValidIndex(Line) ? *ExpectedLines[Line].TrimStartAndEnd() : TEXT("<end>"),
+                             ActualLines.IsValidIndex(Line) ? *ActualLines[Line].TrimStartAndEnd() : TEXT("<end>")),
+             Context);
+    return false;
+}
+
+namespace
+{
+    struct FMWCS_ExtractJob
+    {
+        FString AssetPath;
+        FString PackageName;
+        FString OutPath;
+        FString Key;
+    };
+
+    struct FMWCS_ExtractWriteResult
+    {
+        bool bOk = false;
+        FString Error;
+    };
+}
+
+// Bumped when the extracted JSON format changes, so the manifest does not skip stale outputs.
+static const TCHAR *GMWCS_ExtractFormatVersion = TEXT("2");
+
+static FString MWCS_ExtractManifestPath()
+{
+    return FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("MWCS"), TEXT("ExtractManifest.json"));
+}
+
+static FString MWCS_OptionsSignature(const FMWCS_ExtractOptions &Options)
+{
+    const bool Flags[] = {Options.bIncludeSourceAssetField, Options.bIncludeSlotLayout, Options.bIncludeCanvasSlot, Options.bIncludeTextProperties,
+                          Options.bIncludeWidgetClassPaths, Options.bIncludeIsVariable, Options.bIncludePropertiesSection, Options.bIncludeDesignSection,
+                          Options.bMinimal, Options.bMinified};
+    FString Signature = GMWCS_ExtractFormatVersion;
+    Signature += TEXT(":");
+    for (const bool bFlag : Flags)
+    {
+        Signature += bFlag ? TEXT("1") : TEXT("0");
+    }
+    return Signature;
+}
+
+// Manifest: { "Outputs": { "<absolute output file>": "<package md5>|<options signature>" } }
+static void MWCS_LoadExtractManifest(TMap<FString, FString> &OutEntries)
+{
+    FString Json;
+    if (!FFileHelper::LoadFileToString(Json, *MWCS_ExtractManifestPath()))
+    {
+        return;
+    }
+    TSharedPtr<FJsonObject> Root;
+    const TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Json);
+    const TSharedPtr<FJsonObject> *Outputs = nullptr;
+    if (FJsonSerializer::Deserialize(Reader, Root) && Root.IsValid() && Root->TryGetObjectField(TEXT("Outputs"), Outputs))
+    {
+        for (const TPair<FString, TSharedPtr<FJsonValue>> &Pair : (*Outputs)->Values)
+        {
+            OutEntries.Add(Pair.Key, Pair.Value->AsString());
+        }
+    }
+}
+
+static void MWCS_SaveExtractManifest(const TMap<FString, FString> &Entries)
+{
+    TSharedRef<FJsonObject> Outputs = MakeShared<FJsonObject>();
+    for (const TPair<FString, FString> &Pair : Entries)
+    {
+        Outputs->SetStringField(Pair.Key, Pair.Value);
+    }
+    TSharedRef<FJsonObject> Root = MakeShared<FJsonObject>();
+    Root->SetObjectField(TEXT("Outputs"), Outputs);
+
+    FString Json;
+    TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&Json);
+    FJsonSerializer::Serialize(Root, Writer);
+    FFileHelper::SaveStringToFile(Json, *MWCS_ExtractManifestPath());
+}
+
+static FMWCS_ExtractWriteResult MWCS_WriteSpecFile(const FString &Json, const FString &OutPath)
+{
+    FMWCS_ExtractWriteResult Result;
+    if (!FFileHelper::SaveStringToFile(Json, *OutPath, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM))
+    {
+        Result.Error = TEXT("Failed to write extracted spec JSON.");
+        return Result;
+    }
+    Result.bOk = true;
+    return Result;
+}
+
+void FMWCS_WidgetExtractor::ExtractAssets(const TArray<FAssetData> &Assets, const FMWCS_ExtractOptions &Options, const FMWCS_ExtractBatchOptions &BatchOptions, FMWCS_Report &InOutReport)
+{
+    const double Start = FPlatformTime::Seconds();
+    const FString Dir = FPaths::ConvertRelativePathToFull(BatchOptions.OutputDir.IsEmpty() ? GetDefaultOutputDir() : BatchOptions.OutputDir);
+    IFileManager::Get().MakeDirectory(*Dir, true);
+
+    TMap<FString, FString> Manifest;
+    MWCS_LoadExtractManifest(Manifest);
+
+    // Outputs are named after the asset only, so same-named Widget Blueprints in different folders would overwrite
+    // each other (last one wins, nondeterministically). Refuse those up front instead; FString keys compare
+    // case-insensitively, as the output file systems may.
+    TMap<FString, TArray<FString>> PackagesByOutPath;
+    for (const FAssetData &Asset : Assets)
+    {
+        PackagesByOutPath.FindOrAdd(FPaths::Combine(Dir, Asset.AssetName.ToString() + TEXT(".json"))).Add(Asset.PackageName.ToString());
+    }
+
+    TArray<FMWCS_ExtractJob> Jobs;
+    Jobs.Reserve(Assets.Num());
+    int32 NumDuplicates = 0;
+    for (const FAssetData &Asset : Assets)
+    {
+        const FString OutPath = FPaths::Combine(Dir, Asset.AssetName.ToString() + TEXT(".json"));
+        const TArray<FString> &SamePath = PackagesByOutPath.FindChecked(OutPath);
+        if (SamePath.Num() > 1)
+        {
+            AddIssue(InOutReport, EMWCS_IssueSeverity::Error, TEXT("Extract.DuplicateAssetName"),
+                     FString::Printf(TEXT("%d Widget Blueprints would write %s (%s); rename them or extract them separately."),
+                                     SamePath.Num(), *FPaths::GetCleanFilename(OutPath), *FString::Join(SamePath, TEXT(", "))),
+                     Asset.GetObjectPathString());
+            ++NumDuplicates;
+            continue;
+        }
+
+        FMWCS_ExtractJob &Job = Jobs.AddDefaulted_GetRef();
+        Job.AssetPath = Asset.GetObjectPathString();
+        Job.PackageName = Asset.PackageName.ToString();
+        Job.OutPath = OutPath;
+    }
+
+    // Hashing the package files is pure I/O, so do it in parallel before anything is loaded.
+    const FString Signature = MWCS_OptionsSignature(Options);
+    ParallelFor(Jobs.Num(), [&Jobs, &Signature](int32 Index)
+                {
+                    FMWCS_ExtractJob &Job = Jobs[Index];
+                    FString Filename;
+                    if (FPackageName::TryConvertLongPackageNameToFilename(Job.PackageName, Filename, FPackageName::GetAssetPackageExtension()))
+                    {
+                        const FMD5Hash Hash = FMD5Hash::HashFile(*Filename);
+                        if (Hash.IsValid())
+                        {
+                            Job.Key = LexToString(Hash) + TEXT("|") + Signature;
+                        }
+                    } });
+
+    TArray<const FMWCS_ExtractJob *> Pending;
+    int32 NumSkipped = 0;
+    for (const FMWCS_ExtractJob &Job : Jobs)
+    {
+        const FString *Previous = Manifest.Find(Job.OutPath);
+        if (!BatchOptions.bForce && !Job.Key.IsEmpty() && Previous && *Previous == Job.Key && IFileManager::Get().FileExists(*Job.OutPath))
+        {
+            ++NumSkipped;
+            continue;
+        }
+        Pending.Add(&Job);
+    }
+
+    TArray<TPair<const FMWCS_ExtractJob *, TFuture<FMWCS_ExtractWriteResult>>> Writes;
+    Writes.Reserve(Pending.Num());
+    const int32 BatchSize = FMath::Max(1, BatchOptions.BatchSize);
+    for (int32 First = 0; First < Pending.Num(); First += BatchSize)
+    {
+        const int32 Last = FMath::Min(First + BatchSize, Pending.Num());
+
+        // Request the whole batch, then wait once so the loader can overlap I/O and deserialization.
+        for (int32 Index = First; Index < Last; ++Index)
+        {
+            LoadPackageAsync(Pending[Index]->PackageName);
+        }
+        FlushAsyncLoading();
+
+        for (int32 Index = First; Index < Last; ++Index)
+        {
+            const FMWCS_ExtractJob *Job = Pending[Index];
+            UWidgetBlueprint *WidgetBP = FindObject<UWidgetBlueprint>(nullptr, *Job->AssetPath);
+            if (!WidgetBP)
+            {
+                AddIssue(InOutReport, EMWCS_IssueSeverity::Warning, TEXT("Extract.LoadFailed"), TEXT("Could not load the Widget Blueprint."), Job->AssetPath);
+                continue;
+            }
+
+            FString Json;
+            if (!ExtractToJson(WidgetBP, Options, Json, InOutReport))
+            {
+                continue;
+            }
+            if (Options.bMinimal && BatchOptions.bParityCheck)
+            {
+                CheckMinimalParity(WidgetBP, Options, InOutReport);
+            }
+            const FString OutPath = Job->OutPath;
+            Writes.Emplace(Job, Async(EAsyncExecution::ThreadPool, [Json = MoveTemp(Json), OutPath]()
+                                      { return MWCS_WriteSpecFile(Json, OutPath); }));
+        }
+
+        // The extracted text holds no UObject references, so the loaded batch can be released.
+        CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+    }
+
+    int32 NumWritten = 0;
+    for (TPair<const FMWCS_ExtractJob *, TFuture<FMWCS_ExtractWriteResult>> &Write : Writes)
+    {
+        const FMWCS_ExtractWriteResult Result = Write.Value.Get();
+        const FMWCS_ExtractJob *Job = Write.Key;
+        if (!Result.bOk)
+        {
+            AddIssue(InOutReport, EMWCS_IssueSeverity::Error, TEXT("Extract.WriteFailed"), Result.Error, Job->OutPath);
+            Manifest.Remove(Job->OutPath);
+            continue;
+        }
+
+        ++NumWritten;
+        InOutReport.SpecsProcessed++;
+        AddIssue(InOutReport, EMWCS_IssueSeverity::Info, TEXT("Extract.Wrote"), Job->OutPath, Job->AssetPath);
+        if (!Job->Key.IsEmpty())
+        {
+            Manifest.Add(Job->OutPath, Job->Key);
+        }
+    }
+    MWCS_SaveExtractManifest(Manifest);
+
+    AddIssue(InOutReport, EMWCS_IssueSeverity::Info, TEXT("Extract.Summary"),
+             FString::Printf(TEXT("%d Widget Blueprint(s): %d extracted, %d unchanged and skipped, %d refused for duplicate names (%.2fs)."),
+                             Assets.Num(), NumWritten, NumSkipped, NumDuplicates, FPlatformTime::Seconds() - Start),
+             Dir);
+}
@@ -0,0 +1,308 @@
+#include "MWCS_WidgetPlanner.h"
+
+#include "MWCS_Settings.h"
+#include "MWCS_SpecOptimizer.h"
+#include "MWCS_WidgetValidator.h"
+
+#include "MWCS_Utilities.h"
+using namespace MWCS_Utilities;
+
+#include "Blueprint/WidgetTree.h"
+#include "Components/BorderSlot.h"
+#include "Components/ButtonSlot.h"
+#include "Components/CanvasPanelSlot.h"
+#include "Components/HorizontalBoxSlot.h"
+#include "Components/OverlaySlot.h"
+#include "Components/VerticalBoxSlot.h"
+#include "Components/Widget.h"
+#include "Dom/JsonObject.h"
+#include "Engine/Blueprint.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+#include "WidgetBlueprint.h"
+
+int32 FMWCS_Plan::Count(EMWCS_PlanChange Change) const
+{
+    int32 Result = 0;
+    for (const FMWCS_PlanEntry &Entry : Entries)
+    {
+        if (Entry.Change == Change)
+        {
+            ++Result;
+        }
+    }
+    return Result;
+}
+
+bool FMWCS_Plan::HasChanges() const
+{
+    return Count(EMWCS_PlanChange::Unchanged) != Entries.Num();
+}
+
+static void MWCS_PlanRaise(FMWCS_PlanEntry &Entry, EMWCS_PlanChange Change, const FString &Reason)
+{
+    if (static_cast<uint8>(Change) > static_cast<uint8>(Entry.Change))
+    {
+        Entry.Change = Change;
+    }
+    Entry.Reasons.Add(Reason);
+}
+
+// Maps validator findings onto plan categories. Codes that do not describe a difference
+// (dependency lookups, missing generated class, ...) return Unchanged and are reported as issues instead.
+static EMWCS_PlanChange MWCS_ClassifyValidatorCode(const FString &Code)
+{
+    if (Code == TEXT("Validator.ParentMismatch") ||
+        Code.StartsWith(TEXT("Validator.Hierarchy.")) ||
+        Code == TEXT("Validator.MissingWidget") ||
+        Code == TEXT("Validator.MissingRootWidget") ||
+        Code == TEXT("Validator.MissingWidgetTree") ||
+        Code == TEXT("Validator.Design.MissingWidget"))
+    {
+        return EMWCS_PlanChange::Structural;
+    }
+
+    if (Code.StartsWith(TEXT("Validator.Design.")) ||
+        Code == TEXT("Validator.DesignerPreview.CustomSizeMismatch") ||
+        Code == TEXT("Validator.DesignerPreview.SizeModeMismatch"))
+    {
+        return EMWCS_PlanChange::PropertyOnly;
+    }
+
+    return EMWCS_PlanChange::Unchanged;
+}
+
+static bool MWCS_PlanNearlyEqualMargin(const FMargin &A, const FMargin &B)
+{
+    return FMath::IsNearlyEqual(A.Left, B.Left, 0.001f) && FMath::IsNearlyEqual(A.Top, B.Top, 0.001f) &&
+           FMath::IsNearlyEqual(A.Right, B.Right, 0.001f) && FMath::IsNearlyEqual(A.Bottom, B.Bottom, 0.001f);
+}
+
+template <typename SlotType>
+static void MWCS_PlanDiffBoxLikeSlot(const FMWCS_HierarchyNode &Node, const SlotType *Slot, TArray<FString> &OutDiffs)
+{
+    if (Node.bHasSlotPadding && !MWCS_PlanNearlyEqualMargin(Slot->GetPadding(), Node.SlotPadding))
+    {
+        OutDiffs.Add(TEXT("Padding"));
+    }
+    if (Node.bHasSlotHAlign && Slot->GetHorizontalAlignment() != Node.SlotHAlign)
+    {
+        OutDiffs.Add(TEXT("HAlign"));
+    }
+    if (Node.bHasSlotVAlign && Slot->GetVerticalAlignment() != Node.SlotVAlign)
+    {
+        OutDiffs.Add(TEXT("VAlign"));
+    }
+}
+
+template <typename SlotType>
+static void MWCS_PlanDiffSizedSlot(const FMWCS_HierarchyNode &Node, const SlotType *Slot, TArray<FString> &OutDiffs)
+{
+    MWCS_PlanDiffBoxLikeSlot(Node, Slot, OutDiffs);
+    if (Node.bHasSlotSize)
+    {
+        const FSlateChildSize Size = Slot->GetSize();
+        if (Size.SizeRule != Node.SlotSizeRule || !FMath::IsNearlyEqual(Size.Value, Node.SlotSizeValue, 0.001f))
+        {
+            OutDiffs.Add(TEXT("Size"));
+        }
+    }
+}
+
+// The validator does not look at slots, so the planner compares the slot metadata the builder would apply.
+static void MWCS_PlanDiffSlots(const FMWCS_HierarchyNode &Node, UWidgetTree *Tree, FMWCS_PlanEntry &Entry)
+{
+    UWidget *Widget = Node.Name != NAME_None ? Tree->FindWidget(Node.Name) : nullptr;
+    if (Widget && Widget->Slot)
+    {
+        TArray<FString> Diffs;
+        UPanelSlot *Slot = Widget->Slot;
+        if (const UCanvasPanelSlot *Canvas = Cast<UCanvasPanelSlot>(Slot))
+        {
+            const FAnchors Anchors = Canvas->GetAnchors();
+            if (Node.bHasCanvasAnchors && (!Anchors.Minimum.Equals(Node.CanvasAnchorsMin, 0.001f) || !Anchors.Maximum.Equals(Node.CanvasAnchorsMax, 0.001f)))
+            {
+                Diffs.Add(TEXT("Anchors"));
+            }
+            if (Node.bHasCanvasOffsets && !MWCS_PlanNearlyEqualMargin(Canvas->GetOffsets(), Node.CanvasOffsets))
+            {
+                Diffs.Add(TEXT("Offsets"));
+            }
+            if (Node.bHasCanvasAlignment && !Canvas->GetAlignment().Equals(Node.CanvasAlignment, 0.001f))
+            {
+                Diffs.Add(TEXT("Alignment"));
+            }
+            if (Node.bHasCanvasAutoSize && Canvas->GetAutoSize() != Node.bCanvasAutoSize)
+            {
+                Diffs.Add(TEXT("AutoSize"));
+            }
+            if (Node.bHasCanvasZOrder && Canvas->GetZOrder() != Node.CanvasZOrder)
+            {
+                Diffs.Add(TEXT("ZOrder"));
+            }
+        }
+        else if (const UVerticalBoxSlot *V = Cast<UVerticalBoxSlot>(Slot))
+        {
+            MWCS_PlanDiffSizedSlot(Node, V, Diffs);
+        }
+        else if (const UHorizontalBoxSlot *H = Cast<UHorizontalBoxSlot>(Slot))
+        {
+            MWCS_PlanDiffSizedSlot(Node, H, Diffs);
+        }
+        else if (const UOverlaySlot *O = Cast<UOverlaySlot>(Slot))
+        {
+            MWCS_PlanDiffBoxLikeSlot(Node, O, Diffs);
+        }
+        else if (const UBorderSlot *B = Cast<UBorderSlot>(Slot))
+        {
+            MWCS_PlanDiffBoxLikeSlot(Node, B, Diffs);
+        }
+        else if (const UButtonSlot *Btn = Cast<UButtonSlot>(Slot))
+        {
+            MWCS_PlanDiffBoxLikeSlot(Node, Btn, Diffs);
+        }
+
+        if (Diffs.Num() > 0)
+        {
+            MWCS_PlanRaise(Entry, EMWCS_PlanChange::PropertyOnly, FString::Printf(TEXT("Slot: %s (%s)"), *Node.Name.ToString(), *FString::Join(Diffs, TEXT(", "))));
+        }
+    }
+
+    for (const FMWCS_HierarchyNode &Child : Node.Children)
+    {
+        MWCS_PlanDiffSlots(Child, Tree, Entry);
+    }
+}
+
+void FMWCS_WidgetPlanner::PlanSpec(const FMWCS_WidgetSpec &Spec, FMWCS_PlanEntry &OutEntry, FMWCS_Report &InOutReport)
+{
+    OutEntry = FMWCS_PlanEntry();
+    OutEntry.BlueprintName = Spec.BlueprintName;
+
+    const UMWCS_Settings *Settings = UMWCS_Settings::Get();
+    if (!Settings)
+    {
+        AddIssue(InOutReport, EMWCS_IssueSeverity::Error, TEXT("Settings.Missing"), TEXT("MWCS settings not available."), TEXT("Planner"));
+        return;
+    }
+
+    FString PackagePath;
+    if (!EnsureValidPackagePath(Settings->OutputRootPath, PackagePath))
+    {
+        AddIssue(InOutReport, EMWCS_IssueSeverity::Error, TEXT("Planner.InvalidOutputPath"), TEXT("OutputRootPath is not a valid long package path."), Settings->OutputRootPath);
+        return;
+    }
+
+    const FString AssetName = Spec.BlueprintName.ToString();
+    OutEntry.AssetPath = FString::Printf(TEXT("%s/%s"), *PackagePath, *AssetName);
+
+    // Registry-only checks first: these need no asset load.
+    FAssetData AssetData;
+    if (!FindAssetData(PackagePath, AssetName, AssetData))
+    {
+        MWCS_PlanRaise(OutEntry, EMWCS_PlanChange::New, TEXT("Asset does not exist."));
+        return;
+    }
+
+    FString ParentTag;
+    if (AssetData.GetTagValue(FBlueprintTags::ParentClassPath, ParentTag))
+    {
+        const FString ActualParent = FPackageName::ExportTextPathToObjectPath(ParentTag);
+        if (!Spec.ParentClassPath.IsEmpty() && !ActualParent.Equals(Spec.ParentClassPath, ESearchCase::IgnoreCase))
+        {
+            MWCS_PlanRaise(OutEntry, EMWCS_PlanChange::Structural, FString::Printf(TEXT("ParentClass: %s -> %s"), *ActualParent, *Spec.ParentClassPath));
+            return;
+        }
+    }
+
+    // Anything finer than the parent class needs the widget tree.
+    UWidgetBlueprint *BP = Cast<UWidgetBlueprint>(AssetData.GetAsset());
+    OutEntry.bLoadedAsset = true;
+    if (!BP)
+    {
+        AddIssue(InOutReport, EMWCS_IssueSeverity::Error, TEXT("Planner.WrongType"), TEXT("Asset is not a Widget Blueprint."), OutEntry.AssetPath);
+        return;
+    }
+
+    // Built with the optimizer pass: diff against the same collapsed hierarchy, or every collapsed container shows up
+    // as a slot change on its child. ValidateBlueprint takes the collapsed copy as is (a second pass removes nothing).
+    FMWCS_WidgetSpec OptimizedSpec;
+    const bool bOptimize = FMWCS_SpecOptimizer::IsEnabled(Spec);
+    if (bOptimize)
+    {
+        OptimizedSpec = Spec;
+        FMWCS_SpecOptimizer::Optimize(OptimizedSpec);
+    }
+    const FMWCS_WidgetSpec &BuiltSpec = bOptimize ? OptimizedSpec : Spec;
+
+    FMWCS_Report Findings;
+    FMWCS_WidgetValidator::ValidateBlueprint(BuiltSpec, BP, Findings);
+    for (FMWCS_Issue &Issue : Findings.Issues)
+    {
+        const EMWCS_PlanChange Change = MWCS_ClassifyValidatorCode(Issue.Code);
+        if (Change == EMWCS_PlanChange::Unchanged)
+        {
+            InOutReport.Issues.Add(MoveTemp(Issue));
+            continue;
+        }
+        MWCS_PlanRaise(OutEntry, Change, FString::Printf(TEXT("%s: %s"), *Issue.Code, *Issue.Message));
+    }
+
+    if (BP->WidgetTree)
+    {
+        MWCS_PlanDiffSlots(BuiltSpec.HierarchyRoot, BP->WidgetTree, OutEntry);
+    }
+}
+
+FString MWCS_PlanJson::ChangeToString(EMWCS_PlanChange Change)
+{
+    switch (Change)
+    {
+    case EMWCS_PlanChange::Unchanged:
+        return TEXT("Unchanged");
+    case EMWCS_PlanChange::PropertyOnly:
+        return TEXT("PropertyOnly");
+    case EMWCS_PlanChange::Structural:
+        return TEXT("Structural");
+    case EMWCS_PlanChange::New:
+        return TEXT("New");
+    default:
+        return TEXT("Unchanged");
+    }
+}
+
+FString MWCS_PlanJson::ToJsonString(const FMWCS_Plan &Plan)
+{
+    TSharedRef<FJsonObject> Root = MakeShared<FJsonObject>();
+    Root->SetNumberField(TEXT("New"), Plan.Count(EMWCS_PlanChange::New));
+    Root->SetNumberField(TEXT("Structural"), Plan.Count(EMWCS_PlanChange::Structural));
+    Root->SetNumberField(TEXT("PropertyOnly"), Plan.Count(EMWCS_PlanChange::PropertyOnly));
+    Root->SetNumberField(TEXT("Unchanged"), Plan.Count(EMWCS_PlanChange::Unchanged));
+
+    TArray<TSharedPtr<FJsonValue>> Entries;
+    Entries.Reserve(Plan.Entries.Num());
+    for (const FMWCS_PlanEntry &Entry : Plan.Entries)
+    {
+        TSharedRef<FJsonObject> Obj = MakeShared<FJsonObject>();
+        Obj->SetStringField(TEXT("BlueprintName"), Entry.BlueprintName.ToString());
+        Obj->SetStringField(TEXT("AssetPath"), Entry.AssetPath);
+        Obj->SetStringField(TEXT("Change"), ChangeToString(Entry.Change));
+        Obj->SetBoolField(TEXT("LoadedAsset"), Entry.bLoadedAsset);
+
+        TArray<TSharedPtr<FJsonValue>> Reasons;
+        for (const FString &Reason : Entry.Reasons)
+        {
+            Reasons.Add(MakeShared<FJsonValueString>(Reason));
+        }
+        Obj->SetArrayField(TEXT("Reasons"), Reasons);
+        Entries.Add(MakeShared<FJsonValueObject>(Obj));
+    }
+    Root->SetArrayField(TEXT("Entries"), Entries);
+    Root->SetNumberField(TEXT("Errors"), Plan.Report.NumErrors());
+    Root->SetNumberField(TEXT("Warnings"), Plan.Report.NumWarnings());
+
+    FString Out;
+    TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&Out);
+    FJsonSerializer::Serialize(Root, Writer);
+    return Out;
+}
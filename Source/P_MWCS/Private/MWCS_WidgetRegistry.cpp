@@ -1,5 +1,6 @@
 #include "MWCS_WidgetRegistry.h"
 
+#include "MWCS_FileSpecProvider.h"
 #include "MWCS_Settings.h"
 #include "MWCS_SpecParser.h"
 #include "MWCS_Utilities.h"
@@ -35,9 +36,9 @@ static bool CallGetWidgetSpec(UClass *ProviderClass, FString &OutJson)
     return true;
 }
 
-bool FMWCS_WidgetRegistry::CollectSpecs(TArray<FMWCS_WidgetSpec> &OutSpecs, FMWCS_Report &InOutReport)
+bool FMWCS_WidgetRegistry::CollectSpecSources(TArray<FMWCS_SpecSource> &OutSources, FMWCS_Report &InOutReport, const TSet<FString> *OnlyProviders)
 {
-    OutSpecs.Reset();
+    OutSources.Reset();
 
     const UMWCS_Settings *Settings = UMWCS_Settings::Get();
     if (!Settings)
@@ -47,16 +48,22 @@ bool FMWCS_WidgetRegistry::CollectSpecs(TArray<FMWCS_WidgetSpec> &OutSpecs, FMWC
     }
 
     TArray<FSoftClassPath> Providers = Settings->SpecProviderClasses;
-    if (Providers.Num() == 0)
+    TArray<FString> SpecDirectories;
+    FMWCS_FileSpecProvider::GetSpecDirectories(SpecDirectories);
+    if (Providers.Num() == 0 && SpecDirectories.Num() == 0)
     {
-        AddIssue(InOutReport, EMWCS_IssueSeverity::Warning, TEXT("Registry.NoProviders"), TEXT("No SpecProviderClasses configured."), TEXT("Registry"));
+        AddIssue(InOutReport, EMWCS_IssueSeverity::Warning, TEXT("Registry.NoProviders"), TEXT("No SpecProviderClasses or SpecDirectories configured."), TEXT("Registry"));
         return true;
     }
 
     for (const FSoftClassPath &ProviderPath : Providers)
     {
-        UClass *ProviderClass = ProviderPath.TryLoadClass<UObject>();
         const FString Context = ProviderPath.ToString();
+        if (OnlyProviders && !OnlyProviders->Contains(Context))
+        {
+            continue;
+        }
+        UClass *ProviderClass = ProviderPath.TryLoadClass<UObject>();
         if (!ProviderClass)
         {
             AddIssue(InOutReport, EMWCS_IssueSeverity::Error, TEXT("Registry.ProviderLoadFailed"), TEXT("Failed to load provider class."), Context);
@@ -75,8 +82,30 @@ bool FMWCS_WidgetRegistry::CollectSpecs(TArray<FMWCS_WidgetSpec> &OutSpecs, FMWC
             continue;
         }
 
+        FMWCS_SpecSource &Source = OutSources.AddDefaulted_GetRef();
+        Source.Json = MoveTemp(Json);
+        Source.Context = Context;
+    }
+
+    // File-backed specs follow the native providers; their context is the spec file path.
+    FMWCS_FileSpecProvider::CollectSpecSources(OutSources, InOutReport, OnlyProviders);
+    return true;
+}
+
+bool FMWCS_WidgetRegistry::CollectSpecs(TArray<FMWCS_WidgetSpec> &OutSpecs, FMWCS_Report &InOutReport, const TSet<FString> *OnlyProviders)
+{
+    OutSpecs.Reset();
+
+    TArray<FMWCS_SpecSource> Sources;
+    if (!CollectSpecSources(Sources, InOutReport, OnlyProviders))
+    {
+        return false;
+    }
+
+    for (const FMWCS_SpecSource &Source : Sources)
+    {
         FMWCS_WidgetSpec Spec;
-        if (FMWCS_SpecParser::ParseSpecJson(Json, Spec, InOutReport, Context))
+        if (FMWCS_SpecParser::ParseSpecSource(Source, Spec, InOutReport))
         {
             OutSpecs.Add(MoveTemp(Spec));
         }
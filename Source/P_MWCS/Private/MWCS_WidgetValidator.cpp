@@ -3,6 +3,7 @@
 #include "MWCS_TransparentButton.h"
 
 #include "MWCS_Settings.h"
+#include "MWCS_SpecOptimizer.h"
 #include "MWCS_Utilities.h"
 using namespace MWCS_Utilities;
 
@@ -16,8 +17,10 @@ using namespace MWCS_Utilities;
 #include "Components/Image.h"
 #include "Components/HorizontalBox.h"
 #include "Components/MultiLineEditableTextBox.h"
+#include "Components/NativeWidgetHost.h"
 #include "Components/Overlay.h"
 #include "Components/PanelWidget.h"
+#include "Components/ProgressBar.h"
 #include "Components/ScrollBox.h"
 #include "Components/Spacer.h"
 #include "Components/TextBlock.h"
@@ -65,6 +68,10 @@ static FString MWCS_NormalizeWidgetTypeForValidation(const UWidget *Widget)
         return TEXT("Throbber");
     if (Widget->IsA<UComboBoxString>())
         return TEXT("ComboBoxString");
+    if (Widget->IsA<UProgressBar>())
+        return TEXT("ProgressBar");
+    if (Widget->IsA<UNativeWidgetHost>())
+        return TEXT("NativeWidgetHost");
     if (Widget->IsA<UWidgetSwitcher>())
         return TEXT("WidgetSwitcher");
     if (Widget->IsA<UUserWidget>())
@@ -198,6 +205,21 @@ static void MWCS_ValidateDesignForWidget(const FName WidgetName,
 
     const FString WidgetCtx = FString::Printf(TEXT("%s::%s"), *Context, *WidgetName.ToString());
 
+    // Any widget: Visibility by ESlateVisibility name (an unknown name never matches).
+    FString ExpectedVisibility;
+    if (DesignObj->TryGetStringField(TEXT("Visibility"), ExpectedVisibility))
+    {
+        const UEnum *VisibilityEnum = StaticEnum<ESlateVisibility>();
+        const int64 Expected = VisibilityEnum->GetValueByNameString(ExpectedVisibility);
+        const ESlateVisibility Actual = Widget->GetVisibility();
+        if (Expected == INDEX_NONE || static_cast<ESlateVisibility>(Expected) != Actual)
+        {
+            AddIssue(Report, EMWCS_IssueSeverity::Error, TEXT("Validator.Design.VisibilityMismatch"),
+                     FString::Printf(TEXT("Visibility mismatch (expected=%s actual=%s)."), *ExpectedVisibility, *VisibilityEnum->GetNameStringByValue(static_cast<int64>(Actual))),
+                     WidgetCtx);
+        }
+    }
+
     if (UButton *Button = Cast<UButton>(Widget))
     {
         bool bExpectedFocusable = Button->GetIsFocusable();
@@ -546,6 +568,32 @@ bool FMWCS_WidgetValidator::ValidateSpecAsset(const FMWCS_WidgetSpec &Spec, FMWC
         return false;
     }
 
+    ValidateBlueprint(Spec, BP, InOutReport);
+    return !InOutReport.HasErrors();
+}
+
+bool FMWCS_WidgetValidator::ValidateBlueprint(const FMWCS_WidgetSpec &Spec, UWidgetBlueprint *BP, FMWCS_Report &InOutReport)
+{
+    if (!BP)
+    {
+        AddIssue(InOutReport, EMWCS_IssueSeverity::Error, TEXT("Validator.WrongType"), TEXT("Asset is not a Widget Blueprint."), Spec.BlueprintName.ToString());
+        return false;
+    }
+
+    // Built with the optimizer pass: compare against the same collapsed hierarchy (a second pass removes nothing).
+    if (FMWCS_SpecOptimizer::IsEnabled(Spec))
+    {
+        FMWCS_WidgetSpec OptimizedSpec = Spec;
+        if (FMWCS_SpecOptimizer::Optimize(OptimizedSpec) > 0)
+        {
+            return ValidateBlueprint(OptimizedSpec, BP, InOutReport);
+        }
+    }
+
+    // Same context string as ValidateSpecAsset ("<OutputRoot>/<AssetName>" is the package name).
+    const FString Context = BP->GetOutermost()->GetName();
+    const int32 ErrorsBefore = InOutReport.NumErrors();
+
     UClass *ExpectedParent = FSoftClassPath(Spec.ParentClassPath).TryLoadClass<UUserWidget>();
     if (!ExpectedParent)
     {
@@ -645,5 +693,5 @@ bool FMWCS_WidgetValidator::ValidateSpecAsset(const FMWCS_WidgetSpec &Spec, FMWC
         AddIssue(InOutReport, EMWCS_IssueSeverity::Warning, TEXT("Validator.NoGeneratedClass"), TEXT("Blueprint has no GeneratedClass (compile may be required)."), Context);
     }
 
-    return !InOutReport.HasErrors();
+    return InOutReport.NumErrors() == ErrorsBefore;
 }
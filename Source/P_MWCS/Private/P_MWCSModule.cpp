@@ -1,5 +1,6 @@
 #include "Modules/ModuleManager.h"
 
+#include "MWCS_HotReload.h"
 #include "MWCS_ToolMenus.h"
 #include "MWCS_ToolTab.h"
 
@@ -14,10 +15,12 @@ public:
     {
         FMWCS_ToolTab::Register();
         ToolMenusHandle = MWCS_RegisterToolMenus(this);
+        FMWCS_HotReload::Get().Start();
     }
 
     virtual void ShutdownModule() override
     {
+        FMWCS_HotReload::Get().Stop();
         MWCS_UnregisterToolMenus(ToolMenusHandle, this);
         FMWCS_ToolTab::Unregister();
     }
@@ -0,0 +1,203 @@
+#include "MWCS_TestUtils.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "MWCS_Benchmark.h"
+#include "MWCS_RuntimeBench.h"
+#include "MWCS_WidgetValidator.h"
+
+#include "HAL/FileManager.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "UObject/UObjectGlobals.h"
+#include "WidgetBlueprint.h"
+
+using namespace MWCS_Tests;
+
+// One variant per node count; run with "Automation RunTests MWCS.Benchmark" (PerfFilter, so not part of the default MWCS run).
+IMPLEMENT_COMPLEX_AUTOMATION_TEST(FMWCS_PipelineBenchmarkTest, "MWCS.Benchmark.ParseBuildValidate", EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+
+void FMWCS_PipelineBenchmarkTest::GetTests(TArray<FString> &OutBeautifiedNames, TArray<FString> &OutTestCommands) const
+{
+    for (const TCHAR *NodeCount : {TEXT("10"), TEXT("100"), TEXT("1000"), TEXT("10000")})
+    {
+        OutBeautifiedNames.Add(FString::Printf(TEXT("%s nodes"), NodeCount));
+        OutTestCommands.Add(NodeCount);
+    }
+}
+
+bool FMWCS_PipelineBenchmarkTest::RunTest(const FString &Parameters)
+{
+    const int32 NodeCount = FCString::Atoi(*Parameters);
+    // Enough repetitions that the small specs are not dominated by timer noise.
+    const int32 Iterations = FMath::Clamp(1000 / FMath::Max(1, NodeCount), 1, 20);
+    const FString Json = MakeSyntheticSpecJson(FString::Printf(TEXT("WBP_MWCS_Bench_%d"), NodeCount), NodeCount);
+
+    double ParseSeconds = 0.0;
+    double BuildSeconds = 0.0;
+    double ValidateSeconds = 0.0;
+    for (int32 Iteration = 0; Iteration < Iterations; ++Iteration)
+    {
+        FMWCS_WidgetSpec Spec;
+        FMWCS_Report Report;
+
+        double Start = FPlatformTime::Seconds();
+        const bool bParsed = ParseSpec(Json, Spec, Report);
+        ParseSeconds += FPlatformTime::Seconds() - Start;
+        if (!TestTrue(TEXT("Parses"), bParsed))
+        {
+            return false;
+        }
+
+        Start = FPlatformTime::Seconds();
+        UWidgetBlueprint *Blueprint = BuildTransient(Spec, Report);
+        BuildSeconds += FPlatformTime::Seconds() - Start;
+        if (!TestNotNull(TEXT("Builds"), Blueprint))
+        {
+            return false;
+        }
+
+        Start = FPlatformTime::Seconds();
+        const bool bValid = FMWCS_WidgetValidator::ValidateBlueprint(Spec, Blueprint, Report);
+        ValidateSeconds += FPlatformTime::Seconds() - Start;
+        TestTrue(TEXT("Validates"), bValid);
+
+        CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+    }
+
+    const double ParseMs = ParseSeconds * 1000.0 / Iterations;
+    const double BuildMs = BuildSeconds * 1000.0 / Iterations;
+    const double ValidateMs = ValidateSeconds * 1000.0 / Iterations;
+    const FString Summary = FString::Printf(TEXT("MWCS Benchmark: %5d nodes  parse %9.3fms  build %10.3fms  validate %9.3fms  (mean of %d, %.0f nodes/s end to end)"),
+                                            NodeCount, ParseMs, BuildMs, ValidateMs, Iterations,
+                                            NodeCount * 1000.0 / FMath::Max(ParseMs + BuildMs + ValidateMs, 0.001));
+    UE_LOG(LogTemp, Display, TEXT("%s"), *Summary);
+    AddInfo(Summary);
+    return true;
+}
+
+// The sample spec instantiated through the MWCS_RuntimeBench path (PerfFilter): the figures are logged, the counts checked.
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMWCS_RuntimeBenchTest, "MWCS.Benchmark.RuntimeInstantiation", EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+
+bool FMWCS_RuntimeBenchTest::RunTest(const FString &Parameters)
+{
+    FMWCS_WidgetSpec Spec;
+    FMWCS_Report Report;
+    if (!TestTrue(TEXT("Parses"), ParseSpec(GetSampleSpecJson(), Spec, Report)))
+    {
+        return false;
+    }
+    UWidgetBlueprint *Blueprint = BuildTransient(Spec, Report);
+    if (!TestNotNull(TEXT("Builds"), Blueprint) || !TestTrue(TEXT("Slate available"), FMWCS_RuntimeBench::EnsureSlate(Report)))
+    {
+        return false;
+    }
+
+    FMWCS_RuntimeBenchOptions Options;
+    Options.Instances = 20;
+    FMWCS_RuntimeBenchRow Row;
+    if (!TestTrue(TEXT("Measures"), FMWCS_RuntimeBench::MeasureClass(Blueprint->GeneratedClass, Options, Row, Report)))
+    {
+        return false;
+    }
+    TestEqual(TEXT("Widgets per instance"), Row.Widgets, 5);
+    TestTrue(TEXT("Slate widgets taken"), Row.SlateWidgets >= Row.Widgets);
+    TestTrue(TEXT("UObjects allocated"), Row.UObjects > 0.0);
+
+    const FString Summary = FString::Printf(TEXT("MWCS RuntimeBench: sample spec  create %.1fus  take %.1fus  prepass %.1fus  %.1f UObject(s)  %.1fKB per instance"),
+                                            Row.CreateUs, Row.TakeWidgetUs, Row.PrepassUs, Row.UObjects, Row.MemoryKB);
+    UE_LOG(LogTemp, Display, TEXT("%s"), *Summary);
+    AddInfo(Summary);
+    return true;
+}
+
+static FMWCS_BenchmarkResult MWCS_MakeBenchmarkResult(double BuildAllMs, double ValidateAllMs, double ExtractMs)
+{
+    FMWCS_BenchmarkResult Result;
+    Result.NumSpecs = 10;
+    Result.NodesPerSpec = 50;
+    Result.Seed = 3;
+    Result.Iterations = 3;
+    Result.Mode = EMWCS_BuildMode::ForceRecreate;
+    const TPair<const TCHAR *, double> Stages[] = {{TEXT("BuildAll"), BuildAllMs}, {TEXT("ValidateAll"), ValidateAllMs}, {TEXT("Extract"), ExtractMs}};
+    for (const TPair<const TCHAR *, double> &Stage : Stages)
+    {
+        FMWCS_BenchmarkStage &Added = Result.Stages.AddDefaulted_GetRef();
+        Added.Name = Stage.Key;
+        Added.MedianMs = Stage.Value;
+    }
+    return Result;
+}
+
+// The regression gate without running a benchmark: medians, the baseline file round trip and Compare's verdicts.
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMWCS_BenchmarkGateTest, "MWCS.Benchmark.Gate", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FMWCS_BenchmarkGateTest::RunTest(const FString &Parameters)
+{
+    TestEqual(TEXT("Median of none"), FMWCS_Benchmark::Median({}), 0.0);
+    TestEqual(TEXT("Median of odd count"), FMWCS_Benchmark::Median({5.0, 1.0, 3.0}), 3.0);
+    TestEqual(TEXT("Median of even count"), FMWCS_Benchmark::Median({4.0, 1.0, 3.0, 2.0}), 2.5);
+
+    // Round trip through the file, with a stored threshold for Extract.
+    const FMWCS_BenchmarkResult Recorded = MWCS_MakeBenchmarkResult(1000.0, 500.0, 200.0);
+    const FString Path = FPaths::Combine(FPaths::AutomationTransientDir(), TEXT("MWCS_BenchmarkBaseline.json"));
+    TMap<FString, double> StoredThresholds;
+    StoredThresholds.Add(TEXT("Extract"), 0.5);
+    if (!TestTrue(TEXT("Baseline written"), FFileHelper::SaveStringToFile(FMWCS_Benchmark::ToBaselineJson(Recorded, StoredThresholds), *Path)))
+    {
+        return false;
+    }
+    FMWCS_BenchmarkBaseline Baseline;
+    FMWCS_Report LoadReport;
+    const bool bLoaded = FMWCS_Benchmark::LoadBaseline(Path, Baseline, LoadReport);
+    IFileManager::Get().Delete(*Path);
+    if (!TestTrue(TEXT("Baseline loads"), bLoaded))
+    {
+        return false;
+    }
+    TestEqual(TEXT("Baseline mode"), Baseline.Mode, FString(TEXT("ForceRecreate")));
+    TestEqual(TEXT("Baseline iterations"), Baseline.Iterations, 3);
+    TestEqual(TEXT("Baseline stages"), Baseline.MedianMs.Num(), 3);
+    TestTrue(TEXT("Baseline threshold"), Baseline.Thresholds.Contains(TEXT("Extract")));
+
+    FMWCS_Report MissingReport;
+    FMWCS_BenchmarkBaseline Missing;
+    TestFalse(TEXT("Missing baseline fails"), FMWCS_Benchmark::LoadBaseline(FPaths::Combine(FPaths::AutomationTransientDir(), TEXT("MWCS_NoSuchBaseline.json")), Missing, MissingReport));
+    TestTrue(TEXT("Missing baseline reported"), HasIssue(MissingReport, TEXT("Benchmark.BaselineInvalid")));
+
+    const FMWCS_BenchmarkGateOptions Gate;
+    TArray<FMWCS_BenchmarkDiffRow> Rows;
+
+    // BuildAll 5% slower, ValidateAll 3ms slower (noise), Extract 40% slower but allowed 50% by the baseline file.
+    FMWCS_Report PassReport;
+    TestTrue(TEXT("Within thresholds passes"), FMWCS_Benchmark::Compare(MWCS_MakeBenchmarkResult(1050.0, 503.0, 280.0), Baseline, Gate, Rows, PassReport));
+    TestEqual(TEXT("One row per stage"), Rows.Num(), 3);
+    TestFalse(TEXT("No regression reported"), HasIssue(PassReport, TEXT("Benchmark.Regression")));
+
+    FMWCS_Report RegressReport;
+    TestFalse(TEXT("Gated slowdown fails"), FMWCS_Benchmark::Compare(MWCS_MakeBenchmarkResult(1200.0, 500.0, 200.0), Baseline, Gate, Rows, RegressReport));
+    TestTrue(TEXT("Regression reported"), HasIssue(RegressReport, TEXT("Benchmark.Regression")));
+
+    // A command-line threshold wins over the one stored in the baseline.
+    FMWCS_BenchmarkGateOptions Strict;
+    Strict.Thresholds.Add(TEXT("Extract"), 0.1);
+    FMWCS_Report StrictReport;
+    TestFalse(TEXT("Command-line threshold wins"), FMWCS_Benchmark::Compare(MWCS_MakeBenchmarkResult(1000.0, 500.0, 280.0), Baseline, Strict, Rows, StrictReport));
+
+    FMWCS_BenchmarkResult OtherMode = MWCS_MakeBenchmarkResult(1000.0, 500.0, 200.0);
+    OtherMode.Mode = EMWCS_BuildMode::Repair;
+    FMWCS_Report ModeReport;
+    TestFalse(TEXT("Different mode fails"), FMWCS_Benchmark::Compare(OtherMode, Baseline, Gate, Rows, ModeReport));
+    TestTrue(TEXT("Mode mismatch reported"), HasIssue(ModeReport, TEXT("Benchmark.BaselineMismatch")));
+
+    FMWCS_BenchmarkResult OtherIterations = MWCS_MakeBenchmarkResult(1000.0, 500.0, 200.0);
+    OtherIterations.Iterations = 1;
+    FMWCS_Report IterationsReport;
+    TestFalse(TEXT("Different iteration count fails"), FMWCS_Benchmark::Compare(OtherIterations, Baseline, Gate, Rows, IterationsReport));
+    TestTrue(TEXT("Iteration mismatch reported"), HasIssue(IterationsReport, TEXT("Benchmark.BaselineMismatch")));
+    return true;
+}
+
+#endif
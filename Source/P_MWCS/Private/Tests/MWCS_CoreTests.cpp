@@ -0,0 +1,182 @@
+#include "MWCS_TestUtils.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "MWCS_CanonicalJson.h"
+#include "MWCS_CoreCanonical.h"
+#include "MWCS_SpecParser.h"
+
+#include "Dom/JsonObject.h"
+#include "HAL/FileManager.h"
+#include "Interfaces/IPluginManager.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Misc/SecureHash.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+
+using namespace MWCS_Tests;
+
+// Replays an engine JSON value through FMWCS_CanonicalJsonWriter. Key is ignored for array elements and the root.
+static void MWCS_WriteEngineValue(FMWCS_CanonicalJsonWriter &Writer, const FString &Key, const TSharedPtr<FJsonValue> &Value, bool bHasKey)
+{
+    const EJson Type = Value.IsValid() ? Value->Type : EJson::Null;
+    switch (Type)
+    {
+    case EJson::String:
+        if (bHasKey)
+            Writer.Write(Key, Value->AsString());
+        else
+            Writer.WriteElement(Value->AsString());
+        break;
+    case EJson::Number:
+        if (bHasKey)
+            Writer.Write(Key, Value->AsNumber());
+        else
+            Writer.WriteElement(Value->AsNumber());
+        break;
+    case EJson::Boolean:
+        if (bHasKey)
+            Writer.Write(Key, Value->AsBool());
+        else
+            Writer.WriteElement(Value->AsBool());
+        break;
+    case EJson::Array:
+        if (bHasKey)
+            Writer.BeginArray(Key);
+        else
+            Writer.BeginArray();
+        for (const TSharedPtr<FJsonValue> &Element : Value->AsArray())
+        {
+            MWCS_WriteEngineValue(Writer, FString(), Element, /*bHasKey*/ false);
+        }
+        Writer.EndArray();
+        break;
+    case EJson::Object:
+        if (bHasKey)
+            Writer.BeginObject(Key);
+        else
+            Writer.BeginObject();
+        for (const TPair<FString, TSharedPtr<FJsonValue>> &Pair : Value->AsObject()->Values)
+        {
+            MWCS_WriteEngineValue(Writer, Pair.Key, Pair.Value, /*bHasKey*/ true);
+        }
+        Writer.EndObject();
+        break;
+    default:
+        if (bHasKey)
+            Writer.WriteNull(Key);
+        else
+            Writer.WriteNullElement();
+        break;
+    }
+}
+
+// The engine reader, canonical writer and hash, computed independently of the core.
+static bool MWCS_EngineCanonical(const FString &Json, FString &OutPretty, FString &OutHash)
+{
+    TSharedPtr<FJsonObject> Root;
+    TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Json);
+    if (!FJsonSerializer::Deserialize(Reader, Root) || !Root.IsValid())
+    {
+        return false;
+    }
+    const TSharedPtr<FJsonValue> RootValue = MakeShared<FJsonValueObject>(Root);
+
+    FMWCS_CanonicalJsonWriter Pretty(/*bPretty*/ true);
+    MWCS_WriteEngineValue(Pretty, FString(), RootValue, /*bHasKey*/ false);
+    OutPretty = Pretty.GetOutput();
+
+    FMWCS_CanonicalJsonWriter Minified(/*bPretty*/ false);
+    MWCS_WriteEngineValue(Minified, FString(), RootValue, /*bHasKey*/ false);
+    const FTCHARToUTF8 Utf8(*Minified.GetOutput());
+    FSHAHash Hash;
+    FSHA1::HashBuffer(Utf8.Get(), Utf8.Length(), Hash.Hash);
+    OutHash = Hash.ToString();
+    return true;
+}
+
+static FString MWCS_IssueCodes(const FMWCS_Report &Report)
+{
+    TArray<FString> Codes;
+    for (const FMWCS_Issue &Issue : Report.Issues)
+    {
+        Codes.Add(Issue.Code);
+    }
+    return FString::Join(Codes, TEXT(","));
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMWCS_CoreCanonicalParityTest, "MWCS.Core.CanonicalMatchesEngineWriter", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+bool FMWCS_CoreCanonicalParityTest::RunTest(const FString &Parameters)
+{
+    TArray<FString> Jsons;
+    Jsons.Add(GetSampleSpecJson());
+    Jsons.Add(MakeSyntheticSpecJson(TEXT("WBP_MWCS_CoreParity"), 120));
+    Jsons.Add(TEXT(R"({"b": [1.50, -0.0000001, 1e15, 0.333333333, {}, []], "A": {"z": "tab\there \"quoted\" é", "a": null, "B": true}, "Key": 1, "key": 2})"));
+
+    const TSharedPtr<IPlugin> Plugin = IPluginManager::Get().FindPlugin(TEXT("P_MWCS"));
+    if (Plugin.IsValid())
+    {
+        TArray<FString> Files;
+        IFileManager::Get().FindFiles(Files, *FPaths::Combine(Plugin->GetBaseDir(), TEXT("Tests/TestSpecs/*.json")), /*Files*/ true, /*Directories*/ false);
+        for (const FString &File : Files)
+        {
+            FString Text;
+            if (FFileHelper::LoadFileToString(Text, *FPaths::Combine(Plugin->GetBaseDir(), TEXT("Tests/TestSpecs"), File)))
+            {
+                Jsons.Add(MoveTemp(Text));
+            }
+        }
+    }
+
+    for (int32 Index = 0; Index < Jsons.Num(); ++Index)
+    {
+        FString EnginePretty;
+        FString EngineHash;
+        if (!TestTrue(FString::Printf(TEXT("Document %d parses in the engine"), Index), MWCS_EngineCanonical(Jsons[Index], EnginePretty, EngineHash)))
+        {
+            continue;
+        }
+
+        const FTCHARToUTF8 Utf8(*Jsons[Index]);
+        MWCS_Core::FJsonNode Root;
+        if (!TestTrue(FString::Printf(TEXT("Document %d parses in the core"), Index), MWCS_Core::ParseJson(std::string_view(Utf8.Get(), Utf8.Length()), Root)))
+        {
+            continue;
+        }
+        TestEqual(FString::Printf(TEXT("Document %d canonical form"), Index), FString(UTF8_TO_TCHAR(MWCS_Core::Canonicalize(Root, /*bPretty*/ true).c_str())), EnginePretty);
+        TestEqual(FString::Printf(TEXT("Document %d hash"), Index), FString(UTF8_TO_TCHAR(MWCS_Core::SpecHash(Root).c_str())), EngineHash);
+    }
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMWCS_CoreLintTest, "MWCS.Core.Lint", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+bool FMWCS_CoreLintTest::RunTest(const FString &Parameters)
+{
+    FMWCS_Report Clean;
+    TestTrue(TEXT("Sample spec lints"), FMWCS_SpecParser::LintSpecJson(GetSampleSpecJson(), Clean, TEXT("MWCS_Tests")));
+    TestEqual(TEXT("Sample spec is clean"), MWCS_IssueCodes(Clean), FString());
+
+    const TCHAR *Dirty = TEXT(R"({
+        "BlueprintName": "WBP_Dirty", "ParentClass": "/Script/UMG.UserWidget", "Version": "1",
+        "Hierarchy": { "Type": "VerticalBox", "Name": "Root", "Children": [
+            { "Type": "TextBlock", "Name": "Label" },
+            { "Type": "TextBlock", "Name": "label" },
+            { "Type": "Slider", "Name": "Volume" }
+        ] },
+        "Bindings": { "Required": ["Missing"] }
+    })");
+    FMWCS_Report Report;
+    TestTrue(TEXT("Dirty spec lints"), FMWCS_SpecParser::LintSpecJson(Dirty, Report, TEXT("MWCS_Tests")));
+    TestEqual(TEXT("Lint codes"), MWCS_IssueCodes(Report), FString(TEXT("Lint.DuplicateName,Lint.UnknownType,Lint.Binding.NotInHierarchy")));
+    TestTrue(TEXT("Context carried"), Report.Issues.Num() > 0 && Report.Issues[0].Context == TEXT("MWCS_Tests"));
+
+    // Parse failures stop before the lint rules, with the parser's diagnostics.
+    FMWCS_Report Broken;
+    TestFalse(TEXT("Broken spec does not lint"), FMWCS_SpecParser::LintSpecJson(TEXT(R"({"BlueprintName": "WBP_X"})"), Broken, TEXT("MWCS_Tests")));
+    TestEqual(TEXT("Parser diagnostics"), MWCS_IssueCodes(Broken), FString(TEXT("Spec.MissingParentClass")));
+    return true;
+}
+
+#endif
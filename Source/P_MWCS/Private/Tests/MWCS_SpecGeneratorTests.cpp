@@ -0,0 +1,71 @@
+#include "MWCS_TestUtils.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "MWCS_SpecGenerator.h"
+
+#include "Misc/AutomationTest.h"
+#include "Misc/Paths.h"
+
+using namespace MWCS_Tests;
+
+static int32 MWCS_CountNodes(const FMWCS_HierarchyNode &Node, TArray<FString> &OutNestedClasses)
+{
+    if (Node.Type == TEXT("UserWidget"))
+    {
+        OutNestedClasses.Add(Node.WidgetClassPath);
+    }
+    int32 Count = 1;
+    for (const FMWCS_HierarchyNode &Child : Node.Children)
+    {
+        Count += MWCS_CountNodes(Child, OutNestedClasses);
+    }
+    return Count;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMWCS_SpecGeneratorTest, "MWCS.Generator.ParsesWithExactNodeCount", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+bool FMWCS_SpecGeneratorTest::RunTest(const FString &Parameters)
+{
+    FMWCS_SpecGeneratorOptions Options;
+    Options.NumSpecs = 4;
+    Options.NodesPerSpec = 150;
+    Options.Seed = 42;
+
+    TArray<FMWCS_GeneratedSpec> Generated;
+    FMWCS_SpecGenerator::Generate(Options, Generated);
+    if (!TestEqual(TEXT("Spec count"), Generated.Num(), Options.NumSpecs))
+    {
+        return false;
+    }
+
+    TArray<FMWCS_GeneratedSpec> Again;
+    FMWCS_SpecGenerator::Generate(Options, Again);
+    TestTrue(TEXT("Same seed, same bytes"), Again[3].Json == Generated[3].Json);
+
+    for (int32 Index = 0; Index < Generated.Num(); ++Index)
+    {
+        FMWCS_WidgetSpec Spec;
+        FMWCS_Report Report;
+        if (!TestTrue(FString::Printf(TEXT("Spec %d parses"), Index), ParseSpec(Generated[Index].Json, Spec, Report)))
+        {
+            continue;
+        }
+
+        TArray<FString> NestedClasses;
+        TestEqual(FString::Printf(TEXT("Spec %d node count"), Index), MWCS_CountNodes(Spec.HierarchyRoot, NestedClasses), Options.NodesPerSpec);
+        TestEqual(FString::Printf(TEXT("Spec %d nested count"), Index), NestedClasses.Num(), Generated[Index].NumNested);
+        TestTrue(FString::Printf(TEXT("Spec %d has Design entries"), Index), Spec.Design.Num() > 0);
+
+        // Only earlier specs may be nested, so the corpus builds in file order.
+        for (const FString &ClassPath : NestedClasses)
+        {
+            const FString Target = FPaths::GetBaseFilename(ClassPath);
+            TestTrue(FString::Printf(TEXT("Spec %d nests an earlier spec (%s)"), Index, *Target), Target < Generated[Index].BlueprintName.ToString());
+            TestTrue(TEXT("Nested blueprint listed in Dependencies"), Spec.Dependencies.ContainsByPredicate([&ClassPath](const FString &Dependency)
+                                                                                                             { return ClassPath.StartsWith(Dependency); }));
+        }
+    }
+    return true;
+}
+
+#endif
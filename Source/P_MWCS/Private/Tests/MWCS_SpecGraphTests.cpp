@@ -0,0 +1,66 @@
+#include "MWCS_TestUtils.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "MWCS_SpecGraph.h"
+
+#include "Misc/AutomationTest.h"
+
+using namespace MWCS_Tests;
+
+static FMWCS_WidgetSpec MWCS_MakeGraphSpec(const TCHAR *Name, const TCHAR *ParentClass, const TCHAR *NestedClass = nullptr)
+{
+    FMWCS_WidgetSpec Spec;
+    Spec.BlueprintName = FName(Name);
+    Spec.ParentClassPath = ParentClass;
+    Spec.HierarchyRoot.Type = TEXT("CanvasPanel");
+    Spec.HierarchyRoot.Name = TEXT("Root");
+    if (NestedClass)
+    {
+        FMWCS_HierarchyNode &Nested = Spec.HierarchyRoot.Children.AddDefaulted_GetRef();
+        Nested.Type = TEXT("UserWidget");
+        Nested.Name = TEXT("Nested");
+        Nested.WidgetClassPath = NestedClass;
+    }
+    return Spec;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMWCS_SpecGraphEdgesTest, "MWCS.SpecGraph.Edges", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+bool FMWCS_SpecGraphEdgesTest::RunTest(const FString &Parameters)
+{
+    const TCHAR *Root = TEXT("/Game/UI");
+    TArray<FMWCS_WidgetSpec> Specs;
+    // 0 and 1 share a native parent; 2 nests that native class. None of them are linked by it.
+    Specs.Add(MWCS_MakeGraphSpec(TEXT("WBP_ButtonA"), TEXT("/Script/Game.MyButton")));
+    Specs.Add(MWCS_MakeGraphSpec(TEXT("WBP_ButtonB"), TEXT("/Script/Game.MyButton")));
+    Specs.Add(MWCS_MakeGraphSpec(TEXT("WBP_Panel"), TEXT("/Script/UMG.UserWidget"), TEXT("/Script/Game.MyButton")));
+    // 3 derives from 4's generated class (listed after it); 5 nests 0's generated class.
+    Specs.Add(MWCS_MakeGraphSpec(TEXT("WBP_Derived"), TEXT("/Game/UI/WBP_Base.WBP_Base_C")));
+    Specs.Add(MWCS_MakeGraphSpec(TEXT("WBP_Base"), TEXT("/Script/UMG.UserWidget")));
+    Specs.Add(MWCS_MakeGraphSpec(TEXT("WBP_Menu"), TEXT("/Script/UMG.UserWidget"), TEXT("/Game/UI/WBP_ButtonA.WBP_ButtonA_C")));
+
+    FMWCS_SpecGraph Graph;
+    Graph.Build(Specs, Root);
+
+    TestEqual(TEXT("Native parent is not a provider"), Graph.GetDependents(0).Num(), 1);
+    TestEqual(TEXT("Nesting a native class adds no edge"), Graph.GetDependencies(2).Num(), 0);
+    TestEqual(TEXT("Siblings of a native parent are unlinked"), Graph.GetDependencies(1).Num() + Graph.GetDependents(1).Num(), 0);
+    TestTrue(TEXT("Nested generated class is a dependency"), Graph.GetDependencies(5).Contains(0));
+    TestTrue(TEXT("Generated parent class is a dependency"), Graph.GetDependencies(3).Contains(4));
+    TestTrue(TEXT("Derived spec is a dependent"), Graph.GetDependents(4).Contains(3));
+
+    TSet<int32> Selected = {4};
+    Graph.ExpandDependents(Selected);
+    TestTrue(TEXT("Changing the base selects the derived spec"), Selected.Contains(3) && Selected.Num() == 2);
+
+    TArray<int32> Order = {3, 4};
+    Graph.SortDependenciesFirst(Order);
+    TestTrue(TEXT("Base builds before derived"), Order == TArray<int32>({4, 3}));
+
+    TArray<TArray<int32>> Components;
+    Graph.GetComponents(Components);
+    TestEqual(TEXT("Components"), Components.Num(), 4); // {0,5} {1} {2} {3,4}
+    return true;
+}
+
+#endif
@@ -0,0 +1,376 @@
+#include "MWCS_TestUtils.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "MWCS_SpecParser.h"
+
+#include "HAL/FileManager.h"
+#include "Interfaces/IPluginManager.h"
+#include "Math/RandomStream.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+using namespace MWCS_Tests;
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMWCS_ParserRejectsInvalidJsonTest, "MWCS.Parser.RejectsInvalidJson", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+bool FMWCS_ParserRejectsInvalidJsonTest::RunTest(const FString &Parameters)
+{
+    FMWCS_WidgetSpec Spec;
+    FMWCS_Report Report;
+    TestFalse(TEXT("Truncated JSON fails"), ParseSpec(TEXT("{\"BlueprintName\": \"WBP_X\","), Spec, Report));
+    TestTrue(TEXT("Spec.InvalidJson reported"), HasIssue(Report, TEXT("Spec.InvalidJson")));
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMWCS_ParserRequiredFieldsTest, "MWCS.Parser.RequiredFields", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+bool FMWCS_ParserRequiredFieldsTest::RunTest(const FString &Parameters)
+{
+    struct FCase
+    {
+        const TCHAR *Json;
+        const TCHAR *Code;
+    };
+    const FCase Cases[] = {
+        {TEXT(R"({"ParentClass":"/Script/UMG.UserWidget","Version":"1","Hierarchy":{"Type":"CanvasPanel"}})"), TEXT("Spec.MissingBlueprintName")},
+        {TEXT(R"({"BlueprintName":"WBP_X","Version":"1","Hierarchy":{"Type":"CanvasPanel"}})"), TEXT("Spec.MissingParentClass")},
+        {TEXT(R"({"BlueprintName":"WBP_X","ParentClass":"/Script/UMG.UserWidget","Hierarchy":{"Type":"CanvasPanel"}})"), TEXT("Spec.MissingVersion")},
+        {TEXT(R"({"BlueprintName":"WBP_X","ParentClass":"/Script/UMG.UserWidget","Version":"1"})"), TEXT("Spec.MissingHierarchy")},
+        {TEXT(R"({"BlueprintName":"WBP_X","ParentClass":"/Script/UMG.UserWidget","Version":"1","Hierarchy":{"Root":{"Name":"NoType"}}})"), TEXT("Spec.InvalidHierarchy")},
+    };
+
+    for (const FCase &Case : Cases)
+    {
+        FMWCS_WidgetSpec Spec;
+        FMWCS_Report Report;
+        TestFalse(FString::Printf(TEXT("%s: parse fails"), Case.Code), ParseSpec(Case.Json, Spec, Report));
+        TestTrue(FString::Printf(TEXT("%s: reported"), Case.Code), HasIssue(Report, Case.Code));
+    }
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMWCS_ParserOptionalSectionsTest, "MWCS.Parser.OptionalSections", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+bool FMWCS_ParserOptionalSectionsTest::RunTest(const FString &Parameters)
+{
+    // No Bindings, no "Root" wrapper, a child without a Type (skipped).
+    const TCHAR *Json = TEXT(R"({
+        "BlueprintName": "WBP_Optional",
+        "ParentClass": "/Script/UMG.UserWidget",
+        "Version": "1.0.0",
+        "Hierarchy": {
+            "Type": "VerticalBox",
+            "Name": "Root",
+            "Children": [
+                { "Type": "TextBlock", "Name": "Title", "Text": "Hello", "FontSize": 18, "Justification": "Center" },
+                { "Name": "Untyped" },
+                { "Type": "Spacer", "Name": "Gap", "Properties": { "Size": { "X": 0, "Y": 12 } } }
+            ]
+        }
+    })");
+
+    FMWCS_WidgetSpec Spec;
+    FMWCS_Report Report;
+    if (!TestTrue(TEXT("Parses"), ParseSpec(Json, Spec, Report)))
+    {
+        return false;
+    }
+    TestTrue(TEXT("Missing Bindings is a warning"), HasIssue(Report, TEXT("Spec.MissingBindings")) && !Report.HasErrors());
+    TestTrue(TEXT("Root without wrapper"), Spec.HierarchyRoot.Name == FName(TEXT("Root")));
+    if (!TestEqual(TEXT("Untyped child skipped"), Spec.HierarchyRoot.Children.Num(), 2))
+    {
+        return false;
+    }
+
+    const FMWCS_HierarchyNode &Title = Spec.HierarchyRoot.Children[0];
+    TestEqual(TEXT("Text"), Title.Text, FString(TEXT("Hello")));
+    TestEqual(TEXT("FontSize"), Title.FontSize, 18);
+    TestEqual(TEXT("Justification"), Title.Justification, FString(TEXT("Center")));
+    TestTrue(TEXT("IsVariable defaults to true"), Title.bIsVariable);
+
+    const FMWCS_HierarchyNode &Gap = Spec.HierarchyRoot.Children[1];
+    TestTrue(TEXT("Spacer size parsed"), Gap.bHasSpacerSize && Gap.SpacerSize.Equals(FVector2D(0.0, 12.0)));
+    TestTrue(TEXT("Default preview"), Spec.DesignerPreview.SizeMode == EMWCS_PreviewSizeMode::FillScreen);
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMWCS_ParserSlotFormsTest, "MWCS.Parser.SlotForms", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+bool FMWCS_ParserSlotFormsTest::RunTest(const FString &Parameters)
+{
+    // The array and object forms of Padding, and the three forms of Size, must parse to the same values.
+    const TCHAR *Json = TEXT(R"({
+        "BlueprintName": "WBP_Slots",
+        "ParentClass": "/Script/UMG.UserWidget",
+        "Version": "1.0.0",
+        "Hierarchy": { "Root": {
+            "Type": "VerticalBox",
+            "Name": "Root",
+            "Children": [
+                { "Type": "TextBlock", "Name": "A", "Slot": { "Padding": [1, 2, 3, 4], "Fill": 2, "HAlign": "Right" } },
+                { "Type": "TextBlock", "Name": "B", "Slot": { "Padding": { "Left": 1, "Top": 2, "Right": 3, "Bottom": 4 }, "Size": 2, "VAlign": "bottom" } },
+                { "Type": "TextBlock", "Name": "C", "Slot": { "Size": { "Rule": "Auto" } } },
+                { "Type": "TextBlock", "Name": "D", "Slot": { "Canvas": { "Anchors": { "Min": [0.5, 0], "Max": [1, 1] }, "Offsets": [10, 20, 30, 40], "ZOrder": 3, "AutoSize": true } } }
+            ]
+        } },
+        "Bindings": { "Required": ["A", { "Name": "B", "Type": "UTextBlock" }], "Optional": [] }
+    })");
+
+    FMWCS_WidgetSpec Spec;
+    FMWCS_Report Report;
+    if (!TestTrue(TEXT("Parses"), ParseSpec(Json, Spec, Report)) || !TestEqual(TEXT("Children"), Spec.HierarchyRoot.Children.Num(), 4))
+    {
+        return false;
+    }
+
+    const FMWCS_HierarchyNode &A = Spec.HierarchyRoot.Children[0];
+    const FMWCS_HierarchyNode &B = Spec.HierarchyRoot.Children[1];
+    const FMWCS_HierarchyNode &C = Spec.HierarchyRoot.Children[2];
+    const FMWCS_HierarchyNode &D = Spec.HierarchyRoot.Children[3];
+
+    TestTrue(TEXT("Array padding"), A.bHasSlotPadding && A.SlotPadding == FMargin(1.0f, 2.0f, 3.0f, 4.0f));
+    TestTrue(TEXT("Object padding"), B.bHasSlotPadding && B.SlotPadding == A.SlotPadding);
+    TestTrue(TEXT("Fill number"), A.bHasSlotSize && A.SlotSizeRule == ESlateSizeRule::Fill && A.SlotSizeValue == 2.0f);
+    TestTrue(TEXT("Size number is Fill"), B.bHasSlotSize && B.SlotSizeRule == ESlateSizeRule::Fill && B.SlotSizeValue == 2.0f);
+    TestTrue(TEXT("Size Auto"), C.bHasSlotSize && C.SlotSizeRule == ESlateSizeRule::Automatic);
+    TestTrue(TEXT("HAlign"), A.bHasSlotHAlign && A.SlotHAlign == HAlign_Right);
+    TestTrue(TEXT("VAlign ignores case"), B.bHasSlotVAlign && B.SlotVAlign == VAlign_Bottom);
+    TestFalse(TEXT("Unset slot fields stay unset"), C.bHasSlotPadding || C.bHasSlotHAlign || C.bHasCanvasAnchors);
+
+    TestTrue(TEXT("Canvas anchors"), D.bHasCanvasAnchors && D.CanvasAnchorsMin.Equals(FVector2D(0.5, 0.0)) && D.CanvasAnchorsMax.Equals(FVector2D(1.0, 1.0)));
+    TestTrue(TEXT("Canvas offsets"), D.bHasCanvasOffsets && D.CanvasOffsets == FMargin(10.0f, 20.0f, 30.0f, 40.0f));
+    TestTrue(TEXT("Canvas ZOrder"), D.bHasCanvasZOrder && D.CanvasZOrder == 3);
+    TestTrue(TEXT("Canvas AutoSize"), D.bHasCanvasAutoSize && D.bCanvasAutoSize);
+
+    TestEqual(TEXT("Required bindings"), Spec.Bindings.Required.Num(), 2);
+    const FString *BindingType = Spec.Bindings.Types.Find(TEXT("B"));
+    TestTrue(TEXT("Binding type hint"), BindingType && *BindingType == TEXT("UTextBlock"));
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMWCS_ParserContainerMacrosTest, "MWCS.Parser.ContainerMacros", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+bool FMWCS_ParserContainerMacrosTest::RunTest(const FString &Parameters)
+{
+    const TCHAR *Json = TEXT(R"({
+        "BlueprintName": "WBP_Macros",
+        "ParentClass": "/Script/UMG.UserWidget",
+        "Version": "1.0.0",
+        "Hierarchy": { "Root": {
+            "Type": "HorizontalBox",
+            "Name": "Root",
+            "Properties": { "Spacing": 8, "SizeToContent": true },
+            "Children": [
+                { "Type": "TextBlock", "Name": "First", "Slot": { "Fill": 1 } },
+                { "Type": "TextBlock", "Name": "Second", "Slot": { "Padding": [0, 5, 0, 5] } }
+            ]
+        } },
+        "Bindings": { "Required": [], "Optional": [] }
+    })");
+
+    FMWCS_WidgetSpec Spec;
+    FMWCS_Report Report;
+    if (!TestTrue(TEXT("Parses"), ParseSpec(Json, Spec, Report)) || !TestEqual(TEXT("Children"), Spec.HierarchyRoot.Children.Num(), 2))
+    {
+        return false;
+    }
+
+    const FMWCS_HierarchyNode &First = Spec.HierarchyRoot.Children[0];
+    const FMWCS_HierarchyNode &Second = Spec.HierarchyRoot.Children[1];
+    TestFalse(TEXT("Spacing skips the first child"), First.bHasSlotPadding);
+    TestTrue(TEXT("Spacing sets Left and keeps the rest"), Second.bHasSlotPadding && Second.SlotPadding == FMargin(8.0f, 5.0f, 0.0f, 5.0f));
+    TestTrue(TEXT("SizeToContent overrides Fill"), First.bHasSlotSize && First.SlotSizeRule == ESlateSizeRule::Automatic);
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMWCS_ParserDesignAndPreviewTest, "MWCS.Parser.DesignAndPreview", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+bool FMWCS_ParserDesignAndPreviewTest::RunTest(const FString &Parameters)
+{
+    const TCHAR *Json = TEXT(R"({
+        "BlueprintName": "WBP_Design",
+        "ParentClass": "/Script/UMG.UserWidget",
+        "Version": "1.0.0",
+        "DesignerPreview": { "SizeMode": "Custom", "CustomSize": { "Width": 640, "Height": 360 } },
+        "Hierarchy": { "Root": { "Type": "CanvasPanel", "Name": "Root", "Children": [ { "Type": "Image", "Name": "Icon" } ] } },
+        "Design": {
+            "Icon": { "Properties": { "ColorAndOpacity": { "R": 1, "G": 0, "B": 0, "A": 1 } } },
+            "Ignored": 5
+        },
+        "Dependencies": [ "/Engine/EngineResources/WhiteSquareTexture.WhiteSquareTexture" ],
+        "Bindings": { "Required": [], "Optional": [] }
+    })");
+
+    FMWCS_WidgetSpec Spec;
+    FMWCS_Report Report;
+    if (!TestTrue(TEXT("Parses"), ParseSpec(Json, Spec, Report)))
+    {
+        return false;
+    }
+    TestTrue(TEXT("Custom preview"), Spec.DesignerPreview.SizeMode == EMWCS_PreviewSizeMode::Custom);
+    TestTrue(TEXT("Custom size"), Spec.DesignerPreview.CustomSize.Equals(FVector2D(640.0, 360.0)));
+    TestEqual(TEXT("Non-object design entries skipped"), Spec.Design.Num(), 1);
+    const TSharedPtr<FJsonObject> *Icon = Spec.Design.Find(TEXT("Icon"));
+    TestTrue(TEXT("Properties wrapper unwrapped"), Icon && Icon->IsValid() && (*Icon)->HasField(TEXT("ColorAndOpacity")));
+    TestEqual(TEXT("Dependencies"), Spec.Dependencies.Num(), 1);
+
+    // Custom mode without a positive size is a hard error.
+    FMWCS_WidgetSpec Invalid;
+    FMWCS_Report InvalidReport;
+    const FString InvalidJson = FString(Json).Replace(TEXT("\"Width\": 640"), TEXT("\"Width\": 0"));
+    TestFalse(TEXT("Zero custom size fails"), ParseSpec(InvalidJson, Invalid, InvalidReport));
+    TestTrue(TEXT("DesignerPreview.InvalidCustomSize reported"), HasIssue(InvalidReport, TEXT("DesignerPreview.InvalidCustomSize")));
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMWCS_ParserSpecHashTest, "MWCS.Parser.SpecHash", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+bool FMWCS_ParserSpecHashTest::RunTest(const FString &Parameters)
+{
+    const TCHAR *Compact = TEXT(R"({"BlueprintName":"WBP_Hash","ParentClass":"/Script/UMG.UserWidget","Version":"1","Hierarchy":{"Type":"CanvasPanel","Name":"Root"}})");
+    const TCHAR *Reordered = TEXT(R"({
+        "Hierarchy": { "Name": "Root", "Type": "CanvasPanel" },
+        "Version": "1",
+        "ParentClass": "/Script/UMG.UserWidget",
+        "BlueprintName": "WBP_Hash"
+    })");
+    const TCHAR *Changed = TEXT(R"({"BlueprintName":"WBP_Hash","ParentClass":"/Script/UMG.UserWidget","Version":"1","Hierarchy":{"Type":"CanvasPanel","Name":"Other"}})");
+
+    FMWCS_WidgetSpec A, B, C;
+    FMWCS_Report Report;
+    if (!TestTrue(TEXT("Parses"), ParseSpec(Compact, A, Report) && ParseSpec(Reordered, B, Report) && ParseSpec(Changed, C, Report)))
+    {
+        return false;
+    }
+    TestFalse(TEXT("Hash set"), A.SpecHash.IsEmpty());
+    TestEqual(TEXT("Whitespace and key order do not change the hash"), A.SpecHash, B.SpecHash);
+    TestNotEqual(TEXT("Content changes the hash"), A.SpecHash, C.SpecHash);
+    return true;
+}
+
+// A Border chain Depth widgets deep ending in a Spacer.
+static FString MWCS_MakeNestedSpecJson(int32 Depth)
+{
+    FString Json = TEXT(R"({"BlueprintName":"WBP_Deep","ParentClass":"/Script/UMG.UserWidget","Version":"1","Bindings":{},"Hierarchy":)");
+    for (int32 Level = 0; Level < Depth; ++Level)
+    {
+        Json += Level + 1 < Depth ? TEXT(R"({"Type":"Border","Children":[)") : TEXT(R"({"Type":"Spacer"})");
+    }
+    for (int32 Level = 1; Level < Depth; ++Level)
+    {
+        Json += TEXT("]}");
+    }
+    return Json + TEXT("}");
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMWCS_ParserLimitsTest, "MWCS.Parser.Limits", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+bool FMWCS_ParserLimitsTest::RunTest(const FString &Parameters)
+{
+    const MWCS_Core::FSpecParseOptions Options = FMWCS_SpecParser::GetCoreParseOptions();
+
+    FMWCS_WidgetSpec Spec;
+    FMWCS_Report Report;
+    TestTrue(TEXT("Hierarchy at the depth limit parses"), ParseSpec(MWCS_MakeNestedSpecJson(Options.MaxHierarchyDepth), Spec, Report));
+
+    struct FCase
+    {
+        FString Json;
+        const TCHAR *Code;
+    };
+    const FCase Cases[] = {
+        {MWCS_MakeNestedSpecJson(Options.MaxHierarchyDepth + 1), TEXT("Spec.Limit.HierarchyDepth")},
+        {FString::ChrN(100000, TEXT('[')) + FString::ChrN(100000, TEXT(']')), TEXT("Spec.Limit.JsonNesting")},
+        {FString::Printf(TEXT(R"({"BlueprintName":"%s"})"), *FString::ChrN(static_cast<int32>(Options.Json.MaxStringBytes) + 1, TEXT('W'))), TEXT("Spec.Limit.StringLength")},
+    };
+    for (const FCase &Case : Cases)
+    {
+        FMWCS_WidgetSpec CaseSpec;
+        FMWCS_Report CaseReport;
+        TestFalse(FString::Printf(TEXT("%s: parse fails"), Case.Code), ParseSpec(Case.Json, CaseSpec, CaseReport));
+        TestTrue(FString::Printf(TEXT("%s: reported"), Case.Code), CaseReport.Issues.Num() == 1 && CaseReport.Issues[0].Code == Case.Code);
+    }
+    return true;
+}
+
+// libFuzzer-style mutation pass over the seed corpus (sample spec + Tests/TestSpecs) through the full ParseSpecJson.
+// Tools/MWCSLint/Fuzz runs the real fuzzer on the core; this keeps the engine half (the recursive ParseHierarchyNode
+// that pairs core nodes with their FJsonNode, and the Design conversion to FJsonObject) covered.
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMWCS_ParserFuzzTest, "MWCS.Parser.Fuzz", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+bool FMWCS_ParserFuzzTest::RunTest(const FString &Parameters)
+{
+    TArray<FString> Seeds;
+    Seeds.Add(GetSampleSpecJson());
+    Seeds.Add(MWCS_MakeNestedSpecJson(40));
+    const TSharedPtr<IPlugin> Plugin = IPluginManager::Get().FindPlugin(TEXT("P_MWCS"));
+    if (Plugin.IsValid())
+    {
+        const FString SeedDir = FPaths::Combine(Plugin->GetBaseDir(), TEXT("Tests/TestSpecs"));
+        TArray<FString> Files;
+        IFileManager::Get().FindFiles(Files, *FPaths::Combine(SeedDir, TEXT("*.json")), /*Files*/ true, /*Directories*/ false);
+        for (const FString &File : Files)
+        {
+            FString Text;
+            if (FFileHelper::LoadFileToString(Text, *FPaths::Combine(SeedDir, File)))
+            {
+                Seeds.Add(MoveTemp(Text));
+            }
+        }
+    }
+
+    static const TCHAR *Tokens[] = {TEXT("{"), TEXT("}"), TEXT("["), TEXT("]"), TEXT(","), TEXT(":"), TEXT("\""), TEXT("\\u"), TEXT("\\ud800"),
+                                    TEXT("1e400"), TEXT("-0"), TEXT("null"), TEXT("true"), TEXT("\"Children\":["), TEXT("{\"Type\":\"Border\",\"Children\":[")};
+
+    FRandomStream Stream(46);
+    constexpr int32 NumInputs = 2000;
+    int32 NumAccepted = 0;
+    for (int32 Input = 0; Input < NumInputs; ++Input)
+    {
+        FString Json = Seeds[Stream.RandRange(0, Seeds.Num() - 1)];
+        for (int32 Mutation = Stream.RandRange(1, 6); Mutation > 0; --Mutation)
+        {
+            const int32 Pos = Stream.RandRange(0, Json.Len());
+            switch (Stream.RandRange(0, 5))
+            {
+            case 0:
+                if (Pos < Json.Len())
+                {
+                    Json[Pos] = static_cast<TCHAR>(Stream.RandRange(1, 127));
+                }
+                break;
+            case 1:
+                if (Pos < Json.Len())
+                {
+                    Json.RemoveAt(Pos, FMath::Min(Stream.RandRange(1, 8), Json.Len() - Pos));
+                }
+                break;
+            case 2:
+                Json.InsertAt(Pos, Tokens[Stream.RandRange(0, UE_ARRAY_COUNT(Tokens) - 1)]);
+                break;
+            case 3:
+            {
+                const int32 End = Stream.RandRange(Pos, Json.Len());
+                Json.InsertAt(End, Json.Mid(Pos, End - Pos));
+                break;
+            }
+            case 4:
+                Json.LeftInline(Pos);
+                break;
+            default:
+                Json.InsertAt(Pos, FString::ChrN(Stream.RandRange(0, 400), Stream.RandBool() ? TEXT('[') : TEXT('{')));
+                break;
+            }
+        }
+
+        FMWCS_WidgetSpec Spec;
+        FMWCS_Report Report;
+        const bool bParsed = ParseSpec(Json, Spec, Report);
+        NumAccepted += bParsed ? 1 : 0;
+        if (bParsed && Spec.HierarchyRoot.Type.IsNone())
+        {
+            AddError(FString::Printf(TEXT("Accepted input %d without a root widget: %s"), Input, *Json.Left(512)));
+        }
+        if (bParsed && Spec.SpecHash.Len() != 40)
+        {
+            AddError(FString::Printf(TEXT("Accepted input %d without a spec hash: %s"), Input, *Json.Left(512)));
+        }
+    }
+    AddInfo(FString::Printf(TEXT("%d of %d mutated inputs parsed"), NumAccepted, NumInputs));
+    return true;
+}
+
+#endif
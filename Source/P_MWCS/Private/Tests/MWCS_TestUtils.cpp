@@ -0,0 +1,108 @@
+#include "MWCS_TestUtils.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "MWCS_SpecParser.h"
+#include "MWCS_WidgetBuilder.h"
+
+#include "WidgetBlueprint.h"
+
+namespace MWCS_Tests
+{
+    bool HasIssue(const FMWCS_Report &Report, const TCHAR *Code)
+    {
+        return Report.Issues.ContainsByPredicate([Code](const FMWCS_Issue &Issue)
+                                                 { return Issue.Code == Code; });
+    }
+
+    bool ParseSpec(const FString &Json, FMWCS_WidgetSpec &OutSpec, FMWCS_Report &OutReport)
+    {
+        return FMWCS_SpecParser::ParseSpecJson(Json, OutSpec, OutReport, TEXT("MWCS_Tests"));
+    }
+
+    UWidgetBlueprint *BuildTransient(const FMWCS_WidgetSpec &Spec, FMWCS_Report &OutReport)
+    {
+        FMWCS_BuildOptions Options;
+        Options.OutputPathOverride = TEXT("/Temp/MWCS_Tests");
+        Options.bSkipSave = true;
+        UWidgetBlueprint *Blueprint = nullptr;
+        if (!FMWCS_WidgetBuilder::CreateOrUpdateFromSpec(Spec, EMWCS_BuildMode::ForceRecreate, Options, OutReport, &Blueprint))
+        {
+            return nullptr;
+        }
+        return Blueprint;
+    }
+
+    const TCHAR *GetSampleSpecJson()
+    {
+        return TEXT(R"({
+            "BlueprintName": "WBP_MWCS_BuilderTest",
+            "ParentClass": "/Script/UMG.UserWidget",
+            "Version": "1.0.0",
+            "Hierarchy": { "Root": {
+                "Type": "CanvasPanel",
+                "Name": "Root",
+                "Children": [
+                    {
+                        "Type": "VerticalBox",
+                        "Name": "Column",
+                        "Slot": { "Canvas": { "Anchors": { "Min": [0, 0], "Max": [1, 1] }, "Offsets": [10, 20, 30, 40], "ZOrder": 2 } },
+                        "Children": [
+                            { "Type": "TextBlock", "Name": "Title", "Text": "Hello", "FontSize": 24, "Justification": "Center",
+                              "Slot": { "Padding": [1, 2, 3, 4], "HAlign": "Center", "Size": { "Rule": "Auto" } } },
+                            { "Type": "Image", "Name": "Icon", "Slot": { "Fill": 2 } },
+                            { "Type": "Throbber", "Name": "Spinner" }
+                        ]
+                    }
+                ]
+            } },
+            "Design": {
+                "Icon": { "ColorAndOpacity": { "R": 1, "G": 0, "B": 0, "A": 1 }, "Size": { "X": 64, "Y": 32 } },
+                "Spinner": { "NumberOfPieces": 6 }
+            },
+            "Bindings": { "Required": ["Title"], "Optional": [] }
+        })");
+    }
+
+    FString MakeSyntheticSpecJson(const FString &BlueprintName, int32 NodeCount)
+    {
+        FString Hierarchy;
+        FString Design;
+        int32 Remaining = FMath::Max(0, NodeCount - 1);
+        int32 Row = 0;
+        while (Remaining > 0)
+        {
+            const int32 NumLeaves = FMath::Min(9, Remaining - 1);
+            Remaining -= NumLeaves + 1;
+
+            FString Leaves;
+            for (int32 Leaf = 0; Leaf < NumLeaves; ++Leaf)
+            {
+                const FString Name = FString::Printf(TEXT("W_%d_%d"), Row, Leaf);
+                if (Leaf % 3 == 2)
+                {
+                    Leaves += FString::Printf(TEXT("%s{\"Type\":\"Image\",\"Name\":\"%s\",\"Slot\":{\"Padding\":[2,2,2,2],\"VAlign\":\"Center\"}}"),
+                                              Leaves.IsEmpty() ? TEXT("") : TEXT(","), *Name);
+                    Design += FString::Printf(TEXT("%s\"%s\":{\"ColorAndOpacity\":{\"R\":0.5,\"G\":0.25,\"B\":1,\"A\":1},\"Size\":{\"X\":32,\"Y\":32}}"),
+                                              Design.IsEmpty() ? TEXT("") : TEXT(","), *Name);
+                }
+                else
+                {
+                    Leaves += FString::Printf(TEXT("%s{\"Type\":\"TextBlock\",\"Name\":\"%s\",\"Text\":\"Item %d\",\"FontSize\":14,\"Slot\":{\"Padding\":[4,0,4,0],\"Fill\":1}}"),
+                                              Leaves.IsEmpty() ? TEXT("") : TEXT(","), *Name, Leaf);
+                }
+            }
+
+            Hierarchy += FString::Printf(TEXT("%s{\"Type\":\"HorizontalBox\",\"Name\":\"Row_%d\",\"Slot\":{\"Size\":{\"Rule\":\"Auto\"}},\"Children\":[%s]}"),
+                                         Hierarchy.IsEmpty() ? TEXT("") : TEXT(","), Row, *Leaves);
+            ++Row;
+        }
+
+        return FString::Printf(TEXT("{\"BlueprintName\":\"%s\",\"ParentClass\":\"/Script/UMG.UserWidget\",\"Version\":\"1.0.0\","
+                                    "\"Hierarchy\":{\"Root\":{\"Type\":\"VerticalBox\",\"Name\":\"Root\",\"Children\":[%s]}},"
+                                    "\"Design\":{%s},\"Bindings\":{\"Required\":[],\"Optional\":[]}}"),
+                               *BlueprintName, *Hierarchy, *Design);
+    }
+}
+
+#endif
@@ -0,0 +1,33 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "MWCS_Report.h"
+#include "MWCS_WidgetSpec.h"
+
+class UWidgetBlueprint;
+
+// Shared helpers for the MWCS.* automation tests. Blueprints are built into /Temp and never saved,
+// so the tests need no project content and run under -NullRHI.
+namespace MWCS_Tests
+{
+    bool HasIssue(const FMWCS_Report &Report, const TCHAR *Code);
+
+    // Parses with a fixed "MWCS_Tests" context.
+    bool ParseSpec(const FString &Json, FMWCS_WidgetSpec &OutSpec, FMWCS_Report &OutReport);
+
+    // ForceRecreate into /Temp/MWCS_Tests without saving; null when the build fails.
+    UWidgetBlueprint *BuildTransient(const FMWCS_WidgetSpec &Spec, FMWCS_Report &OutReport);
+
+    // WBP_MWCS_BuilderTest: a canvas root with a VerticalBox column (Title TextBlock, Icon Image, Spinner Throbber)
+    // using canvas and box slot metadata, text metadata and Image/Throbber Design entries.
+    const TCHAR *GetSampleSpecJson();
+
+    // A spec with exactly NodeCount widgets: a VerticalBox root holding HorizontalBox rows of up to nine
+    // TextBlock/Image leaves, every leaf with slot metadata and every Image with a Design entry.
+    FString MakeSyntheticSpecJson(const FString &BlueprintName, int32 NodeCount);
+}
+
+#endif
@@ -0,0 +1,180 @@
+#include "MWCS_TestUtils.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "MWCS_SpecOptimizer.h"
+#include "MWCS_WidgetValidator.h"
+
+#include "Blueprint/WidgetTree.h"
+#include "Components/CanvasPanelSlot.h"
+#include "Components/Image.h"
+#include "Components/TextBlock.h"
+#include "Components/Throbber.h"
+#include "Components/VerticalBoxSlot.h"
+#include "Misc/AutomationTest.h"
+#include "WidgetBlueprint.h"
+
+using namespace MWCS_Tests;
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMWCS_BuilderSlotsAndDesignTest, "MWCS.Builder.SlotsAndDesign", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+bool FMWCS_BuilderSlotsAndDesignTest::RunTest(const FString &Parameters)
+{
+    FMWCS_WidgetSpec Spec;
+    FMWCS_Report Report;
+    if (!TestTrue(TEXT("Parses"), ParseSpec(GetSampleSpecJson(), Spec, Report)))
+    {
+        return false;
+    }
+    UWidgetBlueprint *Blueprint = BuildTransient(Spec, Report);
+    if (!TestNotNull(TEXT("Builds"), Blueprint) || !TestNotNull(TEXT("WidgetTree"), Blueprint->WidgetTree.Get()))
+    {
+        return false;
+    }
+    TestFalse(TEXT("No build errors"), Report.HasErrors());
+
+    UWidgetTree *Tree = Blueprint->WidgetTree;
+    TestTrue(TEXT("Root is the spec root"), Tree->RootWidget && Tree->RootWidget->GetFName() == TEXT("Root"));
+
+    UWidget *Column = Tree->FindWidget(TEXT("Column"));
+    UCanvasPanelSlot *CanvasSlot = Column ? Cast<UCanvasPanelSlot>(Column->Slot) : nullptr;
+    if (TestNotNull(TEXT("Column has a canvas slot"), CanvasSlot))
+    {
+        const FAnchors Anchors = CanvasSlot->GetAnchors();
+        TestTrue(TEXT("Anchors"), Anchors.Minimum.Equals(FVector2D(0.0, 0.0)) && Anchors.Maximum.Equals(FVector2D(1.0, 1.0)));
+        TestTrue(TEXT("Offsets"), CanvasSlot->GetOffsets() == FMargin(10.0f, 20.0f, 30.0f, 40.0f));
+        TestEqual(TEXT("ZOrder"), CanvasSlot->GetZOrder(), 2);
+    }
+
+    UTextBlock *Title = Cast<UTextBlock>(Tree->FindWidget(TEXT("Title")));
+    if (TestNotNull(TEXT("Title"), Title))
+    {
+        TestEqual(TEXT("Text"), Title->GetText().ToString(), FString(TEXT("Hello")));
+        TestEqual(TEXT("Font size"), static_cast<int32>(Title->GetFont().Size), 24);
+        TestTrue(TEXT("Justification"), Title->GetJustification() == ETextJustify::Center);
+
+        UVerticalBoxSlot *Slot = Cast<UVerticalBoxSlot>(Title->Slot);
+        if (TestNotNull(TEXT("Title has a vertical box slot"), Slot))
+        {
+            TestTrue(TEXT("Padding"), Slot->GetPadding() == FMargin(1.0f, 2.0f, 3.0f, 4.0f));
+            TestTrue(TEXT("HAlign"), Slot->GetHorizontalAlignment() == HAlign_Center);
+            TestTrue(TEXT("Size Auto"), Slot->GetSize().SizeRule == ESlateSizeRule::Automatic);
+        }
+    }
+
+    UImage *Icon = Cast<UImage>(Tree->FindWidget(TEXT("Icon")));
+    if (TestNotNull(TEXT("Icon"), Icon))
+    {
+        TestTrue(TEXT("Design color"), Icon->GetColorAndOpacity().Equals(FLinearColor(1.0f, 0.0f, 0.0f, 1.0f)));
+        TestTrue(TEXT("Design size"), Icon->GetBrush().ImageSize.Equals(FVector2D(64.0, 32.0)));
+
+        UVerticalBoxSlot *Slot = Cast<UVerticalBoxSlot>(Icon->Slot);
+        TestTrue(TEXT("Fill size"), Slot && Slot->GetSize().SizeRule == ESlateSizeRule::Fill && FMath::IsNearlyEqual(Slot->GetSize().Value, 2.0f));
+    }
+
+    UThrobber *Spinner = Cast<UThrobber>(Tree->FindWidget(TEXT("Spinner")));
+    if (TestNotNull(TEXT("Spinner"), Spinner))
+    {
+        TestEqual(TEXT("Design NumberOfPieces"), Spinner->GetNumberOfPieces(), 6);
+    }
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMWCS_BuilderUnsetSlotFieldsTest, "MWCS.Builder.UnsetSlotFieldsKeepDefaults", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+bool FMWCS_BuilderUnsetSlotFieldsTest::RunTest(const FString &Parameters)
+{
+    const TCHAR *Json = TEXT(R"({
+        "BlueprintName": "WBP_MWCS_BuilderDefaults",
+        "ParentClass": "/Script/UMG.UserWidget",
+        "Version": "1.0.0",
+        "Hierarchy": { "Root": { "Type": "VerticalBox", "Name": "Root", "Children": [ { "Type": "TextBlock", "Name": "Plain" } ] } },
+        "Bindings": { "Required": [], "Optional": [] }
+    })");
+
+    FMWCS_WidgetSpec Spec;
+    FMWCS_Report Report;
+    if (!TestTrue(TEXT("Parses"), ParseSpec(Json, Spec, Report)))
+    {
+        return false;
+    }
+    UWidgetBlueprint *Blueprint = BuildTransient(Spec, Report);
+    if (!TestNotNull(TEXT("Builds"), Blueprint))
+    {
+        return false;
+    }
+
+    UWidget *Plain = Blueprint->WidgetTree->FindWidget(TEXT("Plain"));
+    UVerticalBoxSlot *Slot = Plain ? Cast<UVerticalBoxSlot>(Plain->Slot) : nullptr;
+    const UVerticalBoxSlot *Default = GetDefault<UVerticalBoxSlot>();
+    if (TestNotNull(TEXT("Slot"), Slot))
+    {
+        TestTrue(TEXT("Padding untouched"), Slot->GetPadding() == Default->GetPadding());
+        TestTrue(TEXT("HAlign untouched"), Slot->GetHorizontalAlignment() == Default->GetHorizontalAlignment());
+        TestTrue(TEXT("Size untouched"), Slot->GetSize().SizeRule == Default->GetSize().SizeRule);
+    }
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMWCS_BuilderSpecOptimizerTest, "MWCS.Builder.SpecOptimizer", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+bool FMWCS_BuilderSpecOptimizerTest::RunTest(const FString &Parameters)
+{
+    // Wrap > Inner > Label collapses to Label on Wrap's canvas slot (each level fills its parent); every other wrapper has an effect or
+    // is referenced. Badge keeps the overlay slot default (Left/Top, desired size), so Corner stays.
+    const TCHAR *Json = TEXT(R"({
+        "BlueprintName": "WBP_MWCS_Optimizer",
+        "ParentClass": "/Script/UMG.UserWidget",
+        "Version": "1.0.0",
+        "Hierarchy": { "Root": { "Type": "CanvasPanel", "Name": "Root", "Children": [
+            { "Type": "Overlay", "Name": "Wrap", "Slot": { "Canvas": { "Offsets": [10, 20, 300, 40], "ZOrder": 3 } }, "Children": [
+                { "Type": "VerticalBox", "Name": "Inner", "Slot": { "HAlign": "Fill", "VAlign": "Fill" }, "Children": [
+                    { "Type": "TextBlock", "Name": "Label", "Text": "Hi", "Slot": { "Size": { "Rule": "Fill" } } } ] } ] },
+            { "Type": "Overlay", "Name": "Corner", "Children": [ { "Type": "Image", "Name": "Badge" } ] },
+            { "Type": "HorizontalBox", "Name": "Padded", "Children": [ { "Type": "TextBlock", "Name": "Inset", "Slot": { "Padding": [4, 4, 4, 4], "Fill": 1 } } ] },
+            { "Type": "VerticalBox", "Name": "AutoSized", "Children": [ { "Type": "TextBlock", "Name": "Note" } ] },
+            { "Type": "Overlay", "Name": "BoundFrame", "Children": [ { "Type": "Image", "Name": "Art" } ] },
+            { "Type": "Overlay", "Name": "StyledFrame", "Children": [ { "Type": "Image", "Name": "Dot" } ] }
+        ] } },
+        "Design": { "StyledFrame": { "Visibility": "HitTestInvisible" } },
+        "Bindings": { "Required": [], "Optional": ["BoundFrame"] }
+    })");
+
+    FMWCS_WidgetSpec Spec;
+    FMWCS_Report Report;
+    if (!TestTrue(TEXT("Parses"), ParseSpec(Json, Spec, Report)))
+    {
+        return false;
+    }
+
+    TArray<FString> Removed;
+    TestEqual(TEXT("Removed containers"), FMWCS_SpecOptimizer::Optimize(Spec, &Removed), 2);
+    TestTrue(TEXT("Names reported"), Removed.Contains(TEXT("Wrap")) && Removed.Contains(TEXT("Inner")));
+    TestEqual(TEXT("Second pass removes nothing"), FMWCS_SpecOptimizer::Optimize(Spec), 0);
+
+    const TArray<FMWCS_HierarchyNode> &Children = Spec.HierarchyRoot.Children;
+    if (!TestEqual(TEXT("Root keeps six children"), Children.Num(), 6))
+    {
+        return false;
+    }
+    TestEqual(TEXT("Label hoisted"), Children[0].Name.ToString(), TEXT("Label"));
+    TestTrue(TEXT("Label takes Wrap's canvas slot"), Children[0].bHasCanvasOffsets && Children[0].bHasCanvasZOrder && Children[0].CanvasZOrder == 3);
+    TestFalse(TEXT("Label drops its box slot size"), Children[0].bHasSlotSize);
+    TestEqual(TEXT("Overlay with a default-aligned child kept"), Children[1].Name.ToString(), TEXT("Corner"));
+    TestEqual(TEXT("Padding kept"), Children[2].Name.ToString(), TEXT("Padded"));
+    TestEqual(TEXT("Auto-sized box kept"), Children[3].Name.ToString(), TEXT("AutoSized"));
+    TestEqual(TEXT("Bound container kept"), Children[4].Name.ToString(), TEXT("BoundFrame"));
+    TestEqual(TEXT("Design container kept"), Children[5].Name.ToString(), TEXT("StyledFrame"));
+
+    UWidgetBlueprint *Blueprint = BuildTransient(Spec, Report);
+    if (!TestNotNull(TEXT("Optimized spec builds"), Blueprint))
+    {
+        return false;
+    }
+    TestNull(TEXT("Wrap not built"), Blueprint->WidgetTree->FindWidget(TEXT("Wrap")));
+    UWidget *Label = Blueprint->WidgetTree->FindWidget(TEXT("Label"));
+    TestNotNull(TEXT("Label sits in the canvas"), Label ? Cast<UCanvasPanelSlot>(Label->Slot) : nullptr);
+
+    FMWCS_Report ValidateReport;
+    TestTrue(TEXT("Validates against the optimized spec"), FMWCS_WidgetValidator::ValidateBlueprint(Spec, Blueprint, ValidateReport));
+    return true;
+}
+
+#endif
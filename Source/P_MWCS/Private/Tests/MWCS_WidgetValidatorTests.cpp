@@ -0,0 +1,206 @@
+#include "MWCS_TestUtils.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "MWCS_LayoutSnapshot.h"
+#include "MWCS_PerfLint.h"
+#include "MWCS_RuntimeBench.h"
+#include "MWCS_WidgetValidator.h"
+
+#include "Dom/JsonObject.h"
+#include "Misc/AutomationTest.h"
+#include "WidgetBlueprint.h"
+
+using namespace MWCS_Tests;
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMWCS_ValidatorMismatchTest, "MWCS.Validator.DetectsMismatches", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+bool FMWCS_ValidatorMismatchTest::RunTest(const FString &Parameters)
+{
+    FMWCS_WidgetSpec Spec;
+    FMWCS_Report BuildReport;
+    if (!TestTrue(TEXT("Parses"), ParseSpec(GetSampleSpecJson(), Spec, BuildReport)))
+    {
+        return false;
+    }
+    UWidgetBlueprint *Blueprint = BuildTransient(Spec, BuildReport);
+    if (!TestNotNull(TEXT("Builds"), Blueprint))
+    {
+        return false;
+    }
+
+    {
+        FMWCS_Report Report;
+        TestTrue(TEXT("The spec it was built from validates"), FMWCS_WidgetValidator::ValidateBlueprint(Spec, Blueprint, Report));
+        TestFalse(TEXT("No validation errors"), Report.HasErrors());
+    }
+
+    // Each case validates the same blueprint against a spec that differs in one place.
+    auto ExpectIssue = [this, Blueprint](const TCHAR *Case, const FMWCS_WidgetSpec &Changed, const TCHAR *Code)
+    {
+        FMWCS_Report Report;
+        const bool bValid = FMWCS_WidgetValidator::ValidateBlueprint(Changed, Blueprint, Report);
+        TestFalse(FString::Printf(TEXT("%s: fails"), Case), bValid);
+        TestTrue(FString::Printf(TEXT("%s: %s reported"), Case, Code), HasIssue(Report, Code));
+    };
+
+    const FMWCS_HierarchyNode &Column = Spec.HierarchyRoot.Children[0];
+    {
+        FMWCS_WidgetSpec Changed = Spec;
+        Changed.HierarchyRoot.Children[0].Children[1].Type = TEXT("Border");
+        ExpectIssue(TEXT("Type"), Changed, TEXT("Validator.Hierarchy.TypeMismatch"));
+    }
+    {
+        FMWCS_WidgetSpec Changed = Spec;
+        Changed.HierarchyRoot.Children[0].Children[2].Name = TEXT("Renamed");
+        ExpectIssue(TEXT("Name"), Changed, TEXT("Validator.Hierarchy.NameMismatch"));
+    }
+    {
+        FMWCS_WidgetSpec Changed = Spec;
+        Changed.HierarchyRoot.Children[0].Children.Pop();
+        ExpectIssue(TEXT("Children"), Changed, TEXT("Validator.Hierarchy.ChildrenCountMismatch"));
+    }
+    {
+        FMWCS_WidgetSpec Changed = Spec;
+        Changed.Bindings.Required.Add(TEXT("NotInTree"));
+        ExpectIssue(TEXT("Binding"), Changed, TEXT("Validator.MissingWidget"));
+    }
+    {
+        FMWCS_WidgetSpec Changed = Spec;
+        Changed.ParentClassPath = TEXT("/Script/Blutility.EditorUtilityWidget");
+        ExpectIssue(TEXT("Parent"), Changed, TEXT("Validator.ParentMismatch"));
+    }
+    {
+        // Design entries are shared pointers; give the changed spec its own object.
+        TSharedPtr<FJsonObject> Color = MakeShared<FJsonObject>();
+        Color->SetNumberField(TEXT("R"), 0.0);
+        Color->SetNumberField(TEXT("G"), 1.0);
+        Color->SetNumberField(TEXT("B"), 0.0);
+        TSharedPtr<FJsonObject> Icon = MakeShared<FJsonObject>();
+        Icon->SetObjectField(TEXT("ColorAndOpacity"), Color);
+
+        FMWCS_WidgetSpec Changed = Spec;
+        Changed.Design.Add(TEXT("Icon"), Icon);
+        ExpectIssue(TEXT("Design"), Changed, TEXT("Validator.Design.Image.ColorMismatch"));
+
+        Changed.Design.Add(TEXT("Ghost"), MakeShared<FJsonObject>());
+        ExpectIssue(TEXT("Design widget"), Changed, TEXT("Validator.Design.MissingWidget"));
+    }
+    {
+        TSharedPtr<FJsonObject> Title = MakeShared<FJsonObject>();
+        Title->SetStringField(TEXT("Visibility"), TEXT("Collapsed"));
+
+        FMWCS_WidgetSpec Changed = Spec;
+        Changed.Design.Add(TEXT("Title"), Title);
+        ExpectIssue(TEXT("Visibility"), Changed, TEXT("Validator.Design.VisibilityMismatch"));
+    }
+    {
+        FMWCS_WidgetSpec Changed = Spec;
+        Changed.DesignerPreview.SizeMode = EMWCS_PreviewSizeMode::Desired;
+        ExpectIssue(TEXT("Preview"), Changed, TEXT("Validator.DesignerPreview.SizeModeMismatch"));
+    }
+    TestEqual(TEXT("Original spec untouched"), Column.Children.Num(), 3);
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMWCS_LayoutSnapshotTest, "MWCS.Validator.LayoutSnapshot", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+bool FMWCS_LayoutSnapshotTest::RunTest(const FString &Parameters)
+{
+    FMWCS_WidgetSpec Spec;
+    FMWCS_Report BuildReport;
+    if (!TestTrue(TEXT("Parses"), ParseSpec(GetSampleSpecJson(), Spec, BuildReport)))
+    {
+        return false;
+    }
+    UWidgetBlueprint *Blueprint = BuildTransient(Spec, BuildReport);
+    if (!TestNotNull(TEXT("Builds"), Blueprint) || !TestTrue(TEXT("Slate available"), FMWCS_RuntimeBench::EnsureSlate(BuildReport)))
+    {
+        return false;
+    }
+
+    const FMWCS_LayoutSnapshotOptions Options;
+    FMWCS_SpecLayout Layout;
+    FMWCS_Report Report;
+    if (!TestTrue(TEXT("Captures"), FMWCS_LayoutSnapshot::CaptureBlueprint(Spec, Blueprint, Options, Layout, Report)))
+    {
+        return false;
+    }
+
+    // No DesignerPreview section: FillScreen at the default size. Column stretches with offsets 10, 20, 30, 40.
+    TestTrue(TEXT("FillScreen viewport"), Layout.ViewportSize.Equals(Options.FillScreenSize));
+    TestEqual(TEXT("Every named widget recorded"), Layout.Widgets.Num(), 5);
+    if (const FMWCS_WidgetLayout *Column = Layout.Widgets.Find(TEXT("Column")))
+    {
+        TestTrue(TEXT("Column position"), Column->Position.Equals(FVector2D(10.0, 20.0), 0.01));
+        TestTrue(TEXT("Column size"), Column->Size.Equals(FVector2D(1880.0, 1020.0), 0.01));
+    }
+    else
+    {
+        AddError(TEXT("Column not recorded"));
+    }
+
+    FMWCS_LayoutSnapshotData Snapshot;
+    Snapshot.Specs.Add(Spec.BlueprintName.ToString(), Layout);
+    FMWCS_LayoutSnapshotData Reloaded;
+    TestTrue(TEXT("Snapshot round-trips through JSON"), FMWCS_LayoutSnapshot::FromJson(FMWCS_LayoutSnapshot::ToJson(Snapshot), Reloaded));
+
+    {
+        FMWCS_Report CompareReport;
+        TestEqual(TEXT("Unchanged layout"), FMWCS_LayoutSnapshot::Compare(Reloaded, Snapshot, Options, CompareReport), 0);
+        TestFalse(TEXT("No errors for an unchanged layout"), CompareReport.HasErrors());
+    }
+
+    FMWCS_LayoutSnapshotData Moved = Snapshot;
+    FMWCS_SpecLayout &MovedLayout = Moved.Specs.FindChecked(Spec.BlueprintName.ToString());
+    MovedLayout.Widgets.FindChecked(TEXT("Title")).Position.X += Options.Tolerance * 0.5;
+    {
+        FMWCS_Report CompareReport;
+        TestEqual(TEXT("Shift within tolerance"), FMWCS_LayoutSnapshot::Compare(Snapshot, Moved, Options, CompareReport), 0);
+    }
+
+    MovedLayout.Widgets.FindChecked(TEXT("Icon")).Size.Y += 5.0;
+    MovedLayout.Widgets.Remove(TEXT("Spinner"));
+    {
+        FMWCS_Report CompareReport;
+        TestEqual(TEXT("Resized widget"), FMWCS_LayoutSnapshot::Compare(Snapshot, Moved, Options, CompareReport), 1);
+        TestTrue(TEXT("Layout.Moved"), HasIssue(CompareReport, TEXT("Layout.Moved")));
+        TestTrue(TEXT("Layout.WidgetMissing"), HasIssue(CompareReport, TEXT("Layout.WidgetMissing")));
+    }
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMWCS_PerfLintTest, "MWCS.Validator.PerfLint", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+bool FMWCS_PerfLintTest::RunTest(const FString &Parameters)
+{
+    FMWCS_WidgetSpec Spec;
+    FMWCS_Report ParseReport;
+    if (!TestTrue(TEXT("Parses"), ParseSpec(GetSampleSpecJson(), Spec, ParseReport)))
+    {
+        return false;
+    }
+
+    // Sample: 5 widgets, 3 deep, one CanvasPanel child, Title bound; Icon (Image) and Spinner (Throbber) are hit-testable.
+    MWCS_Core::FPerfLintOptions Options;
+    {
+        FMWCS_Report Report;
+        TestEqual(TEXT("Default budgets only flag hit-testable decorations"), FMWCS_PerfLint::LintSpec(Spec, Options, Report), 2);
+        TestFalse(TEXT("Hit-testable findings are info"), Report.HasErrors() || Report.HasWarnings());
+        TestTrue(TEXT("Perf.HitTestable"), HasIssue(Report, TEXT("Perf.HitTestable")));
+    }
+
+    FMWCS_Report Report;
+    TestTrue(TEXT("Overrides parse"), FMWCS_PerfLint::ApplyOverrides(TEXT("Depth:2,WidgetCount:4:Error,CanvasChildren:0,VariableCount:0,HitTestable:Off"), Options, Report));
+    TestEqual(TEXT("Tight budgets"), FMWCS_PerfLint::LintSpec(Spec, Options, Report), 4);
+    TestTrue(TEXT("Perf.Depth"), HasIssue(Report, TEXT("Perf.Depth")));
+    TestTrue(TEXT("Perf.WidgetCount"), HasIssue(Report, TEXT("Perf.WidgetCount")));
+    TestTrue(TEXT("Perf.CanvasChildren"), HasIssue(Report, TEXT("Perf.CanvasChildren")));
+    TestTrue(TEXT("Perf.VariableCount"), HasIssue(Report, TEXT("Perf.VariableCount")));
+    TestFalse(TEXT("HitTestable off"), HasIssue(Report, TEXT("Perf.HitTestable")));
+    TestTrue(TEXT("WidgetCount raised to error"), Report.HasErrors());
+
+    FMWCS_Report BadReport;
+    TestFalse(TEXT("Unknown rule rejected"), FMWCS_PerfLint::ApplyOverrides(TEXT("Nesting:3"), Options, BadReport));
+    TestTrue(TEXT("Lint.InvalidRules"), HasIssue(BadReport, TEXT("Lint.InvalidRules")));
+    return true;
+}
+
+#endif
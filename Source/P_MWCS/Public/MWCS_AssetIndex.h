@@ -0,0 +1,55 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "MWCS_WidgetSpec.h"
+
+struct P_MWCS_API FMWCS_AssetIndexEntry
+{
+    FString AssetPath;    // long package name, e.g. /Game/UI/Widgets/WBP_HUD
+    FString ProviderPath; // provider that produced the spec
+    FName BlueprintName;
+    FString SpecHash;
+    FString BuiltUtc;
+};
+
+/**
+ * Persistent reverse index from generated assets to the provider (and spec hash) that produced them.
+ * Updated by the builder on every successful build and stored in Saved/MWCS/AssetIndex.json, so
+ * targeted actions (Content Browser Validate/Repair Selected) only invoke the providers they need.
+ * Saving re-reads the file and only overwrites the entries this process recorded, then replaces it through a temp file.
+ * Shard workers write a fragment instead (-AssetIndexOut=) that MWCS_BuildCoordinator merges once they are done.
+ * Game thread only.
+ */
+class P_MWCS_API FMWCS_AssetIndex
+{
+public:
+    static FMWCS_AssetIndex &Get();
+
+    static FString GetIndexFilePath();
+
+    const FMWCS_AssetIndexEntry *Find(const FString &AssetPath) const;
+
+    void Record(const FString &AssetPath, const FMWCS_WidgetSpec &Spec);
+
+    /** For an asset that was not rebuilt: adds the provider mapping without a SpecHash, or leaves an existing entry alone. */
+    void RecordExisting(const FString &AssetPath, const FMWCS_WidgetSpec &Spec);
+
+    /** Writes the index if anything was recorded since the last save. */
+    bool SaveIfDirty();
+
+    /** Non-empty: SaveIfDirty writes only the entries recorded by this process to Path and leaves the index file alone. */
+    void SetFragmentPath(const FString &Path);
+
+    /** Records every entry of a fragment written by a shard worker. */
+    bool MergeFragment(const FString &Path);
+
+private:
+    void EnsureLoaded();
+
+    TMap<FString, FMWCS_AssetIndexEntry> Entries;
+    TSet<FString> Recorded; // entries changed by this process since the last save
+    FString FragmentPath;
+    bool bLoaded = false;
+    bool bDirty = false;
+};
@@ -0,0 +1,59 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+
+#include "MWCS_Report.h"
+#include "MWCS_WidgetSpec.h"
+
+DECLARE_DELEGATE_OneParam(FMWCS_OnAsyncRunFinished, const FMWCS_Report & /*Report*/);
+
+/**
+ * Handle for a Validate/Build run that is spread across editor ticks.
+ * Each tick processes whole specs until the time slice (AsyncTimeSliceMs) is used up, so the editor stays
+ * responsive. Cancel() takes effect between specs; the spec being built always finishes.
+ * Started through FMWCS_Service::StartValidateAll / StartBuildAll. Game thread only.
+ */
+class P_MWCS_API FMWCS_AsyncRun : public TSharedFromThis<FMWCS_AsyncRun>
+{
+public:
+    using FStepFunction = TFunction<void(const FMWCS_WidgetSpec &, FMWCS_Report &)>;
+
+    FMWCS_AsyncRun(const FString &InLabel, TArray<FMWCS_WidgetSpec> &&InSpecs, FMWCS_Report &&InReport, FStepFunction &&InStep);
+    ~FMWCS_AsyncRun();
+
+    void Cancel() { bCancelRequested = true; }
+
+    bool IsRunning() const { return TickerHandle.IsValid(); }
+    bool WasCancelled() const { return bCancelled; }
+
+    int32 GetNumCompleted() const { return NextSpec; }
+    int32 GetNumTotal() const { return Specs.Num(); }
+    float GetProgressFraction() const { return Specs.Num() > 0 ? static_cast<float>(NextSpec) / Specs.Num() : 1.0f; }
+
+    /** Name of the spec processed next (empty once finished). */
+    FString GetCurrentSpecName() const;
+
+    const FString &GetLabel() const { return Label; }
+    const FMWCS_Report &GetReport() const { return Report; }
+
+    /** Fired once, on the game thread, after the last spec or after a cancel. The report is already saved. */
+    FMWCS_OnAsyncRunFinished OnFinished;
+
+private:
+    friend class FMWCS_Service;
+
+    void Start();
+    bool Tick(float DeltaTime);
+    void Finish();
+
+    FString Label;
+    TArray<FMWCS_WidgetSpec> Specs;
+    FMWCS_Report Report;
+    FStepFunction Step;
+
+    int32 NextSpec = 0;
+    bool bCancelRequested = false;
+    bool bCancelled = false;
+    FTSTicker::FDelegateHandle TickerHandle;
+};
@@ -0,0 +1,115 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "MWCS_Report.h"
+#include "MWCS_SpecGenerator.h"
+#include "MWCS_Types.h"
+
+struct FMWCS_BenchmarkOptions
+{
+    FMWCS_SpecGeneratorOptions Corpus;
+
+    // Empty means FMWCS_SpecGenerator::GetDefaultCorpusDir().
+    FString CorpusDir;
+
+    EMWCS_BuildMode Mode = EMWCS_BuildMode::ForceRecreate;
+
+    // The corpus is generated once; CollectSpecs, BuildAll, ValidateAll and Extract run this many times.
+    int32 Iterations = 1;
+};
+
+struct FMWCS_BenchmarkStage
+{
+    FString Name;
+    TArray<double> SamplesMs;
+    double MedianMs = 0.0;
+
+    double UsedMB = 0.0;  // physical memory in use after the last iteration
+    double DeltaMB = 0.0; // largest change over one iteration (after a garbage collection before it)
+    double PeakMB = 0.0;  // process peak so far
+    int32 Errors = 0;
+    int32 Warnings = 0;
+};
+
+struct FMWCS_BenchmarkResult
+{
+    int32 NumSpecs = 0;
+    int32 NodesPerSpec = 0;
+    int32 Seed = 0;
+    int32 Iterations = 0;
+    int32 SpecsCollected = 0;
+    EMWCS_BuildMode Mode = EMWCS_BuildMode::ForceRecreate;
+    TArray<FMWCS_BenchmarkStage> Stages;
+
+    const FMWCS_BenchmarkStage *FindStage(const FString &Name) const;
+};
+
+/**
+ * Stored reference timings for the regression gate (written with -SaveBaseline):
+ * { "Format": "MWCS.BenchmarkBaseline", "Version": 2, "Specs": N, "NodesPerSpec": N, "Seed": N, "Mode": "ForceRecreate",
+ *   "Iterations": N, "Stages": { "<Stage>": { "MedianMs": x } }, "Thresholds": { "<Stage>": 0.1 } }
+ * Thresholds are optional relative slowdowns (0.1 = 10%) that override the gate defaults per stage.
+ */
+struct FMWCS_BenchmarkBaseline
+{
+    int32 NumSpecs = 0;
+    int32 NodesPerSpec = 0;
+    int32 Seed = 0;
+    FString Mode; // empty in Version 1 baselines
+    int32 Iterations = 0;
+    TMap<FString, double> MedianMs;
+    TMap<FString, double> Thresholds;
+};
+
+struct FMWCS_BenchmarkGateOptions
+{
+    // Relative slowdown allowed for gated stages without their own threshold.
+    double DefaultThreshold = 0.10;
+
+    // Per-stage overrides (-Thresholds=BuildAll:0.1,Extract:0.25); a stage listed here is gated. Wins over the baseline file.
+    TMap<FString, double> Thresholds;
+
+    // Stages gated with DefaultThreshold even when no threshold names them.
+    TArray<FString> GatedStages = {TEXT("BuildAll"), TEXT("ValidateAll")};
+
+    // Slowdowns below this many milliseconds are timer noise and never fail the gate.
+    double MinDeltaMs = 5.0;
+};
+
+struct FMWCS_BenchmarkDiffRow
+{
+    FString Stage;
+    double BaselineMs = 0.0;
+    double CurrentMs = 0.0;
+    double DeltaPct = 0.0;
+    double Threshold = 0.0;
+    bool bGated = false;
+    bool bRegressed = false;
+};
+
+/**
+ * Scale benchmark over a generated corpus (see MWCS_Benchmark in the README) and its regression gate.
+ * Run() temporarily points UMWCS_Settings discovery and output at the corpus and restores them afterwards.
+ */
+class P_MWCS_API FMWCS_Benchmark
+{
+public:
+    static void Run(const FMWCS_BenchmarkOptions &Options, FMWCS_BenchmarkResult &OutResult, FMWCS_Report &InOutReport);
+
+    // Canonical JSON table: corpus parameters plus one entry per stage (samples, median, memory, issue counts).
+    static FString ToJson(const FMWCS_BenchmarkResult &Result);
+
+    // Baseline with every stage's median; Thresholds are stored as given.
+    static FString ToBaselineJson(const FMWCS_BenchmarkResult &Result, const TMap<FString, double> &Thresholds);
+
+    // Adds Benchmark.BaselineInvalid on a missing or malformed file.
+    static bool LoadBaseline(const FString &Path, FMWCS_BenchmarkBaseline &OutBaseline, FMWCS_Report &InOutReport);
+
+    // One row per stage present in both. Adds Benchmark.Regression errors, a Benchmark.BaselineMismatch error when the
+    // corpus parameters, build mode or iteration count differ, and a Benchmark.Gate info summary. Returns false on any regression or mismatch.
+    static bool Compare(const FMWCS_BenchmarkResult &Result, const FMWCS_BenchmarkBaseline &Baseline, const FMWCS_BenchmarkGateOptions &Gate,
+                        TArray<FMWCS_BenchmarkDiffRow> &OutRows, FMWCS_Report &InOutReport);
+
+    static double Median(TArray<double> Samples);
+};
@@ -0,0 +1,77 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Writer for canonical JSON: object keys sorted (ordinal, case-sensitive; a repeated key keeps the last value),
+ * numbers with fixed formatting (see FormatNumber), tab-indented or minified.
+ * Not a streaming writer: scalars are formatted as they arrive, but every open object and array buffers its
+ * members' text until it is closed (objects are sorted then) and hands the result to its parent, so a value is
+ * copied once per enclosing level. It avoids an FJsonValue tree, not the buffering.
+ * Used by extraction, the spec generator and reports, so the output must stay byte-stable.
+ */
+class P_MWCS_API FMWCS_CanonicalJsonWriter
+{
+public:
+    // BaseDepth indents a fragment that will be embedded with WriteRaw at that depth.
+    explicit FMWCS_CanonicalJsonWriter(bool bInPretty = true, int32 BaseDepth = 0);
+
+    // Without a key: the root value or an array element. With a key: a member of the current object.
+    void BeginObject();
+    void BeginObject(const FString &Key);
+    void BeginArray();
+    void BeginArray(const FString &Key);
+
+    // bOmitIfEmpty drops an empty object/array from its parent. Returns true when the value was kept.
+    bool EndObject(bool bOmitIfEmpty = false);
+    bool EndArray(bool bOmitIfEmpty = false);
+
+    void Write(const FString &Key, const FString &Value);
+    void Write(const FString &Key, const TCHAR *Value);
+    void Write(const FString &Key, double Value);
+    void Write(const FString &Key, int32 Value);
+    void Write(const FString &Key, bool bValue);
+    void WriteNull(const FString &Key);
+
+    // Array elements.
+    void WriteElement(const FString &Value);
+    void WriteElement(double Value);
+    void WriteElement(bool bValue);
+    void WriteNullElement();
+
+    // Embeds already-canonical JSON (e.g. from a writer created with BaseDepth = the member's depth).
+    void WriteRaw(const FString &Key, const FString &Json);
+
+    // Number of members/elements written to the innermost open object/array so far.
+    int32 NumInCurrent() const;
+
+    // The complete document; all objects and arrays must be closed.
+    const FString &GetOutput() const;
+
+    // Integers without a fraction; other values with up to 6 decimals, trailing zeros removed. Absorbs float
+    // noise (0.1f -> 0.1) so hashes do not change with the float/double path a value took.
+    static FString FormatNumber(double Value);
+
+private:
+    struct FFrame
+    {
+        bool bArray = false;
+        FString Key;
+        TArray<TPair<FString, FString>> Members;
+        TArray<FString> Elements;
+    };
+
+    void Begin(bool bArray, const FString &Key);
+    bool End(bool bArray, bool bOmitIfEmpty);
+    void AddMember(const FString &Key, FString &&Value);
+    void AddElement(FString &&Value);
+    void AddValue(const FString &Key, FString &&Value, bool bHasKey);
+
+    static FString Quote(const FString &Value);
+    FString Indent(int32 Depth) const;
+
+    bool bPretty = true;
+    int32 BaseDepth = 0;
+    TArray<FFrame> Stack;
+    FString Output;
+};
@@ -22,3 +22,100 @@ class UMWCS_CreateWidgetsCommandlet : public UCommandlet
 public:
     virtual int32 Main(const FString &Params) override;
 };
+
+UCLASS()
+class UMWCS_PlanWidgetsCommandlet : public UCommandlet
+{
+    GENERATED_BODY()
+
+public:
+    virtual int32 Main(const FString &Params) override;
+};
+
+// Exports every Widget Blueprint under -Path (default OutputRootPath) as spec JSON into -Out (see README).
+UCLASS()
+class UMWCS_ExtractWidgetsCommandlet : public UCommandlet
+{
+    GENERATED_BODY()
+
+public:
+    virtual int32 Main(const FString &Params) override;
+};
+
+// Builds every spec in -Specs (default Tests/TestSpecs) into a transient package, extracts it, re-parses it and
+// compares it with the original spec, all in one process. Exit code 1 on any mismatch.
+UCLASS()
+class UMWCS_RoundTripCommandlet : public UCommandlet
+{
+    GENERATED_BODY()
+
+public:
+    virtual int32 Main(const FString &Params) override;
+};
+
+// Generates a synthetic spec corpus (-NumSpecs, -Nodes, -Seed), then times CollectSpecs, BuildAll, ValidateAll and
+// extraction on it and writes a JSON timing/memory table (see README). With -Baseline=<file>, compares the stage
+// medians with the baseline and exits with code 4 on a regression.
+UCLASS()
+class UMWCS_BenchmarkCommandlet : public UCommandlet
+{
+    GENERATED_BODY()
+
+public:
+    virtual int32 Main(const FString &Params) override;
+};
+
+// Instantiates every generated widget class under -Path many times (CreateWidget, TakeWidget, SlatePrepass under
+// -NullRHI) and writes a JSON table of per-instance time, UObject count and memory (see README).
+UCLASS()
+class UMWCS_RuntimeBenchCommandlet : public UCommandlet
+{
+    GENERATED_BODY()
+
+public:
+    virtual int32 Main(const FString &Params) override;
+};
+
+// Lays out every generated widget headless at its DesignerPreview size and records the arranged rectangles of its
+// named widgets to a snapshot file; with -Baseline=<file>, reports widgets that moved beyond -Tolerance (see README).
+UCLASS()
+class UMWCS_LayoutSnapshotCommandlet : public UCommandlet
+{
+    GENERATED_BODY()
+
+public:
+    virtual int32 Main(const FString &Params) override;
+};
+
+// Runs the Perf.* runtime-cost rules (depth, widget count, CanvasPanel children, variables, hit-testable decorations)
+// over the selected specs with the budgets from the settings, or -Rules=<overrides> (see README).
+UCLASS()
+class UMWCS_LintWidgetsCommandlet : public UCommandlet
+{
+    GENERATED_BODY()
+
+public:
+    virtual int32 Main(const FString &Params) override;
+};
+
+// Splits a create/validate run into -Shard=i/N workers (separate UnrealEditor-Cmd processes on this machine)
+// and merges their reports into one report and exit code.
+UCLASS()
+class UMWCS_BuildCoordinatorCommandlet : public UCommandlet
+{
+    GENERATED_BODY()
+
+public:
+    virtual int32 Main(const FString &Params) override;
+};
+
+// Long-running build server: keeps the editor warm and serves validate/create/plan/extract requests
+// over a loopback TCP socket (see README "Build server").
+UCLASS()
+class UMWCS_ServerCommandlet : public UCommandlet
+{
+    GENERATED_BODY()
+
+public:
+    virtual int32 Main(const FString &Params) override;
+};
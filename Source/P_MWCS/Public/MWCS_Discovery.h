@@ -0,0 +1,45 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "MWCS_Report.h"
+#include "MWCS_WidgetSpec.h"
+
+struct P_MWCS_API FMWCS_DiscoveryStats
+{
+    int32 PathsScanned = 0;
+    int32 PackagesScanned = 0;
+    double Seconds = 0.0;
+    bool bFullScan = false;
+
+    bool DidWork() const { return bFullScan || PathsScanned > 0 || PackagesScanned > 0; }
+};
+
+/**
+ * Asset registry discovery for headless (commandlet) runs.
+ * Instead of waiting on a scan of the whole project, MWCS synchronously scans only what it touches:
+ * OutputRootPath, the Tool EUW output paths, and the packages each spec references
+ * (Dependencies, nested UserWidget blueprints, blueprint parent classes).
+ * In the interactive editor every call is a no-op; the editor's own background scan covers the project.
+ */
+class P_MWCS_API FMWCS_Discovery
+{
+public:
+    /** True in commandlets unless bScopedDiscoveryInCommandlets is off or -FullDiscovery was passed. */
+    static bool UseScopedDiscovery();
+
+    /** Scans the configured output roots (once per process). With -FullDiscovery, runs the full synchronous scan instead. */
+    static void ScanRoots(FMWCS_DiscoveryStats &InOutStats);
+
+    /** Scans the packages one spec references that have not been scanned yet. */
+    static void ScanSpec(const FMWCS_WidgetSpec &Spec, FMWCS_DiscoveryStats &InOutStats);
+
+    /** Scans an arbitrary long package path (e.g. an extraction source folder). */
+    static void ScanPath(const FString &LongPackagePath, FMWCS_DiscoveryStats &InOutStats);
+
+    /** ScanRoots + ScanSpec for every spec, then AddReportEntry. */
+    static void PrepareForSpecs(const TArray<FMWCS_WidgetSpec> &Specs, FMWCS_Report &Report);
+
+    /** Adds a Discovery.Scoped / Discovery.Full info entry with the timing, if anything was scanned. */
+    static void AddReportEntry(const FMWCS_DiscoveryStats &Stats, FMWCS_Report &Report);
+};
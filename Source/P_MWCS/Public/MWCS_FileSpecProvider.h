@@ -0,0 +1,30 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "MWCS_Report.h"
+#include "MWCS_WidgetRegistry.h"
+
+/**
+ * Spec provider backed by *.json files in UMWCS_Settings::SpecDirectories (same format as Tests/TestSpecs).
+ * A file may hold one spec object, an array of specs, or { "Specs": [ ... ] }.
+ * Each file's split spec JSON is cached by modification time and size, so repeated collections in one
+ * process (editor, MWCS_Server) only re-read files that changed; Saved/MWCS/SpecFileIndex.json keeps the
+ * timestamps between runs so the report can say what changed since the last run.
+ * The spec context (ProviderPath) is the absolute file path. Game thread only.
+ */
+class P_MWCS_API FMWCS_FileSpecProvider
+{
+public:
+    /** Appends one source per spec found in the configured directories. OnlyFiles restricts to those absolute paths. */
+    static void CollectSpecSources(TArray<FMWCS_SpecSource> &OutSources, FMWCS_Report &InOutReport, const TSet<FString> *OnlyFiles = nullptr);
+
+    /** Absolute, normalized spec directories that exist on disk. */
+    static void GetSpecDirectories(TArray<FString> &OutDirectories);
+
+    /** True if the path is a *.json file under one of the spec directories. */
+    static bool IsSpecFile(const FString &AbsolutePath);
+
+    /** Normalizes a path the same way spec contexts are written (absolute, forward slashes). */
+    static FString NormalizePath(const FString &Path);
+};
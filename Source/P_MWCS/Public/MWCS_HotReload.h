@@ -0,0 +1,33 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+
+/**
+ * Editor-only watcher for file-backed spec directories.
+ * Saves are debounced (HotReloadDebounceSeconds) and coalesced; then only the specs from the changed files
+ * whose hash differs from the asset index are rebuilt (Repair), followed by the widgets that nest them.
+ * Open Widget Blueprint editors of rebuilt assets refresh their preview.
+ */
+class P_MWCS_API FMWCS_HotReload
+{
+public:
+    static FMWCS_HotReload &Get();
+
+    void Start();
+    void Stop();
+
+    /** Re-registers directory watches (spec directories or the enable flag changed). */
+    void RefreshWatches();
+
+private:
+    void HandleDirectoryChanged(const TArray<struct FFileChangeData> &Changes);
+    bool Tick(float DeltaTime);
+    void ProcessPending();
+
+    TMap<FString, FDelegateHandle> WatchHandles;
+    TSet<FString> PendingFiles;
+    double LastChangeTime = 0.0;
+    FTSTicker::FDelegateHandle TickerHandle;
+    FDelegateHandle SettingsChangedHandle;
+};
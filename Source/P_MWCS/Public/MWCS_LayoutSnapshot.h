@@ -0,0 +1,67 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "MWCS_Report.h"
+#include "MWCS_SpecFilter.h"
+#include "MWCS_WidgetSpec.h"
+
+class UWidgetBlueprint;
+
+struct FMWCS_LayoutSnapshotOptions
+{
+    // Viewport for specs whose DesignerPreview is not Custom (FillScreen; Desired modes use the widget's desired size).
+    FVector2D FillScreenSize = FVector2D(1920.0, 1080.0);
+
+    // A widget has moved when any edge of its rectangle differs from the baseline by more than this (Slate units).
+    double Tolerance = 0.5;
+};
+
+struct FMWCS_WidgetLayout
+{
+    FVector2D Position = FVector2D::ZeroVector; // top-left, relative to the widget's root
+    FVector2D Size = FVector2D::ZeroVector;
+};
+
+struct FMWCS_SpecLayout
+{
+    FVector2D ViewportSize = FVector2D::ZeroVector;
+    TMap<FString, FMWCS_WidgetLayout> Widgets; // by spec node name
+};
+
+/**
+ * Arranged rectangles of the named widgets of every spec, as written to a layout snapshot file:
+ * { "Format": "MWCS.LayoutSnapshot", "Version": 1, "Specs": { "<BlueprintName>": { "Viewport": "W,H", "Widgets": { "<Name>": "X,Y,W,H" } } } }
+ * Values are rounded to 0.01 so the file is stable across runs.
+ */
+struct FMWCS_LayoutSnapshotData
+{
+    TMap<FString, FMWCS_SpecLayout> Specs;
+};
+
+/**
+ * Headless layout snapshots (MWCS_LayoutSnapshot commandlet). A generated widget is instantiated offscreen at its
+ * DesignerPreview size, Slate lays it out (SlatePrepass, then ArrangeChildren down the tree) without painting, and the
+ * arranged rectangle of every widget named in the spec hierarchy is recorded. Needs Slate (FMWCS_RuntimeBench::EnsureSlate).
+ */
+class P_MWCS_API FMWCS_LayoutSnapshot
+{
+public:
+    static FVector2D GetViewportSize(const FMWCS_DesignerPreview &Preview, const FVector2D &DesiredSize, const FMWCS_LayoutSnapshotOptions &Options);
+
+    // One built blueprint. Adds Layout.CaptureFailed and returns false when it cannot be instantiated.
+    static bool CaptureBlueprint(const FMWCS_WidgetSpec &Spec, UWidgetBlueprint *Blueprint, const FMWCS_LayoutSnapshotOptions &Options,
+                                 FMWCS_SpecLayout &OutLayout, FMWCS_Report &InOutReport);
+
+    // Every selected spec's asset under OutputRootPath; specs without an asset add Layout.CaptureFailed.
+    static void CaptureAll(const FMWCS_SpecFilter &Filter, const FMWCS_LayoutSnapshotOptions &Options, FMWCS_LayoutSnapshotData &OutSnapshot, FMWCS_Report &InOutReport);
+
+    static FString ToJson(const FMWCS_LayoutSnapshotData &Snapshot);
+    static bool FromJson(const FString &Json, FMWCS_LayoutSnapshotData &OutSnapshot);
+    static bool Load(const FString &Path, FMWCS_LayoutSnapshotData &OutSnapshot, FMWCS_Report &InOutReport);
+
+    // Adds Layout.Moved / Layout.WidgetMissing errors and Layout.WidgetAdded / Layout.ViewportChanged / Layout.SpecMissing
+    // warnings for specs present in both (or only in the baseline), then Layout.Summary. Returns the number of moved widgets.
+    static int32 Compare(const FMWCS_LayoutSnapshotData &Baseline, const FMWCS_LayoutSnapshotData &Current, const FMWCS_LayoutSnapshotOptions &Options,
+                         FMWCS_Report &InOutReport);
+};
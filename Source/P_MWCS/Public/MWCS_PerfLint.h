@@ -0,0 +1,29 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "MWCS_CoreLint.h"
+#include "MWCS_Report.h"
+#include "MWCS_SpecFilter.h"
+#include "MWCS_WidgetSpec.h"
+
+/**
+ * Runtime-cost lint of parsed specs (MWCS_LintWidgets commandlet and the lint stage of every validate run).
+ * The Perf.* rules live in the engine-free core (MWCS_Core::LintSpecPerformance, also mwcslint -Perf); severities and
+ * budgets come from UMWCS_Settings (MWCS|Performance Lint).
+ */
+class P_MWCS_API FMWCS_PerfLint
+{
+public:
+    static MWCS_Core::FPerfLintOptions GetOptions();
+
+    // Applies a -Rules= list ("Depth:12,HitTestable:Off", see FPerfLintOptions::ApplyOverrides) on top of InOutOptions.
+    // Adds Lint.InvalidRules and returns false when the list does not parse.
+    static bool ApplyOverrides(const FString &Rules, MWCS_Core::FPerfLintOptions &InOutOptions, FMWCS_Report &InOutReport);
+
+    // Issues use the BlueprintName as context. Returns the number of issues added.
+    static int32 LintSpec(const FMWCS_WidgetSpec &Spec, const MWCS_Core::FPerfLintOptions &Options, FMWCS_Report &InOutReport);
+
+    // Every selected spec, then a Lint.Summary info entry.
+    static void LintAll(const FMWCS_SpecFilter &Filter, const MWCS_Core::FPerfLintOptions &Options, FMWCS_Report &InOutReport);
+};
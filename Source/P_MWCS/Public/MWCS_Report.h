@@ -23,9 +23,13 @@ struct P_MWCS_API FMWCS_Report
     int32 NumWarnings() const;
     bool HasErrors() const;
     bool HasWarnings() const;
+
+    // Adds Other's counters and appends its issues (used to merge per-spec and per-shard reports).
+    void Append(const FMWCS_Report &Other);
 };
 
 namespace MWCS_ReportJson
 {
     P_MWCS_API FString ToJsonString(const FMWCS_Report &Report);
+    P_MWCS_API bool FromJsonString(const FString &Json, FMWCS_Report &OutReport);
 }
@@ -0,0 +1,52 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "MWCS_Report.h"
+#include "MWCS_WidgetSpec.h"
+
+struct FMWCS_RoundTripOptions
+{
+    // Empty means /Temp/MWCS_RoundTrip. The package is compiled but never saved.
+    FString OutputPath;
+
+    // Round-trip through the minimal extraction (only properties that differ from class defaults).
+    bool bMinimal = false;
+};
+
+struct FMWCS_RoundTripResult
+{
+    FString SpecPath;
+    FName BlueprintName;
+    bool bPassed = false;
+
+    // Stage timings in milliseconds.
+    double ParseMs = 0.0;
+    double BuildMs = 0.0;
+    double ExtractMs = 0.0;
+    double CompareMs = 0.0;
+
+    TArray<FString> Differences;
+};
+
+/**
+ * Spec -> Widget Blueprint -> spec, in one process.
+ * Each spec is built into a transient package, extracted, re-parsed and compared with the original FMWCS_WidgetSpec.
+ */
+class P_MWCS_API FMWCS_RoundTrip
+{
+public:
+    // Every field the original spec sets must come back with the same value (floats within 1e-4, enum-like
+    // strings ignoring case). Fields the extraction adds on its own, such as slot values at their defaults, are
+    // accepted. Version, bIsToolEUW, bIsVariable and Bindings are not extracted and are not compared.
+    static bool CompareSpecs(const FMWCS_WidgetSpec &Original, const FMWCS_WidgetSpec &RoundTripped, TArray<FString> &OutDifferences);
+
+    // Adds RoundTrip.Ok (info, with timings) or one RoundTrip.Mismatch error per difference.
+    static bool RunSpecFile(const FString &SpecPath, const FMWCS_RoundTripOptions &Options, FMWCS_RoundTripResult &OutResult, FMWCS_Report &InOutReport);
+
+    // Runs every *.json under SpecDir (sorted) and adds a RoundTrip.Summary info entry.
+    static void RunDirectory(const FString &SpecDir, const FMWCS_RoundTripOptions &Options, TArray<FMWCS_RoundTripResult> &OutResults, FMWCS_Report &InOutReport);
+
+    // <P_MWCS plugin>/Tests/TestSpecs
+    static FString GetDefaultSpecDir();
+};
@@ -0,0 +1,64 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "MWCS_Report.h"
+
+struct FMWCS_RuntimeBenchOptions
+{
+    // Long package path searched recursively for Widget Blueprints; empty means UMWCS_Settings::OutputRootPath.
+    FString Path;
+
+    // Instances created per class in one pass. They all stay alive until the pass ends, so memory is measured per live instance.
+    int32 Instances = 100;
+
+    // Passes per class; per-instance figures are the median over passes.
+    int32 Passes = 3;
+
+    // Layout scale handed to SWidget::SlatePrepass.
+    float LayoutScale = 1.0f;
+};
+
+struct FMWCS_RuntimeBenchRow
+{
+    FString AssetPath; // /Game/UI/WBP_HUD.WBP_HUD
+
+    int32 Widgets = 0;      // UWidgets in one instance's WidgetTree
+    int32 SlateWidgets = 0; // SWidgets under TakeWidget() after the prepass, including the SObjectWidget wrapper
+
+    // Per instance, median over passes.
+    double CreateUs = 0.0;     // CreateWidget (UObject construction, Initialize)
+    double TakeWidgetUs = 0.0; // TakeWidget (RebuildWidget, SWidget construction)
+    double PrepassUs = 0.0;    // SlatePrepass (desired size of the whole tree)
+    double UObjects = 0.0;     // UObjects allocated
+    double MemoryKB = 0.0;     // physical memory growth, UObjects and Slate widgets together
+
+    double TotalUs() const { return CreateUs + TakeWidgetUs + PrepassUs; }
+};
+
+struct FMWCS_RuntimeBenchResult
+{
+    int32 Instances = 0;
+    int32 Passes = 0;
+    TArray<FMWCS_RuntimeBenchRow> Rows; // by asset path
+};
+
+/**
+ * Runtime cost of generated widget classes (MWCS_RuntimeBench commandlet): every class is instantiated with CreateWidget,
+ * its Slate widgets are taken and laid out with SlatePrepass, all without a window or GPU (-NullRHI).
+ */
+class P_MWCS_API FMWCS_RuntimeBench
+{
+public:
+    // Commandlets start without Slate: creates it with a null platform application and the null renderer, which is enough
+    // to take widgets and measure text. Adds RuntimeBench.NoSlate and returns false if that fails.
+    static bool EnsureSlate(FMWCS_Report &InOutReport);
+
+    // Measures every Widget Blueprint under Options.Path. Adds RuntimeBench.* issues and a RuntimeBench.Summary info entry.
+    static void Run(const FMWCS_RuntimeBenchOptions &Options, FMWCS_RuntimeBenchResult &OutResult, FMWCS_Report &InOutReport);
+
+    // One class. Adds a RuntimeBench.CreateFailed warning and returns false when it cannot be instantiated.
+    static bool MeasureClass(UClass *WidgetClass, const FMWCS_RuntimeBenchOptions &Options, FMWCS_RuntimeBenchRow &OutRow, FMWCS_Report &InOutReport);
+
+    static FString ToJson(const FMWCS_RuntimeBenchResult &Result);
+};
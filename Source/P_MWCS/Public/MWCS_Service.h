@@ -2,21 +2,61 @@
 
 #include "CoreMinimal.h"
 
+#include "MWCS_AsyncRun.h"
 #include "MWCS_Report.h"
+#include "MWCS_SpecFilter.h"
 #include "MWCS_Types.h"
+#include "MWCS_WidgetPlanner.h"
 
 class P_MWCS_API FMWCS_Service
 {
 public:
     static FMWCS_Service &Get();
 
-    FMWCS_Report ValidateAll();
-    FMWCS_Report BuildAll(EMWCS_BuildMode Mode);
+    FMWCS_Report ValidateAll(const FMWCS_SpecFilter &Filter = FMWCS_SpecFilter());
+    FMWCS_Report BuildAll(EMWCS_BuildMode Mode, const FMWCS_SpecFilter &Filter = FMWCS_SpecFilter());
+
+    /**
+     * Same result as BuildAll, but overlaps the stages: worker threads parse ahead of the game thread build,
+     * and packages are written with async saves. Issues are grouped per spec in provider order.
+     */
+    FMWCS_Report BuildAllPipelined(EMWCS_BuildMode Mode, const FMWCS_SpecFilter &Filter = FMWCS_SpecFilter());
+
+    /** Builds each spec and validates the in-memory blueprint right after compile, producing one combined report. */
+    FMWCS_Report BuildAndValidateAll(EMWCS_BuildMode Mode, const FMWCS_SpecFilter &Filter = FMWCS_SpecFilter());
+
+    /**
+     * Validate / build only the specs behind the given generated assets (long package names). Providers are
+     * looked up in the asset index, so only those are invoked; assets missing from the index fall back to a
+     * full collection matched by name.
+     */
+    FMWCS_Report ValidateAssets(const TArray<FString> &AssetPaths);
+    FMWCS_Report BuildAssets(EMWCS_BuildMode Mode, const TArray<FString> &AssetPaths);
+
+    /** Dry run: diffs every spec against its existing asset and reports what a Repair would change. Nothing is compiled or saved. */
+    FMWCS_Plan PlanAll(const FMWCS_SpecFilter &Filter = FMWCS_SpecFilter());
+
+    /**
+     * Time-sliced ValidateAll / BuildAll for the editor UI: specs are collected now, then processed across
+     * editor ticks. Returns null if another run is still active (only one runs at a time).
+     */
+    TSharedPtr<FMWCS_AsyncRun> StartValidateAll(const FMWCS_SpecFilter &Filter = FMWCS_SpecFilter());
+    TSharedPtr<FMWCS_AsyncRun> StartBuildAll(EMWCS_BuildMode Mode, const FMWCS_SpecFilter &Filter = FMWCS_SpecFilter());
+    TSharedPtr<FMWCS_AsyncRun> GetActiveRun() const { return ActiveRun; }
+
     FMWCS_Report GenerateOrRepairToolEuw();
     
     /** Generate or repair an external Tool EUW by name (looks up config in ExternalToolEuws array) */
     FMWCS_Report GenerateOrRepairExternalToolEuw(const FString& ToolName);
 
     bool SaveReportJson(const FMWCS_Report &Report, const FString &FileLabel) const;
+    bool SavePlanJson(const FMWCS_Plan &Plan) const;
+
+private:
+    friend class FMWCS_AsyncRun;
+
+    TSharedPtr<FMWCS_AsyncRun> StartRun(const FString &Label, const FMWCS_SpecFilter &Filter, FMWCS_AsyncRun::FStepFunction &&Step);
+
+    TSharedPtr<FMWCS_AsyncRun> ActiveRun;
 };
 
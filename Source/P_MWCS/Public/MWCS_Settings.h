@@ -2,6 +2,7 @@
 
 #include "CoreMinimal.h"
 #include "Engine/DeveloperSettings.h"
+#include "Engine/EngineTypes.h"
 
 #include "MWCS_Settings.generated.h"
 
@@ -31,6 +32,32 @@ struct FMWCS_ExternalToolEuwConfig
     FSoftClassPath SpecProviderClass;
 };
 
+UENUM()
+enum class EMWCS_LintSeverity : uint8
+{
+    Off,
+    Info,
+    Warning,
+    Error
+};
+
+/** One Perf.* rule of the performance lint (MWCS_LintWidgets, ValidateAll). */
+USTRUCT()
+struct FMWCS_PerfLintRule
+{
+    GENERATED_BODY()
+
+    FMWCS_PerfLintRule() = default;
+    FMWCS_PerfLintRule(EMWCS_LintSeverity InSeverity, int32 InBudget) : Severity(InSeverity), Budget(InBudget) {}
+
+    UPROPERTY(EditAnywhere, Config)
+    EMWCS_LintSeverity Severity = EMWCS_LintSeverity::Warning;
+
+    /** Largest allowed value; the rule reports when a spec goes over it. */
+    UPROPERTY(EditAnywhere, Config, meta = (ClampMin = "0"))
+    int32 Budget = 0;
+};
+
 UCLASS(config = Editor, defaultconfig)
 class P_MWCS_API UMWCS_Settings : public UDeveloperSettings
 {
@@ -44,9 +71,18 @@ public:
     UPROPERTY(EditAnywhere, Config, Category = "MWCS|Discovery", meta = (DisplayName = "Spec Provider Classes (Allowlist)"))
     TArray<FSoftClassPath> SpecProviderClasses;
 
+    UPROPERTY(EditAnywhere, Config, Category = "MWCS|Discovery", meta = (DisplayName = "Spec Directories", RelativeToGameDir, ToolTip = "Directories searched recursively for *.json specs (one spec, an array of specs, or { \"Specs\": [...] } per file). Relative to the project directory."))
+    TArray<FDirectoryPath> SpecDirectories;
+
+    UPROPERTY(EditAnywhere, Config, Category = "MWCS|Discovery", meta = (DisplayName = "Scoped Discovery In Commandlets", ToolTip = "Commandlets scan only the MWCS output paths and the packages specs reference instead of the whole project. -FullDiscovery overrides this per run."))
+    bool bScopedDiscoveryInCommandlets = true;
+
     UPROPERTY(EditAnywhere, Config, Category = "MWCS|Output", meta = (DisplayName = "Widget Blueprint Output Root", ToolTip = "Long package path, e.g. /Game/UI/Widgets"))
     FString OutputRootPath;
 
+    UPROPERTY(EditAnywhere, Config, Category = "MWCS|Output", meta = (DisplayName = "Collapse Redundant Containers", ToolTip = "Before building, remove single-child VerticalBox/HorizontalBox/Overlay wrappers that do not change the layout (see FMWCS_SpecOptimizer). Containers named in Bindings or Design are kept. Rebuild with ForceRecreate after changing this."))
+    bool bCollapseRedundantContainers = false;
+
     // MWCS Tool EUW (built-in)
     UPROPERTY(EditAnywhere, Config, Category = "MWCS|Tool EUW", meta = (DisplayName = "Tool EUW Output Path", ToolTip = "Long package path, e.g. /Game/Editor/MWCS"))
     FString ToolEuwOutputPath;
@@ -69,5 +105,51 @@ public:
 
     UPROPERTY(EditAnywhere, Config, Category = "MWCS|Designer Preview", meta = (DisplayName = "Designer Preview Zoom Level Max"))
     int32 DesignerZoomLevelMax = 20;
+
+    // Spec parse limits: hostile or corrupted specs fail with a Spec.Limit.* error instead of exhausting the stack or memory.
+    UPROPERTY(EditAnywhere, Config, Category = "MWCS|Limits", meta = (DisplayName = "Max Hierarchy Depth", ClampMin = "1", ToolTip = "Deepest widget nesting a spec may use (the root is depth 1)."))
+    int32 MaxSpecHierarchyDepth = 100;
+
+    UPROPERTY(EditAnywhere, Config, Category = "MWCS|Limits", meta = (DisplayName = "Max Widgets Per Spec", ClampMin = "1"))
+    int32 MaxSpecWidgets = 100000;
+
+    UPROPERTY(EditAnywhere, Config, Category = "MWCS|Limits", meta = (DisplayName = "Max String Bytes", ClampMin = "1", ToolTip = "Longest JSON string (value or key) in a spec file, in UTF-8 bytes as written."))
+    int32 MaxSpecStringBytes = 1024 * 1024;
+
+    // Performance lint (MWCS_LintWidgets, and a stage of every validate run). Budgets are per spec.
+    UPROPERTY(EditAnywhere, Config, Category = "MWCS|Performance Lint", meta = (DisplayName = "Lint When Validating", ToolTip = "Run the Perf.* rules below after validating each spec: Validate All, Validate Selected, the Tool tab and MWCS_CreateWidgets -Validate."))
+    bool bPerfLintInValidateAll = true;
+
+    UPROPERTY(EditAnywhere, Config, Category = "MWCS|Performance Lint", meta = (DisplayName = "Max Depth", ToolTip = "Perf.Depth: deepest widget nesting (the root is depth 1)."))
+    FMWCS_PerfLintRule PerfLintDepth;
+
+    UPROPERTY(EditAnywhere, Config, Category = "MWCS|Performance Lint", meta = (DisplayName = "Max Widgets", ToolTip = "Perf.WidgetCount: widgets in one spec."))
+    FMWCS_PerfLintRule PerfLintWidgetCount;
+
+    UPROPERTY(EditAnywhere, Config, Category = "MWCS|Performance Lint", meta = (DisplayName = "Max CanvasPanel Children", ToolTip = "Perf.CanvasChildren: direct children of one CanvasPanel."))
+    FMWCS_PerfLintRule PerfLintCanvasChildren;
+
+    UPROPERTY(EditAnywhere, Config, Category = "MWCS|Performance Lint", meta = (DisplayName = "Max Variables", ToolTip = "Perf.VariableCount: widgets with an explicit IsVariable true, or named in Bindings (the IsVariable default is not counted)."))
+    FMWCS_PerfLintRule PerfLintVariableCount;
+
+    UPROPERTY(EditAnywhere, Config, Category = "MWCS|Performance Lint", meta = (DisplayName = "Hit-Testable Decorations", ToolTip = "Perf.HitTestable: Image, Border, Throbber and ProgressBar left Visible without a Design Visibility. Budget is not used."))
+    FMWCS_PerfLintRule PerfLintHitTestable;
+
+    // Pipelined BuildAll (MWCS_CreateWidgets -Pipeline)
+    UPROPERTY(EditAnywhere, Config, Category = "MWCS|Pipeline", meta = (DisplayName = "Parse Ahead", ClampMin = "1", ToolTip = "How many specs worker threads may parse ahead of the spec currently being built."))
+    int32 PipelineParseAhead = 2;
+
+    UPROPERTY(EditAnywhere, Config, Category = "MWCS|Pipeline", meta = (DisplayName = "Max Pending Async Saves", ClampMin = "1", ToolTip = "Async package writes allowed in flight before the build waits for them to flush."))
+    int32 PipelineMaxPendingSaves = 8;
+
+    // Editor UI runs (Tool tab / Tool EUW)
+    UPROPERTY(EditAnywhere, Config, Category = "MWCS|Editor UI", meta = (DisplayName = "Time Slice (ms)", ClampMin = "1", ToolTip = "Editor time spent on Validate/Build work per tick. At least one spec is processed per tick."))
+    int32 AsyncTimeSliceMs = 30;
+
+    UPROPERTY(EditAnywhere, Config, Category = "MWCS|Editor UI", meta = (DisplayName = "Hot Reload Spec Files", ToolTip = "Watch Spec Directories and rebuild (Repair) the widgets whose spec file was saved, plus the widgets that nest them."))
+    bool bHotReloadSpecFiles = true;
+
+    UPROPERTY(EditAnywhere, Config, Category = "MWCS|Editor UI", meta = (DisplayName = "Hot Reload Debounce (s)", ClampMin = "0.0", EditCondition = "bHotReloadSpecFiles", ToolTip = "Quiet period after the last save before rebuilding. Saves within it are coalesced into one rebuild."))
+    float HotReloadDebounceSeconds = 0.25f;
 };
 
@@ -0,0 +1,37 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "MWCS_Report.h"
+#include "MWCS_WidgetSpec.h"
+
+/**
+ * Subset selection for commandlets and service calls.
+ * An empty filter selects everything; otherwise every criterion that is set must match.
+ * Changed files select the specs they touch plus every spec that (transitively) nests them.
+ */
+struct P_MWCS_API FMWCS_SpecFilter
+{
+    // -Only=WBP_HUD*,WBP_Menu_*  (matched against BlueprintName)
+    TArray<FString> NameGlobs;
+
+    // -Provider=/Script/MyModule.*  (matched against the spec's provider path)
+    TArray<FString> ProviderGlobs;
+
+    // -ChangedFiles=<file>  (one path per line, absolute or relative to the project directory)
+    TArray<FString> ChangedFiles;
+    bool bUseChangedFiles = false; // set even when the list is empty (nothing changed -> nothing selected)
+
+    // -Shard=Index/Count (zero-based). Applied after the other criteria. Specs linked through nested
+    // UserWidgets always land in the same shard, and each shard is ordered dependencies-first.
+    int32 ShardIndex = 0;
+    int32 ShardCount = 0;
+
+    bool IsEmpty() const;
+
+    // Parses -Only=, -Provider=, -ChangedFiles= and -Shard= from commandlet params.
+    static bool FromParams(const FString &Params, FMWCS_SpecFilter &OutFilter, FMWCS_Report &InOutReport);
+
+    // Removes unselected specs (order is preserved) and updates SpecsProcessed.
+    void Apply(TArray<FMWCS_WidgetSpec> &InOutSpecs, FMWCS_Report &InOutReport) const;
+};
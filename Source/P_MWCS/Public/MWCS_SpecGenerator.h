@@ -0,0 +1,66 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "MWCS_Report.h"
+
+// Relative weights of the node kinds in generated hierarchies. Container kinds (CanvasPanel, Box, Overlay,
+// Button) compete for subtrees of more than one node, leaf kinds (TextBlock, UserWidget) for single nodes.
+struct FMWCS_SpecGeneratorMix
+{
+    float CanvasPanel = 1.0f;
+    float Box = 4.0f; // VerticalBox or HorizontalBox, half each
+    float Overlay = 2.0f;
+    float Button = 2.0f;
+    float TextBlock = 8.0f;
+    float UserWidget = 1.0f; // nests another generated spec
+};
+
+struct FMWCS_SpecGeneratorOptions
+{
+    int32 NumSpecs = 100;
+
+    // Exact widget count of every generated hierarchy, root included.
+    int32 NodesPerSpec = 200;
+
+    // Upper bound on the children of one panel (a Button always has one child).
+    int32 MaxChildren = 8;
+
+    int32 Seed = 1;
+
+    // Specs are named <NamePrefix><Index, 4 digits>, so file order is generation order.
+    FString NamePrefix = TEXT("WBP_MWCS_Gen_");
+
+    // Where the corpus will be built; nested UserWidget nodes reference <OutputRootPath>/<Name>.<Name>_C.
+    FString OutputRootPath = TEXT("/Game/MWCS_Benchmark");
+
+    FMWCS_SpecGeneratorMix Mix;
+};
+
+struct FMWCS_GeneratedSpec
+{
+    FName BlueprintName;
+    FString Json;
+    int32 NumNodes = 0;
+    int32 NumNested = 0;
+};
+
+/**
+ * Deterministic synthetic specs for scale testing: the same options always produce the same bytes.
+ * Every panel child carries slot metadata, TextBlocks and Buttons get Design entries, and the font and nested
+ * blueprints they use are listed in Dependencies. A UserWidget node only nests a spec with a lower index, so
+ * the corpus is acyclic and builds in file order.
+ */
+class P_MWCS_API FMWCS_SpecGenerator
+{
+public:
+    static void Generate(const FMWCS_SpecGeneratorOptions &Options, TArray<FMWCS_GeneratedSpec> &OutSpecs);
+
+    // Writes one canonical <BlueprintName>.json per spec into Directory after deleting the <NamePrefix>*.json files
+    // already there, plus a .mwcs_generated marker. Refuses (Generator.UnsafeDirectory, nothing written) a directory
+    // that holds JSON files but no marker. Adds Generator.WriteFailed errors and a Generator.Summary info entry.
+    static bool WriteCorpus(const FMWCS_SpecGeneratorOptions &Options, const FString &Directory, FMWCS_Report &InOutReport);
+
+    // Saved/MWCS/Benchmark/Specs
+    static FString GetDefaultCorpusDir();
+};
@@ -0,0 +1,39 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "MWCS_WidgetSpec.h"
+
+/**
+ * Dependency graph between specs, derived from nested UserWidget nodes and parent classes.
+ * Spec A depends on spec B when A's hierarchy references B's generated class (<OutputRootPath>/<Name>.<Name>_C)
+ * by WidgetClassPath, or when A's ParentClass is that generated class. Native classes are not edges.
+ * Indices refer to the spec array passed to Build().
+ */
+class P_MWCS_API FMWCS_SpecGraph
+{
+public:
+    void Build(const TArray<FMWCS_WidgetSpec> &Specs, const FString &OutputRootPath);
+
+    const TArray<int32> &GetDependencies(int32 SpecIndex) const { return Dependencies[SpecIndex]; }
+    const TArray<int32> &GetDependents(int32 SpecIndex) const { return Dependents[SpecIndex]; }
+    int32 Num() const { return Dependencies.Num(); }
+
+    // Adds every spec that (transitively) nests or derives from a widget in the selection.
+    void ExpandDependents(TSet<int32> &InOutSelected) const;
+
+    // Weakly connected components, each sorted ascending; components are ordered by their smallest index.
+    void GetComponents(TArray<TArray<int32>> &OutComponents) const;
+
+    // Reorders Indices so dependencies come before dependents (stable with respect to the input order).
+    // Cycles are broken by falling back to input order.
+    void SortDependenciesFirst(TArray<int32> &InOutIndices) const;
+
+    // Deterministically splits all specs into ShardCount groups without separating connected specs.
+    // Larger components are placed first, each on the currently lightest shard (ties: lowest shard).
+    void Partition(int32 ShardCount, TArray<TArray<int32>> &OutShards) const;
+
+private:
+    TArray<TArray<int32>> Dependencies;
+    TArray<TArray<int32>> Dependents;
+};
@@ -0,0 +1,24 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "MWCS_WidgetSpec.h"
+
+/**
+ * Optional pass between parsing and building (bCollapseRedundantContainers). Removes containers that do not change the
+ * layout: a VerticalBox, HorizontalBox or Overlay with exactly one child whose slot in it is neutral (no padding, Fill
+ * alignment, explicit for Overlay) and that spans the container (Overlay always; boxes when the child's Size is Fill, or
+ * when the box sits in a box of the same orientation that sizes it to content). The child takes over the container's slot
+ * in its parent. The root, and any container named in Bindings, Design or a BindWidget property of the ParentClass, is
+ * never removed.
+ */
+class P_MWCS_API FMWCS_SpecOptimizer
+{
+public:
+    // The setting is on and the spec is not a Tool EUW (those keep their contract hierarchy).
+    static bool IsEnabled(const FMWCS_WidgetSpec &Spec);
+
+    // Collapses in place and returns the number of containers removed. OutRemoved (optional) receives their names.
+    // Running it again on the result removes nothing.
+    static int32 Optimize(FMWCS_WidgetSpec &InOutSpec, TArray<FString> *OutRemoved = nullptr);
+};
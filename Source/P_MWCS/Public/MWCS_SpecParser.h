@@ -2,11 +2,26 @@
 
 #include "CoreMinimal.h"
 
+#include "MWCS_CoreSpec.h"
 #include "MWCS_Report.h"
+#include "MWCS_WidgetRegistry.h"
 #include "MWCS_WidgetSpec.h"
 
+// Spec diagnostics come from the engine-free core (Source/P_MWCS_Core), so mwcslint reports exactly what the editor does.
 class FMWCS_SpecParser
 {
 public:
     static bool ParseSpecJson(const FString &JsonString, FMWCS_WidgetSpec &OutSpec, FMWCS_Report &InOutReport, const FString &Context);
+
+    // Same as ParseSpecJson for a document already read into the core DOM (e.g. one entry of a split spec file).
+    static bool ParseSpecNode(const MWCS_Core::FJsonNode &Root, FMWCS_WidgetSpec &OutSpec, FMWCS_Report &InOutReport, const FString &Context);
+
+    // Uses Source.Root when the provider kept the parsed document, Source.Json otherwise.
+    static bool ParseSpecSource(const FMWCS_SpecSource &Source, FMWCS_WidgetSpec &OutSpec, FMWCS_Report &InOutReport);
+
+    // Parses, then adds the core's structural Lint.* checks (see MWCS_CoreLint.h). Returns false when the spec does not parse.
+    static bool LintSpecJson(const FString &JsonString, FMWCS_Report &InOutReport, const FString &Context);
+
+    // Zoom range and Spec.Limit.* caps from UMWCS_Settings, shared with FMWCS_FileSpecProvider.
+    static MWCS_Core::FSpecParseOptions GetCoreParseOptions();
 };
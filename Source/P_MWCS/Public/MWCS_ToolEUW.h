@@ -7,6 +7,8 @@
 
 class UButton;
 class UMultiLineEditableTextBox;
+class UNativeWidgetHost;
+class UProgressBar;
 class UTextBlock;
 
 UCLASS()
@@ -16,6 +18,7 @@ class UMWCS_ToolEUW : public UEditorUtilityWidget
 
 public:
     virtual void NativeConstruct() override;
+    virtual void NativeTick(const FGeometry &MyGeometry, float InDeltaTime) override;
 
 protected:
     UPROPERTY(meta = (BindWidget))
@@ -45,13 +48,33 @@ protected:
     UPROPERTY(meta = (BindWidget))
     UButton *Btn_ExtractSelectedWBP = nullptr;
 
-    UPROPERTY(meta = (BindWidget))
+    // Hosts the virtualized MWCS log view. OutputLog is the text box used by Tool EUWs generated
+    // before LogHost existed; it is only written to when LogHost is missing.
+    UPROPERTY(meta = (BindWidgetOptional))
+    UNativeWidgetHost *LogHost = nullptr;
+
+    UPROPERTY(meta = (BindWidgetOptional))
     UMultiLineEditableTextBox *OutputLog = nullptr;
 
+    // Optional so Tool EUWs generated before async runs still bind; Repair adds them.
+    UPROPERTY(meta = (BindWidgetOptional))
+    UProgressBar *RunProgress = nullptr;
+
+    UPROPERTY(meta = (BindWidgetOptional))
+    UTextBlock *RunStatusText = nullptr;
+
+    UPROPERTY(meta = (BindWidgetOptional))
+    UButton *Btn_Cancel = nullptr;
+
 private:
+    TSharedPtr<class SMWCS_LogView> LogView;
+
     void RefreshSettingsSummary();
     void AppendLine(const FString &Line);
     void AppendReport(const FString &Title, const struct FMWCS_Report &Report);
+    void StartRun(const FString &Title, const TSharedPtr<class FMWCS_AsyncRun> &Run);
+    void HandleRunFinished(const struct FMWCS_Report &Report, FString Title);
+    void RefreshRunState();
 
     bool ExportWidgetBlueprintHierarchyToJson(class UWidgetBlueprint *WidgetBlueprint,
                                               bool bWriteToFile = true,
@@ -86,4 +109,7 @@ private:
 
     UFUNCTION()
     void HandleExtractSelectedWbpClicked();
+
+    UFUNCTION()
+    void HandleCancelClicked();
 };
@@ -8,10 +8,27 @@
 
 class UWidgetBlueprint;
 
+struct FMWCS_BuildOptions
+{
+    // Queue the package write with SAVE_Async instead of blocking inside the build.
+    // Callers must flush with UPackage::WaitForAsyncFileWrites() before relying on the files on disk.
+    bool bAsyncSave = false;
+
+    // Build into this long package path instead of OutputRootPath.
+    FString OutputPathOverride;
+
+    // Compile only: the package is not saved and the asset index is not updated (used by parity checks).
+    bool bSkipSave = false;
+};
+
 class FMWCS_WidgetBuilder
 {
 public:
     static bool CreateOrUpdateFromSpec(const FMWCS_WidgetSpec &Spec, EMWCS_BuildMode Mode, FMWCS_Report &InOutReport);
+
+    // OutBlueprint (optional) receives the built blueprint, or the existing one when CreateMissing skips it,
+    // so callers can keep working with the in-memory object instead of reloading it.
+    static bool CreateOrUpdateFromSpec(const FMWCS_WidgetSpec &Spec, EMWCS_BuildMode Mode, const FMWCS_BuildOptions &Options, FMWCS_Report &InOutReport, UWidgetBlueprint **OutBlueprint = nullptr);
     static bool CreateOrUpdateToolEuwFromSpec(const FMWCS_WidgetSpec &Spec, EMWCS_BuildMode Mode, FMWCS_Report &InOutReport);
     static bool CreateOrUpdateToolEuwFromSpecWithPath(const FMWCS_WidgetSpec &Spec, const FString &OutputPath, const FString &AssetName, EMWCS_BuildMode Mode, FMWCS_Report &InOutReport);
 };
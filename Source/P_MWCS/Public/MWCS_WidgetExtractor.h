@@ -0,0 +1,67 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "MWCS_Report.h"
+
+class UWidgetBlueprint;
+struct FAssetData;
+
+struct FMWCS_ExtractOptions
+{
+    bool bIncludeSourceAssetField = false;
+    bool bIncludeSlotLayout = true;
+    bool bIncludeCanvasSlot = true;
+    bool bIncludeTextProperties = true;
+    bool bIncludeWidgetClassPaths = true;
+    bool bIncludeIsVariable = false;
+    bool bIncludePropertiesSection = true;
+    bool bIncludeDesignSection = true;
+
+    // Write only properties that differ from the widget's or slot's class default object.
+    // Smaller specs; the builder leaves omitted properties at their defaults, so the asset rebuilds the same.
+    bool bMinimal = false;
+
+    // Canonical JSON either way (sorted keys, fixed number format); minified drops all whitespace.
+    bool bMinified = false;
+};
+
+struct FMWCS_ExtractBatchOptions
+{
+    // Empty means Saved/MWCS/ExtractedSpecs.
+    FString OutputDir;
+
+    // Packages requested with LoadPackageAsync before waiting; bounds memory between garbage collections.
+    int32 BatchSize = 32;
+
+    // Re-extract even when the package and options are unchanged since the last extraction.
+    bool bForce = false;
+
+    // With FMWCS_ExtractOptions::bMinimal, also run CheckMinimalParity on every extracted asset.
+    bool bParityCheck = false;
+};
+
+/**
+ * Widget Blueprint -> GetWidgetSpec-style JSON.
+ * UI-free so it can be shared by the Tool EUW, commandlets and the build server.
+ */
+class P_MWCS_API FMWCS_WidgetExtractor
+{
+public:
+    // Canonical JSON written by FMWCS_CanonicalJsonWriter during the widget walk (no FJsonValue tree).
+    static bool ExtractToJson(UWidgetBlueprint *WidgetBlueprint, const FMWCS_ExtractOptions &Options, FString &OutJson, FMWCS_Report &InOutReport);
+
+    // Extracts and writes <OutputDir>/<BlueprintName>.json. An empty OutputDir means Saved/MWCS/ExtractedSpecs.
+    static bool ExtractToFile(UWidgetBlueprint *WidgetBlueprint, const FMWCS_ExtractOptions &Options, const FString &OutputDir, FString &OutPath, FMWCS_Report &InOutReport);
+
+    // Extracts every Widget Blueprint in Assets: packages load in async batches, the canonical JSON is written
+    // during the widget walk on the game thread and files are written on worker threads, and assets whose package file hash and options match Saved/MWCS/ExtractManifest.json
+    // (and whose output file still exists) are skipped.
+    static void ExtractAssets(const TArray<FAssetData> &Assets, const FMWCS_ExtractOptions &Options, const FMWCS_ExtractBatchOptions &BatchOptions, FMWCS_Report &InOutReport);
+
+    // Parses the minimal extraction, builds it into /Temp/MWCS_Parity without saving and compares the full
+    // extraction of both blueprints. Adds Extract.ParityOk (info) or Extract.ParityMismatch (error).
+    static bool CheckMinimalParity(UWidgetBlueprint *WidgetBlueprint, const FMWCS_ExtractOptions &Options, FMWCS_Report &InOutReport);
+
+    static FString GetDefaultOutputDir();
+};
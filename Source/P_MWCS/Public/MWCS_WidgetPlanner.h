@@ -0,0 +1,52 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "MWCS_Report.h"
+#include "MWCS_WidgetSpec.h"
+
+// Ordered by severity so the strongest change found for a spec wins.
+enum class EMWCS_PlanChange : uint8
+{
+    Unchanged,
+    PropertyOnly,
+    Structural,
+    New,
+};
+
+struct P_MWCS_API FMWCS_PlanEntry
+{
+    FName BlueprintName;
+    FString AssetPath;
+    EMWCS_PlanChange Change = EMWCS_PlanChange::Unchanged;
+
+    // True when the asset registry alone was not enough and the blueprint had to be loaded.
+    bool bLoadedAsset = false;
+
+    // Human-readable differences, e.g. "Validator.Hierarchy.TypeMismatch: ...".
+    TArray<FString> Reasons;
+};
+
+struct P_MWCS_API FMWCS_Plan
+{
+    TArray<FMWCS_PlanEntry> Entries;
+
+    // Discovery/parse problems and anything that prevented a diff.
+    FMWCS_Report Report;
+
+    int32 Count(EMWCS_PlanChange Change) const;
+    bool HasChanges() const;
+};
+
+// Computes what a Repair build would change without compiling or saving anything.
+class FMWCS_WidgetPlanner
+{
+public:
+    static void PlanSpec(const FMWCS_WidgetSpec &Spec, FMWCS_PlanEntry &OutEntry, FMWCS_Report &InOutReport);
+};
+
+namespace MWCS_PlanJson
+{
+    P_MWCS_API FString ChangeToString(EMWCS_PlanChange Change);
+    P_MWCS_API FString ToJsonString(const FMWCS_Plan &Plan);
+}
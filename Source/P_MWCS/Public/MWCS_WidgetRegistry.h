@@ -2,11 +2,29 @@
 
 #include "CoreMinimal.h"
 
+#include "MWCS_CoreJson.h"
 #include "MWCS_Report.h"
 #include "MWCS_WidgetSpec.h"
 
+// Raw spec JSON as returned by a provider, before parsing.
+struct FMWCS_SpecSource
+{
+    FString Json;
+    FString Context;
+
+    // The document Json was read into, when the provider already parsed it (spec files); parse with
+    // FMWCS_SpecParser::ParseSpecSource so it is not read a second time. Shared by every copy of the source.
+    TSharedPtr<const MWCS_Core::FJsonNode> Root;
+};
+
 class FMWCS_WidgetRegistry
 {
 public:
-    static bool CollectSpecs(TArray<FMWCS_WidgetSpec> &OutSpecs, FMWCS_Report &InOutReport);
+    // OnlyProviders (provider class paths) restricts collection to those allowlisted providers; null means all.
+    static bool CollectSpecs(TArray<FMWCS_WidgetSpec> &OutSpecs, FMWCS_Report &InOutReport, const TSet<FString> *OnlyProviders = nullptr);
+
+    // Calls GetWidgetSpec() on every allowlisted provider, then reads the configured spec directories,
+    // without parsing the result.
+    // Must run on the game thread (providers are invoked through ProcessEvent).
+    static bool CollectSpecSources(TArray<FMWCS_SpecSource> &OutSources, FMWCS_Report &InOutReport, const TSet<FString> *OnlyProviders = nullptr);
 };
@@ -19,6 +19,7 @@ struct FMWCS_HierarchyNode
     FName Name;
     FName Type;
     bool bIsVariable = true;
+    bool bHasIsVariable = false; // IsVariable was written in the spec rather than defaulted
     FString Text;
 
     // Optional: for Type == "UserWidget". Can be a native class path (/Script/Module.Class)
@@ -99,6 +100,13 @@ struct FMWCS_WidgetSpec
     FString ParentClassPath;
     FString Version;
     bool bIsToolEUW = false;
+
+    // Where the spec came from (the parse context, normally the provider class path).
+    // Used by -Provider filters and changed-file mapping.
+    FString ProviderPath;
+
+    // SHA-1 of the canonical (minified, key-sorted) spec JSON; recorded in the asset index on every build.
+    FString SpecHash;
     FMWCS_DesignerPreview DesignerPreview;
     FMWCS_HierarchyNode HierarchyRoot;
     FMWCS_Bindings Bindings;
@@ -5,8 +5,14 @@
 #include "MWCS_Report.h"
 #include "MWCS_WidgetSpec.h"
 
+class UWidgetBlueprint;
+
 class FMWCS_WidgetValidator
 {
 public:
     static bool ValidateSpecAsset(const FMWCS_WidgetSpec &Spec, FMWCS_Report &InOutReport);
+
+    // Validates an already-loaded blueprint against its spec (skips the asset lookup/load).
+    // Returns false if this call added any errors.
+    static bool ValidateBlueprint(const FMWCS_WidgetSpec &Spec, UWidgetBlueprint *BP, FMWCS_Report &InOutReport);
 };
@@ -0,0 +1,17 @@
+using UnrealBuildTool;
+
+// Engine-free spec core (std-only C++17). The same sources build outside the editor as Tools/MWCSLint.
+public class P_MWCS_Core : ModuleRules
+{
+    public P_MWCS_Core(ReadOnlyTargetRules Target) : base(Target)
+    {
+        PCHUsage = PCHUsageMode.UseExplicitOrSharedPCHs;
+
+        PublicDependencyModuleNames.AddRange(
+            new string[]
+            {
+                "Core"
+            }
+        );
+    }
+}
@@ -0,0 +1,334 @@
+#include "MWCS_CoreCanonical.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+
+namespace MWCS_Core
+{
+    namespace
+    {
+        void AppendIndent(std::string &Out, int Depth)
+        {
+            Out.append(static_cast<size_t>(Depth), '\t');
+        }
+
+        void WriteNode(std::string &Out, const FJsonNode &Node, bool bPretty, int Depth)
+        {
+            switch (Node.Type)
+            {
+            case EJsonType::Bool:
+                Out += Node.Bool ? "true" : "false";
+                return;
+            case EJsonType::Number:
+                Out += FormatNumber(Node.Number);
+                return;
+            case EJsonType::String:
+                Out += QuoteString(Node.String);
+                return;
+            case EJsonType::Array:
+            {
+                if (Node.Array.empty())
+                {
+                    Out += "[]";
+                    return;
+                }
+                Out += '[';
+                for (size_t Index = 0; Index < Node.Array.size(); ++Index)
+                {
+                    if (Index > 0)
+                    {
+                        Out += ',';
+                    }
+                    if (bPretty)
+                    {
+                        Out += '\n';
+                        AppendIndent(Out, Depth + 1);
+                    }
+                    WriteNode(Out, Node.Array[Index], bPretty, Depth + 1);
+                }
+                if (bPretty)
+                {
+                    Out += '\n';
+                    AppendIndent(Out, Depth);
+                }
+                Out += ']';
+                return;
+            }
+            case EJsonType::Object:
+            {
+                if (Node.Object.empty())
+                {
+                    Out += "{}";
+                    return;
+                }
+
+                // Exact duplicates can only come from hand-built nodes (the reader collapses them); last one wins.
+                std::vector<const FJsonMember *> Members;
+                Members.reserve(Node.Object.size());
+                for (const FJsonMember &Member : Node.Object)
+                {
+                    auto Existing = std::find_if(Members.begin(), Members.end(), [&Member](const FJsonMember *Other)
+                                                 { return Other->Key == Member.Key; });
+                    if (Existing != Members.end())
+                    {
+                        *Existing = &Member;
+                    }
+                    else
+                    {
+                        Members.push_back(&Member);
+                    }
+                }
+                std::stable_sort(Members.begin(), Members.end(), [](const FJsonMember *A, const FJsonMember *B)
+                                 { return A->Key < B->Key; });
+
+                Out += '{';
+                for (size_t Index = 0; Index < Members.size(); ++Index)
+                {
+                    if (Index > 0)
+                    {
+                        Out += ',';
+                    }
+                    if (bPretty)
+                    {
+                        Out += '\n';
+                        AppendIndent(Out, Depth + 1);
+                    }
+                    Out += QuoteString(Members[Index]->Key);
+                    Out += bPretty ? ": " : ":";
+                    WriteNode(Out, Members[Index]->Value, bPretty, Depth + 1);
+                }
+                if (bPretty)
+                {
+                    Out += '\n';
+                    AppendIndent(Out, Depth);
+                }
+                Out += '}';
+                return;
+            }
+            default:
+                Out += "null";
+                return;
+            }
+        }
+
+        struct FSha1
+        {
+            uint32_t State[5] = {0x67452301u, 0xEFCDAB89u, 0x98BADCFEu, 0x10325476u, 0xC3D2E1F0u};
+            uint8_t Block[64] = {};
+            size_t BlockLen = 0;
+            uint64_t TotalBits = 0;
+
+            static uint32_t Rotl(uint32_t Value, int Bits)
+            {
+                return (Value << Bits) | (Value >> (32 - Bits));
+            }
+
+            void Transform()
+            {
+                uint32_t W[80];
+                for (int Index = 0; Index < 16; ++Index)
+                {
+                    W[Index] = (static_cast<uint32_t>(Block[Index * 4]) << 24) | (static_cast<uint32_t>(Block[Index * 4 + 1]) << 16) |
+                               (static_cast<uint32_t>(Block[Index * 4 + 2]) << 8) | static_cast<uint32_t>(Block[Index * 4 + 3]);
+                }
+                for (int Index = 16; Index < 80; ++Index)
+                {
+                    W[Index] = Rotl(W[Index - 3] ^ W[Index - 8] ^ W[Index - 14] ^ W[Index - 16], 1);
+                }
+
+                uint32_t A = State[0], B = State[1], C = State[2], D = State[3], E = State[4];
+                for (int Index = 0; Index < 80; ++Index)
+                {
+                    uint32_t F, K;
+                    if (Index < 20)
+                    {
+                        F = (B & C) | (~B & D);
+                        K = 0x5A827999u;
+                    }
+                    else if (Index < 40)
+                    {
+                        F = B ^ C ^ D;
+                        K = 0x6ED9EBA1u;
+                    }
+                    else if (Index < 60)
+                    {
+                        F = (B & C) | (B & D) | (C & D);
+                        K = 0x8F1BBCDCu;
+                    }
+                    else
+                    {
+                        F = B ^ C ^ D;
+                        K = 0xCA62C1D6u;
+                    }
+                    const uint32_t Temp = Rotl(A, 5) + F + E + K + W[Index];
+                    E = D;
+                    D = C;
+                    C = Rotl(B, 30);
+                    B = A;
+                    A = Temp;
+                }
+                State[0] += A;
+                State[1] += B;
+                State[2] += C;
+                State[3] += D;
+                State[4] += E;
+            }
+
+            void Update(const uint8_t *Data, size_t Len)
+            {
+                TotalBits += static_cast<uint64_t>(Len) * 8;
+                for (size_t Index = 0; Index < Len; ++Index)
+                {
+                    Block[BlockLen++] = Data[Index];
+                    if (BlockLen == 64)
+                    {
+                        Transform();
+                        BlockLen = 0;
+                    }
+                }
+            }
+
+            std::string FinalHex()
+            {
+                const uint64_t Bits = TotalBits;
+                const uint8_t Pad = 0x80;
+                const uint8_t Zero = 0;
+                Update(&Pad, 1);
+                while (BlockLen != 56)
+                {
+                    Update(&Zero, 1);
+                }
+                uint8_t Length[8];
+                for (int Index = 0; Index < 8; ++Index)
+                {
+                    Length[Index] = static_cast<uint8_t>(Bits >> (56 - Index * 8));
+                }
+                Update(Length, 8);
+
+                static const char Digits[] = "0123456789ABCDEF";
+                std::string Hex;
+                Hex.reserve(40);
+                for (uint32_t Word : State)
+                {
+                    for (int Shift = 28; Shift >= 0; Shift -= 4)
+                    {
+                        Hex += Digits[(Word >> Shift) & 0xF];
+                    }
+                }
+                return Hex;
+            }
+        };
+    } // namespace
+
+    std::string Canonicalize(const FJsonNode &Root, bool bPretty)
+    {
+        std::string Out;
+        WriteNode(Out, Root, bPretty, 0);
+        return Out;
+    }
+
+    bool CanonicalizeText(std::string_view Json, std::string &OutCanonical, bool bPretty)
+    {
+        FJsonNode Root;
+        if (!ParseJson(Json, Root))
+        {
+            return false;
+        }
+        OutCanonical = Canonicalize(Root, bPretty);
+        return true;
+    }
+
+    std::string FormatNumber(double Value)
+    {
+        if (!std::isfinite(Value))
+        {
+            return "0";
+        }
+
+        const double Rounded = std::floor(Value + 0.5); // FMath::RoundToDouble
+        char Buffer[512];
+        if (std::fabs(Value - Rounded) < 0.0000005 && std::fabs(Rounded) < 1e15)
+        {
+            const long long AsInt = static_cast<long long>(Rounded);
+            if (AsInt == 0)
+            {
+                return "0";
+            }
+            std::snprintf(Buffer, sizeof(Buffer), "%lld", AsInt);
+            return Buffer;
+        }
+
+        std::snprintf(Buffer, sizeof(Buffer), "%.6f", Value);
+        std::string Text(Buffer);
+        while (!Text.empty() && Text.back() == '0')
+        {
+            Text.pop_back();
+        }
+        if (!Text.empty() && Text.back() == '.')
+        {
+            Text.pop_back();
+        }
+        return Text;
+    }
+
+    std::string QuoteString(std::string_view Value)
+    {
+        std::string Out;
+        Out.reserve(Value.size() + 2);
+        Out += '"';
+        for (const char Ch : Value)
+        {
+            switch (Ch)
+            {
+            case '"':
+                Out += "\\\"";
+                break;
+            case '\\':
+                Out += "\\\\";
+                break;
+            case '\n':
+                Out += "\\n";
+                break;
+            case '\r':
+                Out += "\\r";
+                break;
+            case '\t':
+                Out += "\\t";
+                break;
+            case '\b':
+                Out += "\\b";
+                break;
+            case '\f':
+                Out += "\\f";
+                break;
+            default:
+                if (static_cast<unsigned char>(Ch) < 0x20)
+                {
+                    char Escape[8];
+                    std::snprintf(Escape, sizeof(Escape), "\\u%04x", static_cast<unsigned>(static_cast<unsigned char>(Ch)));
+                    Out += Escape;
+                }
+                else
+                {
+                    Out += Ch;
+                }
+                break;
+            }
+        }
+        Out += '"';
+        return Out;
+    }
+
+    std::string Sha1Hex(std::string_view Data)
+    {
+        FSha1 Sha;
+        Sha.Update(reinterpret_cast<const uint8_t *>(Data.data()), Data.size());
+        return Sha.FinalHex();
+    }
+
+    std::string SpecHash(const FJsonNode &Root)
+    {
+        return Sha1Hex(Canonicalize(Root, /*bPretty*/ false));
+    }
+} // namespace MWCS_Core
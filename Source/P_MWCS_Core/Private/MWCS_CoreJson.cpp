@@ -0,0 +1,672 @@
+#include "MWCS_CoreJson.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+namespace MWCS_Core
+{
+    namespace
+    {
+        char ToLowerAscii(char Ch)
+        {
+            return (Ch >= 'A' && Ch <= 'Z') ? static_cast<char>(Ch - 'A' + 'a') : Ch;
+        }
+
+        // FCString::IsNumeric: optional sign, digits and at most one '.'. A lone sign counts as numeric.
+        bool IsNumericString(const std::string &Str)
+        {
+            if (Str.empty())
+            {
+                return false;
+            }
+            size_t Index = (Str[0] == '-' || Str[0] == '+') ? 1 : 0;
+            bool bHasDot = false;
+            for (; Index < Str.size(); ++Index)
+            {
+                const char Ch = Str[Index];
+                if (Ch == '.')
+                {
+                    if (bHasDot)
+                    {
+                        return false;
+                    }
+                    bHasDot = true;
+                }
+                else if (Ch < '0' || Ch > '9')
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        // FString::SanitizeFloat(Value, 0): "%f" with trailing zeros (and a bare '.') removed, no negative zero.
+        std::string SanitizeFloat(double Value)
+        {
+            if (Value == 0.0)
+            {
+                Value = 0.0;
+            }
+            char Buffer[512];
+            std::snprintf(Buffer, sizeof(Buffer), "%f", Value);
+            std::string Text(Buffer);
+            if (!IsNumericString(Text))
+            {
+                return Text; // inf / nan
+            }
+            const size_t Dot = Text.find('.');
+            if (Dot != std::string::npos)
+            {
+                size_t End = Text.size();
+                while (End > Dot + 1 && Text[End - 1] == '0')
+                {
+                    --End;
+                }
+                if (End == Dot + 1)
+                {
+                    End = Dot;
+                }
+                Text.resize(End);
+            }
+            return Text;
+        }
+
+        void AppendUtf8(std::string &Out, uint32_t CodePoint)
+        {
+            if (CodePoint < 0x80)
+            {
+                Out += static_cast<char>(CodePoint);
+            }
+            else if (CodePoint < 0x800)
+            {
+                Out += static_cast<char>(0xC0 | (CodePoint >> 6));
+                Out += static_cast<char>(0x80 | (CodePoint & 0x3F));
+            }
+            else if (CodePoint < 0x10000)
+            {
+                Out += static_cast<char>(0xE0 | (CodePoint >> 12));
+                Out += static_cast<char>(0x80 | ((CodePoint >> 6) & 0x3F));
+                Out += static_cast<char>(0x80 | (CodePoint & 0x3F));
+            }
+            else
+            {
+                Out += static_cast<char>(0xF0 | (CodePoint >> 18));
+                Out += static_cast<char>(0x80 | ((CodePoint >> 12) & 0x3F));
+                Out += static_cast<char>(0x80 | ((CodePoint >> 6) & 0x3F));
+                Out += static_cast<char>(0x80 | (CodePoint & 0x3F));
+            }
+        }
+
+        class FReader
+        {
+        public:
+            FReader(std::string_view InText, const FJsonLimits &InLimits)
+                : Text(InText), Limits(InLimits)
+            {
+            }
+
+            bool ReadDocument(FJsonNode &Out)
+            {
+                if (Text.size() > Limits.MaxDocumentBytes)
+                {
+                    return Fail(EJsonError::DocumentTooLarge, "document of " + std::to_string(Text.size()) + " bytes exceeds the " + std::to_string(Limits.MaxDocumentBytes) + "-byte limit");
+                }
+                SkipWhitespace();
+                if (!ReadValue(Out))
+                {
+                    return false;
+                }
+                SkipWhitespace();
+                if (Pos != Text.size())
+                {
+                    return Fail("Unexpected additional input");
+                }
+                return true;
+            }
+
+            FJsonError Error;
+
+        private:
+            bool Fail(EJsonError Kind, const std::string &Message)
+            {
+                if (Error.Kind == EJsonError::None)
+                {
+                    Error.Kind = Kind;
+                    Error.Offset = Pos;
+                    Error.Message = Kind == EJsonError::DocumentTooLarge ? Message : Message + " at offset " + std::to_string(Pos);
+                }
+                return false;
+            }
+
+            bool Fail(const char *Message)
+            {
+                return Fail(EJsonError::Syntax, Message);
+            }
+
+            bool FailStringTooLong()
+            {
+                return Fail(EJsonError::StringTooLong, "string exceeds the " + std::to_string(Limits.MaxStringBytes) + "-byte limit");
+            }
+
+            // Entered for every object and array; the matching Leave runs on every return path of ReadValue.
+            bool Enter()
+            {
+                if (++Depth > Limits.MaxNesting)
+                {
+                    return Fail(EJsonError::NestingTooDeep, "nesting exceeds " + std::to_string(Limits.MaxNesting) + " levels");
+                }
+                return true;
+            }
+
+            void SkipWhitespace()
+            {
+                while (Pos < Text.size() && (Text[Pos] == ' ' || Text[Pos] == '\t' || Text[Pos] == '\n' || Text[Pos] == '\r'))
+                {
+                    ++Pos;
+                }
+            }
+
+            bool Consume(char Ch)
+            {
+                if (Pos < Text.size() && Text[Pos] == Ch)
+                {
+                    ++Pos;
+                    return true;
+                }
+                return false;
+            }
+
+            bool ConsumeLiteral(const char *Literal)
+            {
+                const size_t Len = std::strlen(Literal);
+                if (Text.compare(Pos, Len, Literal) != 0)
+                {
+                    return Fail("Invalid literal");
+                }
+                Pos += Len;
+                return true;
+            }
+
+            bool ReadValue(FJsonNode &Out)
+            {
+                if (Pos >= Text.size())
+                {
+                    return Fail("Unexpected end of input");
+                }
+                switch (Text[Pos])
+                {
+                case '{':
+                case '[':
+                {
+                    const bool bRead = Enter() && (Text[Pos] == '{' ? ReadObject(Out) : ReadArray(Out));
+                    --Depth;
+                    return bRead;
+                }
+                case '"':
+                    Out.Type = EJsonType::String;
+                    return ReadString(Out.String);
+                case 't':
+                    Out.Type = EJsonType::Bool;
+                    Out.Bool = true;
+                    return ConsumeLiteral("true");
+                case 'f':
+                    Out.Type = EJsonType::Bool;
+                    Out.Bool = false;
+                    return ConsumeLiteral("false");
+                case 'n':
+                    Out.Type = EJsonType::Null;
+                    return ConsumeLiteral("null");
+                default:
+                    return ReadNumber(Out);
+                }
+            }
+
+            bool ReadObject(FJsonNode &Out)
+            {
+                Out.Type = EJsonType::Object;
+                ++Pos; // {
+                SkipWhitespace();
+                if (Consume('}'))
+                {
+                    return true;
+                }
+                for (;;)
+                {
+                    SkipWhitespace();
+                    std::string Key;
+                    if (Pos >= Text.size() || Text[Pos] != '"')
+                    {
+                        return Fail("Expected a member name");
+                    }
+                    if (!ReadString(Key))
+                    {
+                        return false;
+                    }
+                    SkipWhitespace();
+                    if (!Consume(':'))
+                    {
+                        return Fail("Expected ':'");
+                    }
+                    SkipWhitespace();
+                    FJsonNode Value;
+                    if (!ReadValue(Value))
+                    {
+                        return false;
+                    }
+                    Out.Set(Key, std::move(Value));
+                    SkipWhitespace();
+                    if (Consume('}'))
+                    {
+                        return true;
+                    }
+                    if (!Consume(','))
+                    {
+                        return Fail("Expected ',' or '}'");
+                    }
+                }
+            }
+
+            bool ReadArray(FJsonNode &Out)
+            {
+                Out.Type = EJsonType::Array;
+                ++Pos; // [
+                SkipWhitespace();
+                if (Consume(']'))
+                {
+                    return true;
+                }
+                for (;;)
+                {
+                    SkipWhitespace();
+                    Out.Array.emplace_back();
+                    if (!ReadValue(Out.Array.back()))
+                    {
+                        return false;
+                    }
+                    SkipWhitespace();
+                    if (Consume(']'))
+                    {
+                        return true;
+                    }
+                    if (!Consume(','))
+                    {
+                        return Fail("Expected ',' or ']'");
+                    }
+                }
+            }
+
+            bool ReadHex4(uint32_t &Out)
+            {
+                if (Pos + 4 > Text.size())
+                {
+                    return Fail("Truncated \\u escape");
+                }
+                Out = 0;
+                for (int Index = 0; Index < 4; ++Index)
+                {
+                    const char Ch = Text[Pos++];
+                    Out <<= 4;
+                    if (Ch >= '0' && Ch <= '9')
+                        Out |= static_cast<uint32_t>(Ch - '0');
+                    else if (Ch >= 'a' && Ch <= 'f')
+                        Out |= static_cast<uint32_t>(Ch - 'a' + 10);
+                    else if (Ch >= 'A' && Ch <= 'F')
+                        Out |= static_cast<uint32_t>(Ch - 'A' + 10);
+                    else
+                        return Fail("Invalid \\u escape");
+                }
+                return true;
+            }
+
+            // Raw control characters are accepted, as TJsonReader does.
+            bool ReadString(std::string &Out)
+            {
+                ++Pos; // "
+                const size_t Start = Pos;
+                for (;;)
+                {
+                    if (Pos >= Text.size())
+                    {
+                        return Fail("Unterminated string");
+                    }
+                    if (Pos - Start > Limits.MaxStringBytes)
+                    {
+                        return FailStringTooLong();
+                    }
+                    const char Ch = Text[Pos++];
+                    if (Ch == '"')
+                    {
+                        return Pos - 1 - Start <= Limits.MaxStringBytes || FailStringTooLong();
+                    }
+                    if (Ch != '\\')
+                    {
+                        Out += Ch;
+                        continue;
+                    }
+                    if (Pos >= Text.size())
+                    {
+                        return Fail("Unterminated string");
+                    }
+                    const char Escape = Text[Pos++];
+                    switch (Escape)
+                    {
+                    case '"':
+                    case '\\':
+                    case '/':
+                        Out += Escape;
+                        break;
+                    case 'b':
+                        Out += '\b';
+                        break;
+                    case 'f':
+                        Out += '\f';
+                        break;
+                    case 'n':
+                        Out += '\n';
+                        break;
+                    case 'r':
+                        Out += '\r';
+                        break;
+                    case 't':
+                        Out += '\t';
+                        break;
+                    case 'u':
+                    {
+                        uint32_t CodePoint = 0;
+                        if (!ReadHex4(CodePoint))
+                        {
+                            return false;
+                        }
+                        if (CodePoint >= 0xD800 && CodePoint <= 0xDBFF && Text.compare(Pos, 2, "\\u") == 0)
+                        {
+                            const size_t Save = Pos;
+                            Pos += 2;
+                            uint32_t Low = 0;
+                            if (!ReadHex4(Low))
+                            {
+                                return false;
+                            }
+                            if (Low >= 0xDC00 && Low <= 0xDFFF)
+                            {
+                                CodePoint = 0x10000 + ((CodePoint - 0xD800) << 10) + (Low - 0xDC00);
+                            }
+                            else
+                            {
+                                Pos = Save;
+                            }
+                        }
+                        AppendUtf8(Out, CodePoint);
+                        break;
+                    }
+                    default:
+                        return Fail("Invalid escape");
+                    }
+                }
+            }
+
+            bool ReadNumber(FJsonNode &Out)
+            {
+                const size_t Start = Pos;
+                Consume('-');
+                if (!Consume('0'))
+                {
+                    if (Pos >= Text.size() || Text[Pos] < '1' || Text[Pos] > '9')
+                    {
+                        return Fail("Unexpected character");
+                    }
+                    SkipDigits();
+                }
+                if (Consume('.'))
+                {
+                    if (!SkipDigits())
+                    {
+                        return Fail("Expected digits after '.'");
+                    }
+                }
+                if (Consume('e') || Consume('E'))
+                {
+                    if (!Consume('+'))
+                    {
+                        Consume('-');
+                    }
+                    if (!SkipDigits())
+                    {
+                        return Fail("Expected exponent digits");
+                    }
+                }
+                Out.Type = EJsonType::Number;
+                Out.Number = std::strtod(std::string(Text.substr(Start, Pos - Start)).c_str(), nullptr);
+                return true;
+            }
+
+            bool SkipDigits()
+            {
+                const size_t Start = Pos;
+                while (Pos < Text.size() && Text[Pos] >= '0' && Text[Pos] <= '9')
+                {
+                    ++Pos;
+                }
+                return Pos > Start;
+            }
+
+            std::string_view Text;
+            const FJsonLimits &Limits;
+            size_t Pos = 0;
+            int32_t Depth = 0;
+        };
+    } // namespace
+
+    bool EqualsIgnoreCase(std::string_view A, std::string_view B)
+    {
+        if (A.size() != B.size())
+        {
+            return false;
+        }
+        for (size_t Index = 0; Index < A.size(); ++Index)
+        {
+            if (ToLowerAscii(A[Index]) != ToLowerAscii(B[Index]))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    const FJsonNode *FJsonNode::Find(std::string_view Key) const
+    {
+        if (Type != EJsonType::Object)
+        {
+            return nullptr;
+        }
+        for (const FJsonMember &Member : Object)
+        {
+            if (EqualsIgnoreCase(Member.Key, Key))
+            {
+                return &Member.Value;
+            }
+        }
+        return nullptr;
+    }
+
+    void FJsonNode::Set(std::string_view Key, FJsonNode &&Value)
+    {
+        Type = EJsonType::Object;
+        for (FJsonMember &Member : Object)
+        {
+            if (EqualsIgnoreCase(Member.Key, Key))
+            {
+                Member.Key.assign(Key.data(), Key.size());
+                Member.Value = std::move(Value);
+                return;
+            }
+        }
+        Object.push_back(FJsonMember{std::string(Key), std::move(Value)});
+    }
+
+    bool FJsonNode::TryGetString(std::string &Out) const
+    {
+        switch (Type)
+        {
+        case EJsonType::String:
+            Out = String;
+            return true;
+        case EJsonType::Number:
+            Out = SanitizeFloat(Number);
+            return true;
+        case EJsonType::Bool:
+            Out = Bool ? "true" : "false";
+            return true;
+        default:
+            return false;
+        }
+    }
+
+    bool FJsonNode::TryGetNumber(double &Out) const
+    {
+        switch (Type)
+        {
+        case EJsonType::Number:
+            Out = Number;
+            return true;
+        case EJsonType::String:
+            if (!IsNumericString(String))
+            {
+                return false;
+            }
+            Out = std::strtod(String.c_str(), nullptr);
+            return true;
+        case EJsonType::Bool:
+            Out = Bool ? 1.0 : 0.0;
+            return true;
+        default:
+            return false;
+        }
+    }
+
+    bool FJsonNode::TryGetBool(bool &Out) const
+    {
+        switch (Type)
+        {
+        case EJsonType::Bool:
+            Out = Bool;
+            return true;
+        case EJsonType::Number:
+            Out = Number != 0.0;
+            return true;
+        case EJsonType::String:
+            if (EqualsIgnoreCase(String, "true") || EqualsIgnoreCase(String, "yes") || EqualsIgnoreCase(String, "on"))
+            {
+                Out = true;
+            }
+            else if (EqualsIgnoreCase(String, "false") || EqualsIgnoreCase(String, "no") || EqualsIgnoreCase(String, "off"))
+            {
+                Out = false;
+            }
+            else
+            {
+                Out = std::strtol(String.c_str(), nullptr, 10) != 0;
+            }
+            return true;
+        default:
+            return false;
+        }
+    }
+
+    bool FJsonNode::TryGetStringField(std::string_view Key, std::string &Out) const
+    {
+        const FJsonNode *Field = Find(Key);
+        return Field && Field->TryGetString(Out);
+    }
+
+    bool FJsonNode::TryGetNumberField(std::string_view Key, double &Out) const
+    {
+        const FJsonNode *Field = Find(Key);
+        return Field && Field->TryGetNumber(Out);
+    }
+
+    bool FJsonNode::TryGetBoolField(std::string_view Key, bool &Out) const
+    {
+        const FJsonNode *Field = Find(Key);
+        return Field && Field->TryGetBool(Out);
+    }
+
+    const FJsonNode *FJsonNode::TryGetObjectField(std::string_view Key) const
+    {
+        const FJsonNode *Field = Find(Key);
+        return (Field && Field->Type == EJsonType::Object) ? Field : nullptr;
+    }
+
+    const FJsonNode *FJsonNode::TryGetArrayField(std::string_view Key) const
+    {
+        const FJsonNode *Field = Find(Key);
+        return (Field && Field->Type == EJsonType::Array) ? Field : nullptr;
+    }
+
+    bool ParseJson(std::string_view Text, FJsonNode &OutRoot, FJsonError *OutError, const FJsonLimits &Limits)
+    {
+        OutRoot = FJsonNode();
+        FReader Reader(Text, Limits);
+        if (!Reader.ReadDocument(OutRoot))
+        {
+            if (OutError)
+            {
+                *OutError = std::move(Reader.Error);
+            }
+            OutRoot = FJsonNode();
+            return false;
+        }
+        return true;
+    }
+
+    bool CheckJsonLimits(std::string_view Text, const FJsonLimits &Limits, FJsonError *OutError)
+    {
+        auto Fail = [OutError](EJsonError Kind, size_t Offset, const std::string &Message)
+        {
+            if (OutError)
+            {
+                OutError->Kind = Kind;
+                OutError->Offset = Offset;
+                OutError->Message = Kind == EJsonError::DocumentTooLarge ? Message : Message + " at offset " + std::to_string(Offset);
+            }
+            return false;
+        };
+
+        if (Text.size() > Limits.MaxDocumentBytes)
+        {
+            return Fail(EJsonError::DocumentTooLarge, 0, "document of " + std::to_string(Text.size()) + " bytes exceeds the " + std::to_string(Limits.MaxDocumentBytes) + "-byte limit");
+        }
+
+        // Same accounting as FReader: raw bytes between the quotes, one level per '{' or '['.
+        int32_t Depth = 0;
+        for (size_t Pos = 0; Pos < Text.size(); ++Pos)
+        {
+            const char Ch = Text[Pos];
+            if (Ch == '"')
+            {
+                const size_t Start = ++Pos;
+                while (Pos < Text.size() && Text[Pos] != '"' && Pos - Start <= Limits.MaxStringBytes)
+                {
+                    Pos += Text[Pos] == '\\' ? 2 : 1;
+                }
+                if (std::min(Pos, Text.size()) - Start > Limits.MaxStringBytes)
+                {
+                    return Fail(EJsonError::StringTooLong, Pos, "string exceeds the " + std::to_string(Limits.MaxStringBytes) + "-byte limit");
+                }
+            }
+            else if (Ch == '{' || Ch == '[')
+            {
+                if (++Depth > Limits.MaxNesting)
+                {
+                    return Fail(EJsonError::NestingTooDeep, Pos, "nesting exceeds " + std::to_string(Limits.MaxNesting) + " levels");
+                }
+            }
+            else if ((Ch == '}' || Ch == ']') && Depth > 0)
+            {
+                --Depth;
+            }
+        }
+        return true;
+    }
+} // namespace MWCS_Core
@@ -0,0 +1,353 @@
+#include "MWCS_CoreLint.h"
+
+#include <cstdint>
+#include <cstdio>
+#include <initializer_list>
+#include <string>
+#include <unordered_set>
+#include <utility>
+
+namespace MWCS_Core
+{
+    namespace
+    {
+        const char *const GPanelTypes[] = {"CanvasPanel", "VerticalBox", "HorizontalBox", "Overlay", "ScrollBox", "WidgetSwitcher"};
+        const char *const GContentTypes[] = {"Border", "Button", "TransparentButton"};
+        const char *const GLeafTypes[] = {"TextBlock", "Image", "Spacer", "MultiLineEditableTextBox", "Throbber", "ComboBoxString",
+                                          "ProgressBar", "NativeWidgetHost", "UserWidget"};
+
+        template <size_t N>
+        bool IsOneOf(std::string_view Type, const char *const (&Types)[N])
+        {
+            for (const char *Candidate : Types)
+            {
+                if (EqualsIgnoreCase(Type, Candidate))
+                {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        // Names are FNames: compared case-insensitively.
+        std::string NameKey(std::string_view Name)
+        {
+            std::string Key(Name);
+            for (char &Ch : Key)
+            {
+                if (Ch >= 'A' && Ch <= 'Z')
+                {
+                    Ch = static_cast<char>(Ch - 'A' + 'a');
+                }
+            }
+            return Key;
+        }
+
+        std::string Format(const char *Pattern, const std::string &A, const std::string &B = std::string(), long long N = 0)
+        {
+            const int Needed = std::snprintf(nullptr, 0, Pattern, A.c_str(), B.c_str(), N);
+            std::string Out(static_cast<size_t>(Needed > 0 ? Needed : 0), '\0');
+            std::snprintf(&Out[0], Out.size() + 1, Pattern, A.c_str(), B.c_str(), N);
+            return Out;
+        }
+
+        std::string DisplayName(const FHierarchyNode &Node)
+        {
+            return Node.Name.empty() ? std::string("<unnamed>") : Node.Name;
+        }
+
+        struct FLintContext
+        {
+            const FWidgetSpec &Spec;
+            std::vector<FDiagnostic> &Out;
+            std::unordered_set<std::string> Names;
+            std::unordered_set<std::string> ReportedDuplicates;
+
+            void Add(ESeverity Severity, const char *Code, std::string Message)
+            {
+                Out.push_back(FDiagnostic{Severity, Code, std::move(Message)});
+            }
+
+            bool HasBindingType(const std::string &Name) const
+            {
+                for (const std::pair<std::string, std::string> &Pair : Spec.Bindings.Types)
+                {
+                    if (EqualsIgnoreCase(Pair.first, Name))
+                    {
+                        return true;
+                    }
+                }
+                return false;
+            }
+
+            void VisitNode(const FHierarchyNode &Node)
+            {
+                if (Node.Name.empty())
+                {
+                    Add(ESeverity::Warning, "Lint.UnnamedWidget", Format("%s widget has no Name.", Node.Type));
+                }
+                else
+                {
+                    const std::string Key = NameKey(Node.Name);
+                    if (!Names.insert(Key).second && ReportedDuplicates.insert(Key).second)
+                    {
+                        Add(ESeverity::Error, "Lint.DuplicateName", Format("Widget name '%s' is used by more than one widget.", Node.Name));
+                    }
+                }
+
+                if (!IsSupportedWidgetType(Node.Type))
+                {
+                    Add(ESeverity::Error, "Lint.UnknownType", Format("Widget '%s' has unsupported type '%s'.", DisplayName(Node), Node.Type));
+                }
+                else if (IsContentWidgetType(Node.Type) && Node.Children.size() > 1)
+                {
+                    Add(ESeverity::Error, "Lint.ChildrenNotAllowed",
+                        Format("%s '%s' holds a single child (%lld found).", Node.Type, DisplayName(Node), static_cast<long long>(Node.Children.size())));
+                }
+                else if (!IsPanelWidgetType(Node.Type) && !IsContentWidgetType(Node.Type) && !Node.Children.empty())
+                {
+                    Add(ESeverity::Error, "Lint.ChildrenNotAllowed",
+                        Format("%s '%s' cannot have children (%lld found).", Node.Type, DisplayName(Node), static_cast<long long>(Node.Children.size())));
+                }
+
+                if (EqualsIgnoreCase(Node.Type, "UserWidget") && Node.WidgetClassPath.empty() && (Node.Name.empty() || !HasBindingType(Node.Name)))
+                {
+                    Add(ESeverity::Warning, "Lint.UserWidget.MissingClass",
+                        Format("UserWidget '%s' has no WidgetClass and no Bindings type; it builds as a plain UUserWidget.", DisplayName(Node)));
+                }
+
+                for (const FHierarchyNode &Child : Node.Children)
+                {
+                    VisitNode(Child);
+                }
+            }
+        };
+
+        // Non-interactive types whose UMG default visibility is Visible (TextBlock and the panels default to SelfHitTestInvisible).
+        const char *const GHitTestableByDefaultTypes[] = {"Image", "Border", "Throbber", "ProgressBar"};
+
+        struct FPerfContext
+        {
+            const FWidgetSpec &Spec;
+            const FPerfLintOptions &Options;
+            std::vector<FDiagnostic> &Out;
+            std::unordered_set<std::string> Bound;
+            int64_t NumWidgets = 0;
+            int64_t NumVariables = 0;
+            int32_t MaxDepth = 0;
+            std::string DeepestName;
+
+            void Add(const FPerfRule &Rule, const char *Code, std::string Message)
+            {
+                Out.push_back(FDiagnostic{Rule.Severity, Code, std::move(Message)});
+            }
+
+            bool IsHitTestable(const FHierarchyNode &Node) const
+            {
+                for (const FDesignEntry &Entry : Spec.Design)
+                {
+                    std::string Visibility;
+                    if (EqualsIgnoreCase(Entry.Name, Node.Name) && Entry.Properties.TryGetStringField("Visibility", Visibility))
+                    {
+                        return EqualsIgnoreCase(Visibility, "Visible");
+                    }
+                }
+                return true;
+            }
+
+            void VisitNode(const FHierarchyNode &Node, int32_t Depth)
+            {
+                ++NumWidgets;
+                if (Depth > MaxDepth)
+                {
+                    MaxDepth = Depth;
+                    DeepestName = DisplayName(Node);
+                }
+                // The IsVariable default is true, so counting it would flag every large spec; only an explicit
+                // "IsVariable": true or a binding says code references the widget.
+                if ((Node.bHasIsVariable && Node.bIsVariable) || (!Node.Name.empty() && Bound.count(NameKey(Node.Name)) != 0))
+                {
+                    ++NumVariables;
+                }
+
+                if (Options.CanvasChildren.bEnabled && EqualsIgnoreCase(Node.Type, "CanvasPanel") && static_cast<int64_t>(Node.Children.size()) > Options.CanvasChildren.Budget)
+                {
+                    Add(Options.CanvasChildren, "Perf.CanvasChildren",
+                        Format("CanvasPanel '%s' has %s direct children; the budget is %lld. Group them under boxes or nested panels.",
+                               DisplayName(Node), std::to_string(Node.Children.size()), Options.CanvasChildren.Budget));
+                }
+                if (Options.HitTestable.bEnabled && IsOneOf(Node.Type, GHitTestableByDefaultTypes) && IsHitTestable(Node))
+                {
+                    Add(Options.HitTestable, "Perf.HitTestable",
+                        Format("%s '%s' is hit-tested (Visible) but takes no input; set Design \"Visibility\": \"HitTestInvisible\" unless it needs a tooltip or mouse events.",
+                               Node.Type, DisplayName(Node)));
+                }
+
+                for (const FHierarchyNode &Child : Node.Children)
+                {
+                    VisitNode(Child, Depth + 1);
+                }
+            }
+        };
+
+        // FSoftObjectPath-style: /Root/Path or /Root/Path.Object, no whitespace, backslashes or empty segments.
+        bool IsObjectPath(const std::string &Path)
+        {
+            if (Path.size() < 2 || Path[0] != '/' || Path.back() == '/' || Path.back() == '.')
+            {
+                return false;
+            }
+            for (size_t Index = 0; Index < Path.size(); ++Index)
+            {
+                const unsigned char Ch = static_cast<unsigned char>(Path[Index]);
+                if (Ch <= ' ' || Ch == '\\' || Ch == '"' || Ch == '\'' || (Ch == '/' && Index + 1 < Path.size() && Path[Index + 1] == '/'))
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+    } // namespace
+
+    bool IsPanelWidgetType(std::string_view Type)
+    {
+        return IsOneOf(Type, GPanelTypes);
+    }
+
+    bool IsContentWidgetType(std::string_view Type)
+    {
+        return IsOneOf(Type, GContentTypes);
+    }
+
+    FPerfRule *FPerfLintOptions::Find(std::string_view Rule)
+    {
+        std::pair<const char *, FPerfRule *> Rules[] = {
+            {"Depth", &Depth}, {"WidgetCount", &WidgetCount}, {"CanvasChildren", &CanvasChildren}, {"VariableCount", &VariableCount}, {"HitTestable", &HitTestable}};
+        for (const std::pair<const char *, FPerfRule *> &Pair : Rules)
+        {
+            if (EqualsIgnoreCase(Rule, Pair.first))
+            {
+                return Pair.second;
+            }
+        }
+        return nullptr;
+    }
+
+    bool FPerfLintOptions::ApplyOverrides(std::string_view List, std::string &OutError)
+    {
+        while (!List.empty())
+        {
+            const size_t Comma = List.find(',');
+            const std::string_view Entry = List.substr(0, Comma);
+            List = Comma == std::string_view::npos ? std::string_view() : List.substr(Comma + 1);
+            if (Entry.empty())
+            {
+                continue;
+            }
+
+            const size_t Colon = Entry.find(':');
+            FPerfRule *Rule = Find(Entry.substr(0, Colon));
+            if (!Rule || Colon == std::string_view::npos)
+            {
+                OutError = "expected <Rule>:<Budget|Severity|Off>, got '" + std::string(Entry) + "'";
+                return false;
+            }
+
+            std::string_view Rest = Entry.substr(Colon + 1);
+            while (!Rest.empty())
+            {
+                const size_t Next = Rest.find(':');
+                const std::string_view Value = Rest.substr(0, Next);
+                Rest = Next == std::string_view::npos ? std::string_view() : Rest.substr(Next + 1);
+
+                if (EqualsIgnoreCase(Value, "Off"))
+                {
+                    Rule->bEnabled = false;
+                }
+                else if (EqualsIgnoreCase(Value, "Info") || EqualsIgnoreCase(Value, "Warning") || EqualsIgnoreCase(Value, "Error"))
+                {
+                    Rule->bEnabled = true;
+                    Rule->Severity = EqualsIgnoreCase(Value, "Info") ? ESeverity::Info : EqualsIgnoreCase(Value, "Warning") ? ESeverity::Warning : ESeverity::Error;
+                }
+                else if (!Value.empty() && Value.size() < 10 && Value.find_first_not_of("0123456789") == std::string_view::npos)
+                {
+                    Rule->bEnabled = true;
+                    Rule->Budget = std::stoi(std::string(Value));
+                }
+                else
+                {
+                    OutError = "'" + std::string(Value) + "' in '" + std::string(Entry) + "' is not a budget, a severity or Off";
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+
+    bool IsSupportedWidgetType(std::string_view Type)
+    {
+        return IsPanelWidgetType(Type) || IsContentWidgetType(Type) || IsOneOf(Type, GLeafTypes);
+    }
+
+    void LintSpec(const FWidgetSpec &Spec, std::vector<FDiagnostic> &OutDiagnostics)
+    {
+        FLintContext Context{Spec, OutDiagnostics, {}, {}};
+        Context.VisitNode(Spec.HierarchyRoot);
+
+        for (const std::string &Required : Spec.Bindings.Required)
+        {
+            if (!Required.empty() && Context.Names.count(NameKey(Required)) == 0)
+            {
+                Context.Add(ESeverity::Warning, "Lint.Binding.NotInHierarchy", Format("Required binding '%s' has no widget of that name in the hierarchy.", Required));
+            }
+        }
+
+        for (const FDesignEntry &Entry : Spec.Design)
+        {
+            if (Context.Names.count(NameKey(Entry.Name)) == 0)
+            {
+                Context.Add(ESeverity::Warning, "Lint.Design.UnknownWidget", Format("Design entry '%s' does not match a widget in the hierarchy.", Entry.Name));
+            }
+        }
+
+        for (const std::string &Dependency : Spec.Dependencies)
+        {
+            if (!IsObjectPath(Dependency))
+            {
+                Context.Add(ESeverity::Warning, "Lint.Dependency.InvalidPath", Format("Dependency '%s' is not an object path (/Root/Path.Object).", Dependency));
+            }
+        }
+    }
+
+    void LintSpecPerformance(const FWidgetSpec &Spec, const FPerfLintOptions &Options, std::vector<FDiagnostic> &OutDiagnostics)
+    {
+        FPerfContext Context{Spec, Options, OutDiagnostics, {}, 0, 0, 0, {}};
+        for (const std::vector<std::string> *Names : {&Spec.Bindings.Required, &Spec.Bindings.Optional})
+        {
+            for (const std::string &Name : *Names)
+            {
+                Context.Bound.insert(NameKey(Name));
+            }
+        }
+        Context.VisitNode(Spec.HierarchyRoot, 1);
+
+        if (Options.Depth.bEnabled && Context.MaxDepth > Options.Depth.Budget)
+        {
+            Context.Add(Options.Depth, "Perf.Depth",
+                        Format("Hierarchy is %s widgets deep at '%s'; the budget is %lld. Flatten wrappers that only forward layout.",
+                               std::to_string(Context.MaxDepth), Context.DeepestName, Options.Depth.Budget));
+        }
+        if (Options.WidgetCount.bEnabled && Context.NumWidgets > Options.WidgetCount.Budget)
+        {
+            Context.Add(Options.WidgetCount, "Perf.WidgetCount",
+                        Format("Spec has %s widgets; the budget is %s. Split it into nested UserWidgets or virtualize long lists.",
+                               std::to_string(Context.NumWidgets), std::to_string(Options.WidgetCount.Budget)));
+        }
+        if (Options.VariableCount.bEnabled && Context.NumVariables > Options.VariableCount.Budget)
+        {
+            Context.Add(Options.VariableCount, "Perf.VariableCount",
+                        Format("%s widgets are variables; the budget is %s. Drop \"IsVariable\": true from widgets that code does not reference.",
+                               std::to_string(Context.NumVariables), std::to_string(Options.VariableCount.Budget)));
+        }
+    }
+} // namespace MWCS_Core
@@ -0,0 +1,437 @@
+#include "MWCS_CoreSpec.h"
+
+#include "MWCS_CoreCanonical.h"
+
+#include <algorithm>
+#include <climits>
+#include <cmath>
+#include <cstdio>
+#include <string_view>
+
+namespace MWCS_Core
+{
+    namespace
+    {
+        void AddDiagnostic(std::vector<FDiagnostic> &Out, ESeverity Severity, const char *Code, std::string Message)
+        {
+            Out.push_back(FDiagnostic{Severity, Code, std::move(Message)});
+        }
+
+        // static_cast<int32>(double) as the engine parser sees it on x64: out-of-range and NaN become INT_MIN.
+        int32_t ToInt32(double Value)
+        {
+            if (!(Value > static_cast<double>(INT_MIN) - 1.0 && Value < static_cast<double>(INT_MAX) + 1.0))
+            {
+                return INT_MIN;
+            }
+            return static_cast<int32_t>(Value);
+        }
+
+        // Widget count and depth caps for one hierarchy; Exceeded names the first limit hit.
+        struct FHierarchyBudget
+        {
+            const FSpecParseOptions &Options;
+            int32_t NumWidgets = 0;
+            const char *Exceeded = nullptr;
+        };
+
+        bool ParseHierarchyNode(const FJsonNode &NodeObj, FHierarchyNode &OutNode, FHierarchyBudget &Budget, int32_t Depth)
+        {
+            if (!NodeObj.IsObject() || !NodeObj.TryGetStringField("Type", OutNode.Type))
+            {
+                return false;
+            }
+            if (Depth > Budget.Options.MaxHierarchyDepth)
+            {
+                Budget.Exceeded = "Spec.Limit.HierarchyDepth";
+                return false;
+            }
+            if (++Budget.NumWidgets > Budget.Options.MaxWidgets)
+            {
+                Budget.Exceeded = "Spec.Limit.WidgetCount";
+                return false;
+            }
+
+            if (!NodeObj.TryGetStringField("Name", OutNode.Name))
+            {
+                OutNode.Name.clear();
+            }
+
+            // An omitted IsVariable keeps the default (true); BindWidget validation relies on it.
+            bool bIsVariable = false;
+            if (NodeObj.TryGetBoolField("IsVariable", bIsVariable))
+            {
+                OutNode.bIsVariable = bIsVariable;
+                OutNode.bHasIsVariable = true;
+            }
+
+            NodeObj.TryGetStringField("Text", OutNode.Text);
+            NodeObj.TryGetStringField("WidgetClass", OutNode.WidgetClassPath);
+
+            double FontSize = 0.0;
+            if (NodeObj.TryGetNumberField("FontSize", FontSize))
+            {
+                OutNode.FontSize = std::max<int32_t>(0, ToInt32(FontSize));
+            }
+
+            NodeObj.TryGetStringField("Justification", OutNode.Justification);
+
+            if (const FJsonNode *Children = NodeObj.TryGetArrayField("Children"))
+            {
+                for (const FJsonNode &ChildVal : Children->Array)
+                {
+                    if (!ChildVal.IsObject())
+                    {
+                        continue;
+                    }
+                    FHierarchyNode ChildNode;
+                    if (ParseHierarchyNode(ChildVal, ChildNode, Budget, Depth + 1))
+                    {
+                        OutNode.Children.push_back(std::move(ChildNode));
+                    }
+                    else if (Budget.Exceeded)
+                    {
+                        return false;
+                    }
+                }
+            }
+            return true;
+        }
+
+        bool ParseBindings(const FJsonNode &RootObj, FBindings &OutBindings)
+        {
+            const FJsonNode *BindingsObj = RootObj.TryGetObjectField("Bindings");
+            if (!BindingsObj)
+            {
+                return false;
+            }
+
+            auto ParseNames = [&OutBindings](const FJsonNode &Obj, const char *Field, std::vector<std::string> &OutArr)
+            {
+                const FJsonNode *Values = Obj.TryGetArrayField(Field);
+                if (!Values)
+                {
+                    return;
+                }
+                for (const FJsonNode &V : Values->Array)
+                {
+                    std::string S;
+                    if (V.TryGetString(S))
+                    {
+                        OutArr.push_back(std::move(S));
+                        continue;
+                    }
+                    std::string Name;
+                    if (V.IsObject() && V.TryGetStringField("Name", Name))
+                    {
+                        std::string Type;
+                        if (V.TryGetStringField("Type", Type) && !Type.empty())
+                        {
+                            auto Existing = std::find_if(OutBindings.Types.begin(), OutBindings.Types.end(), [&Name](const std::pair<std::string, std::string> &Pair)
+                                                         { return EqualsIgnoreCase(Pair.first, Name); });
+                            if (Existing != OutBindings.Types.end())
+                            {
+                                Existing->second = Type;
+                            }
+                            else
+                            {
+                                OutBindings.Types.emplace_back(Name, Type);
+                            }
+                        }
+                        OutArr.push_back(std::move(Name));
+                    }
+                }
+            };
+
+            ParseNames(*BindingsObj, "Required", OutBindings.Required);
+            ParseNames(*BindingsObj, "Optional", OutBindings.Optional);
+            return true;
+        }
+
+        bool ParseDesignerPreview(const FJsonNode &RootObj, FDesignerPreview &Out, std::vector<FDiagnostic> &OutDiagnostics, const FSpecParseOptions &Options)
+        {
+            Out = FDesignerPreview();
+
+            const FJsonNode *PreviewObj = RootObj.TryGetObjectField("DesignerPreview");
+            if (!PreviewObj)
+            {
+                return true;
+            }
+
+            std::string ModeStr;
+            if (PreviewObj->TryGetStringField("SizeMode", ModeStr))
+            {
+                if (EqualsIgnoreCase(ModeStr, "FillScreen") || EqualsIgnoreCase(ModeStr, "Fill Screen"))
+                    Out.SizeMode = EPreviewSizeMode::FillScreen;
+                else if (EqualsIgnoreCase(ModeStr, "Desired"))
+                    Out.SizeMode = EPreviewSizeMode::Desired;
+                else if (EqualsIgnoreCase(ModeStr, "DesiredOnScreen") || EqualsIgnoreCase(ModeStr, "Desired On Screen"))
+                    Out.SizeMode = EPreviewSizeMode::DesiredOnScreen;
+                else if (EqualsIgnoreCase(ModeStr, "Custom"))
+                    Out.SizeMode = EPreviewSizeMode::Custom;
+                else
+                    Out.SizeMode = EPreviewSizeMode::FillScreen;
+            }
+
+            if (const FJsonNode *SizeObj = PreviewObj->TryGetObjectField("CustomSize"))
+            {
+                double W = 0.0;
+                double H = 0.0;
+                const bool bHasW = SizeObj->TryGetNumberField("Width", W) || SizeObj->TryGetNumberField("X", W);
+                const bool bHasH = SizeObj->TryGetNumberField("Height", H) || SizeObj->TryGetNumberField("Y", H);
+                if (bHasW && bHasH)
+                {
+                    Out.CustomWidth = static_cast<float>(W);
+                    Out.CustomHeight = static_cast<float>(H);
+                }
+            }
+
+            // A number or a numeric string (FString::IsNumeric); anything else leaves the default.
+            double ZoomNumber = 0.0;
+            if (PreviewObj->TryGetNumberField("ZoomLevel", ZoomNumber))
+            {
+                const int32_t Zoom = ToInt32(ZoomNumber);
+                const int32_t Clamped = std::min(std::max(Zoom, Options.ZoomLevelMin), Options.ZoomLevelMax);
+                if (Clamped != Zoom)
+                {
+                    char Message[128];
+                    std::snprintf(Message, sizeof(Message), "ZoomLevel %d clamped to [%d, %d].", Zoom, Options.ZoomLevelMin, Options.ZoomLevelMax);
+                    AddDiagnostic(OutDiagnostics, ESeverity::Warning, "DesignerPreview.ZoomOutOfRange", Message);
+                }
+                Out.ZoomLevel = Clamped;
+            }
+
+            PreviewObj->TryGetBoolField("ShowGrid", Out.bShowGrid);
+
+            if (Out.SizeMode == EPreviewSizeMode::Custom && (Out.CustomWidth <= 0.0f || Out.CustomHeight <= 0.0f))
+            {
+                AddDiagnostic(OutDiagnostics, ESeverity::Error, "DesignerPreview.InvalidCustomSize", "Custom preview size must be positive when SizeMode is Custom.");
+                return false;
+            }
+            return true;
+        }
+
+        void ParseDesign(const FJsonNode &RootObj, std::vector<FDesignEntry> &OutDesign)
+        {
+            OutDesign.clear();
+            const FJsonNode *DesignObj = RootObj.TryGetObjectField("Design");
+            if (!DesignObj)
+            {
+                return;
+            }
+            for (const FJsonMember &KV : DesignObj->Object)
+            {
+                if (KV.Key.empty() || !KV.Value.IsObject())
+                {
+                    continue;
+                }
+                // "Design": { "WidgetName": { ... } } or { "WidgetName": { "Properties": { ... } } }
+                const FJsonNode *Props = KV.Value.TryGetObjectField("Properties");
+                OutDesign.push_back(FDesignEntry{KV.Key, Props ? *Props : KV.Value});
+            }
+        }
+
+        void ParseDependencies(const FJsonNode &RootObj, std::vector<std::string> &OutDeps)
+        {
+            OutDeps.clear();
+            const FJsonNode *DepsArr = RootObj.TryGetArrayField("Dependencies");
+            if (!DepsArr)
+            {
+                return;
+            }
+            for (const FJsonNode &V : DepsArr->Array)
+            {
+                std::string S;
+                if (V.TryGetString(S) && !S.empty())
+                {
+                    OutDeps.push_back(std::move(S));
+                }
+            }
+        }
+    } // namespace
+
+    const char *SeverityToString(ESeverity Severity)
+    {
+        switch (Severity)
+        {
+        case ESeverity::Warning:
+            return "Warning";
+        case ESeverity::Error:
+            return "Error";
+        default:
+            return "Info";
+        }
+    }
+
+    FJsonLimits FSpecParseOptions::GetJsonLimits() const
+    {
+        FJsonLimits Limits = Json;
+        // Widget -> "Children" array -> widget, plus the "Hierarchy"/"Root" wrappers and a { "Specs": [...] } file.
+        Limits.MaxNesting = std::max<int32_t>(Limits.MaxNesting, MaxHierarchyDepth > INT_MAX / 2 - 8 ? INT_MAX : MaxHierarchyDepth * 2 + 8);
+        return Limits;
+    }
+
+    FDiagnostic MakeJsonErrorDiagnostic(const FJsonError &Error)
+    {
+        switch (Error.Kind)
+        {
+        case EJsonError::DocumentTooLarge:
+            return FDiagnostic{ESeverity::Error, "Spec.Limit.DocumentSize", "JSON " + Error.Message + "."};
+        case EJsonError::NestingTooDeep:
+            return FDiagnostic{ESeverity::Error, "Spec.Limit.JsonNesting", "JSON " + Error.Message + "."};
+        case EJsonError::StringTooLong:
+            return FDiagnostic{ESeverity::Error, "Spec.Limit.StringLength", "JSON " + Error.Message + "."};
+        default:
+            return FDiagnostic{ESeverity::Error, "Spec.InvalidJson", "Failed to parse JSON."};
+        }
+    }
+
+    bool ParseSpec(std::string_view Json, FWidgetSpec &OutSpec, std::vector<FDiagnostic> &OutDiagnostics, const FSpecParseOptions &Options)
+    {
+        FJsonNode Root;
+        FJsonError Error;
+        if (!ParseJson(Json, Root, &Error, Options.GetJsonLimits()))
+        {
+            OutDiagnostics.push_back(MakeJsonErrorDiagnostic(Error));
+            return false;
+        }
+        if (!Root.IsObject())
+        {
+            AddDiagnostic(OutDiagnostics, ESeverity::Error, "Spec.InvalidJson", "Failed to parse JSON.");
+            return false;
+        }
+        return ParseSpec(Root, OutSpec, OutDiagnostics, Options);
+    }
+
+    bool ParseSpec(const FJsonNode &RootObj, FWidgetSpec &OutSpec, std::vector<FDiagnostic> &OutDiagnostics, const FSpecParseOptions &Options)
+    {
+        if (!RootObj.IsObject())
+        {
+            AddDiagnostic(OutDiagnostics, ESeverity::Error, "Spec.InvalidJson", "Failed to parse JSON.");
+            return false;
+        }
+
+        std::string BlueprintName;
+        std::string ParentClass;
+        std::string Version;
+
+        if (!RootObj.TryGetStringField("BlueprintName", BlueprintName))
+        {
+            AddDiagnostic(OutDiagnostics, ESeverity::Error, "Spec.MissingBlueprintName", "Missing required field: BlueprintName");
+            return false;
+        }
+        if (!RootObj.TryGetStringField("ParentClass", ParentClass))
+        {
+            AddDiagnostic(OutDiagnostics, ESeverity::Error, "Spec.MissingParentClass", "Missing required field: ParentClass");
+            return false;
+        }
+
+        bool bIsToolEUW = false;
+        RootObj.TryGetBoolField("IsToolEUW", bIsToolEUW);
+        OutSpec.bIsToolEUW = bIsToolEUW;
+
+        // Numbers read as strings too (SanitizeFloat), so Version 1 becomes "1".
+        if (!RootObj.TryGetStringField("Version", Version))
+        {
+            AddDiagnostic(OutDiagnostics, ESeverity::Error, "Spec.MissingVersion", "Missing required field: Version");
+            return false;
+        }
+
+        const FJsonNode *HierarchyObj = RootObj.TryGetObjectField("Hierarchy");
+        if (!HierarchyObj)
+        {
+            AddDiagnostic(OutDiagnostics, ESeverity::Error, "Spec.MissingHierarchy", "Missing required field: Hierarchy");
+            return false;
+        }
+
+        FBindings Bindings;
+        if (!ParseBindings(RootObj, Bindings))
+        {
+            AddDiagnostic(OutDiagnostics, ESeverity::Warning, "Spec.MissingBindings", "Bindings missing or invalid; continuing.");
+        }
+
+        // "Hierarchy": { "Type": ..., "Children": [...] } or "Hierarchy": { "Root": { "Type": ..., ... } }
+        const FJsonNode *HierarchyRootObj = HierarchyObj->TryGetObjectField("Root");
+        if (!HierarchyRootObj)
+        {
+            HierarchyRootObj = HierarchyObj;
+        }
+
+        FHierarchyNode RootNode;
+        FHierarchyBudget Budget{Options};
+        if (!ParseHierarchyNode(*HierarchyRootObj, RootNode, Budget, 1))
+        {
+            if (Budget.Exceeded)
+            {
+                const bool bDepth = std::string_view(Budget.Exceeded) == "Spec.Limit.HierarchyDepth";
+                char Message[128];
+                std::snprintf(Message, sizeof(Message), bDepth ? "Hierarchy is deeper than %d widgets." : "Hierarchy has more than %d widgets.",
+                              bDepth ? Options.MaxHierarchyDepth : Options.MaxWidgets);
+                AddDiagnostic(OutDiagnostics, ESeverity::Error, Budget.Exceeded, Message);
+            }
+            else
+            {
+                AddDiagnostic(OutDiagnostics, ESeverity::Error, "Spec.InvalidHierarchy", "Hierarchy root node is invalid.");
+            }
+            return false;
+        }
+
+        OutSpec.BlueprintName = std::move(BlueprintName);
+        OutSpec.ParentClassPath = std::move(ParentClass);
+        OutSpec.Version = std::move(Version);
+        OutSpec.SpecHash = SpecHash(RootObj);
+        if (!ParseDesignerPreview(RootObj, OutSpec.DesignerPreview, OutDiagnostics, Options))
+        {
+            return false;
+        }
+        OutSpec.HierarchyRoot = std::move(RootNode);
+        OutSpec.Bindings = std::move(Bindings);
+
+        ParseDesign(RootObj, OutSpec.Design);
+        ParseDependencies(RootObj, OutSpec.Dependencies);
+        return true;
+    }
+
+    void SplitSpecFile(std::string_view Text, std::vector<FJsonNode> &OutSpecs, std::vector<FDiagnostic> &OutDiagnostics, const FSpecParseOptions &Options)
+    {
+        FJsonNode Root;
+        FJsonError Error;
+        if (!ParseJson(Text, Root, &Error, Options.GetJsonLimits()))
+        {
+            OutDiagnostics.push_back(MakeJsonErrorDiagnostic(Error));
+            return;
+        }
+
+        const FJsonNode *Array = nullptr;
+        if (Root.IsObject())
+        {
+            Array = Root.TryGetArrayField("Specs");
+            if (!Array)
+            {
+                OutSpecs.push_back(std::move(Root));
+                return;
+            }
+        }
+        else if (Root.IsArray())
+        {
+            Array = &Root;
+        }
+
+        if (!Array)
+        {
+            AddDiagnostic(OutDiagnostics, ESeverity::Error, "SpecFile.UnsupportedShape", "Expected a spec object, an array of specs, or { \"Specs\": [...] }.");
+            return;
+        }
+
+        for (size_t Index = 0; Index < Array->Array.size(); ++Index)
+        {
+            const FJsonNode &Value = Array->Array[Index];
+            if (!Value.IsObject())
+            {
+                AddDiagnostic(OutDiagnostics, ESeverity::Error, "SpecFile.UnsupportedShape", "Entry " + std::to_string(Index) + " is not a spec object.");
+                continue;
+            }
+            OutSpecs.push_back(Value);
+        }
+    }
+} // namespace MWCS_Core
@@ -0,0 +1,4 @@
+// The only engine-dependent file of the core: everything else builds with a plain C++17 compiler (Tools/MWCSLint).
+#include "Modules/ModuleManager.h"
+
+IMPLEMENT_MODULE(FDefaultModuleImpl, P_MWCS_Core)
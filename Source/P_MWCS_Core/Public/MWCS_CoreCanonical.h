@@ -0,0 +1,30 @@
+#pragma once
+
+// Canonical JSON and spec hashing, byte-for-byte identical to FMWCS_CanonicalJsonWriter and FMWCS_WidgetSpec::SpecHash.
+
+#include "MWCS_CoreJson.h"
+
+#include <string>
+#include <string_view>
+
+namespace MWCS_Core
+{
+    // Keys sorted case-sensitively, duplicates collapsed (last value wins), numbers through FormatNumber.
+    // Pretty output indents with tabs and writes empty containers as {} / [].
+    P_MWCS_CORE_API std::string Canonicalize(const FJsonNode &Root, bool bPretty);
+
+    // False when Json does not parse.
+    P_MWCS_CORE_API bool CanonicalizeText(std::string_view Json, std::string &OutCanonical, bool bPretty);
+
+    // Integral values (within 5e-7) as integers, everything else with up to six decimals; non-finite values as 0.
+    P_MWCS_CORE_API std::string FormatNumber(double Value);
+
+    // Quoted JSON string with the writer's escapes (\" \\ \n \r \t \b \f, \u00XX for other control characters).
+    P_MWCS_CORE_API std::string QuoteString(std::string_view Value);
+
+    // Uppercase hex SHA-1, as FSHAHash::ToString().
+    P_MWCS_CORE_API std::string Sha1Hex(std::string_view Data);
+
+    // SHA-1 of the minified canonical form: the SpecHash recorded in the asset index.
+    P_MWCS_CORE_API std::string SpecHash(const FJsonNode &Root);
+} // namespace MWCS_Core
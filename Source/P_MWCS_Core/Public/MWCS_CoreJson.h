@@ -0,0 +1,107 @@
+#pragma once
+
+// Engine-free JSON DOM used by the MWCS core (std-only C++17; shared by the editor module and Tools/MWCSLint).
+// Lookups and conversions follow FJsonObject/FJsonValue so the core sees a spec exactly as FMWCS_SpecParser does.
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#ifndef P_MWCS_CORE_API
+#define P_MWCS_CORE_API
+#endif
+
+namespace MWCS_Core
+{
+    enum class EJsonType : uint8_t
+    {
+        Null,
+        Bool,
+        Number,
+        String,
+        Array,
+        Object
+    };
+
+    struct FJsonMember;
+
+    // Members are exported one by one: exporting the whole struct would instantiate std::vector<FJsonMember>
+    // before FJsonMember is complete.
+    struct FJsonNode
+    {
+        EJsonType Type = EJsonType::Null;
+        bool Bool = false;
+        double Number = 0.0;
+        std::string String; // UTF-8
+        std::vector<FJsonNode> Array;
+        std::vector<FJsonMember> Object; // document order
+
+        bool IsObject() const { return Type == EJsonType::Object; }
+        bool IsArray() const { return Type == EJsonType::Array; }
+
+        // Case-insensitive (ASCII), like FJsonObject's FString-keyed map. Null when absent or not an object.
+        P_MWCS_CORE_API const FJsonNode *Find(std::string_view Key) const;
+
+        // Adds a member, or replaces the key and value of an existing case-insensitive match in place.
+        P_MWCS_CORE_API void Set(std::string_view Key, FJsonNode &&Value);
+
+        // FJsonValue::TryGetString: strings, numbers (FString::SanitizeFloat(Value, 0)) and booleans ("true"/"false").
+        P_MWCS_CORE_API bool TryGetString(std::string &Out) const;
+
+        // FJsonValue::TryGetNumber: numbers, numeric strings (FString::IsNumeric) and booleans (1/0).
+        P_MWCS_CORE_API bool TryGetNumber(double &Out) const;
+
+        // FJsonValue::TryGetBool: booleans, numbers (!= 0) and strings (FString::ToBool).
+        P_MWCS_CORE_API bool TryGetBool(bool &Out) const;
+
+        // FJsonObject::TryGet*Field equivalents.
+        P_MWCS_CORE_API bool TryGetStringField(std::string_view Key, std::string &Out) const;
+        P_MWCS_CORE_API bool TryGetNumberField(std::string_view Key, double &Out) const;
+        P_MWCS_CORE_API bool TryGetBoolField(std::string_view Key, bool &Out) const;
+        P_MWCS_CORE_API const FJsonNode *TryGetObjectField(std::string_view Key) const;
+        P_MWCS_CORE_API const FJsonNode *TryGetArrayField(std::string_view Key) const;
+    };
+
+    struct FJsonMember
+    {
+        std::string Key;
+        FJsonNode Value;
+    };
+
+    // Hard caps that keep hostile or corrupted input from exhausting the stack or memory. The reader recurses once per
+    // object/array level, so MaxNesting bounds its stack use; string sizes are raw bytes between the quotes.
+    struct FJsonLimits
+    {
+        size_t MaxDocumentBytes = 64u * 1024u * 1024u;
+        int32_t MaxNesting = 256;
+        size_t MaxStringBytes = 1024u * 1024u;
+    };
+
+    enum class EJsonError : uint8_t
+    {
+        None,
+        Syntax,
+        DocumentTooLarge,
+        NestingTooDeep,
+        StringTooLong
+    };
+
+    struct FJsonError
+    {
+        EJsonError Kind = EJsonError::None;
+        size_t Offset = 0;
+        std::string Message; // "<message> at offset N" (no offset for DocumentTooLarge)
+    };
+
+    // Strict RFC 8259 reader (one value, surrounding whitespace only). \u escapes are decoded to UTF-8.
+    P_MWCS_CORE_API bool ParseJson(std::string_view Text, FJsonNode &OutRoot, FJsonError *OutError = nullptr, const FJsonLimits &Limits = FJsonLimits());
+
+    // Checks only the limits ParseJson enforces, in one pass and without building a DOM; syntax is not validated.
+    // For callers that hand the text to another reader (TJsonReader) and must reject pathological input first.
+    P_MWCS_CORE_API bool CheckJsonLimits(std::string_view Text, const FJsonLimits &Limits = FJsonLimits(), FJsonError *OutError = nullptr);
+
+    // ASCII case-insensitive equality, the comparison FName and FString map keys use for spec identifiers.
+    P_MWCS_CORE_API bool EqualsIgnoreCase(std::string_view A, std::string_view B);
+} // namespace MWCS_Core
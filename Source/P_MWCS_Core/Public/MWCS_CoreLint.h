@@ -0,0 +1,62 @@
+#pragma once
+
+// Structural checks that need only the parsed spec, so they run in pre-commit hooks as well as in the editor.
+//
+//   Lint.DuplicateName           (Error)   two widgets share a Name (the builder would reuse one widget for both)
+//   Lint.UnknownType             (Error)   Type the widget builder cannot construct
+//   Lint.ChildrenNotAllowed      (Error)   children under a leaf widget, or more than one under Border/Button
+//   Lint.UnnamedWidget           (Warning) widget without a Name; it cannot be bound, styled or validated by name
+//   Lint.Binding.NotInHierarchy  (Warning) Required binding with no widget of that name
+//   Lint.Design.UnknownWidget    (Warning) Design entry for a widget that is not in the hierarchy
+//   Lint.UserWidget.MissingClass (Warning) UserWidget with neither WidgetClass nor a Bindings type hint
+//   Lint.Dependency.InvalidPath  (Warning) Dependencies entry that is not a /Root/Path object path
+
+#include "MWCS_CoreSpec.h"
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace MWCS_Core
+{
+    P_MWCS_CORE_API void LintSpec(const FWidgetSpec &Spec, std::vector<FDiagnostic> &OutDiagnostics);
+
+    // Runtime-cost rules (LintSpecPerformance): every widget is a UObject plus SWidgets to construct, prepass and paint.
+    //
+    //   Perf.Depth          hierarchy deeper than Budget widgets (the root is depth 1)
+    //   Perf.WidgetCount    more than Budget widgets
+    //   Perf.CanvasChildren CanvasPanel with more than Budget direct children (one diagnostic per panel)
+    //   Perf.VariableCount  more than Budget widgets exposed as variables (explicit "IsVariable": true, or named in Bindings)
+    //   Perf.HitTestable    Image, Border, Throbber or ProgressBar left at the UMG default Visible, so it is hit-tested
+    //                       although it does not react to input (Design "Visibility" sets it; Budget is not used)
+    struct FPerfRule
+    {
+        bool bEnabled = true;
+        ESeverity Severity = ESeverity::Warning;
+        int32_t Budget = 0;
+    };
+
+    // Defaults match UMWCS_Settings (MWCS|Performance Lint).
+    struct FPerfLintOptions
+    {
+        FPerfRule Depth{true, ESeverity::Warning, 16};
+        FPerfRule WidgetCount{true, ESeverity::Warning, 500};
+        FPerfRule CanvasChildren{true, ESeverity::Warning, 32};
+        FPerfRule VariableCount{true, ESeverity::Warning, 48};
+        FPerfRule HitTestable{true, ESeverity::Info, 0};
+
+        // Rule by name ("Depth", "WidgetCount", "CanvasChildren", "VariableCount", "HitTestable"; case-insensitive).
+        P_MWCS_CORE_API FPerfRule *Find(std::string_view Rule);
+
+        // "Depth:12,WidgetCount:400:Error,HitTestable:Off": per rule, a budget and/or a severity (Info, Warning, Error),
+        // or Off. Shared by mwcslint -PerfRules= and MWCS_LintWidgets -Rules=. Returns false and names the bad entry.
+        P_MWCS_CORE_API bool ApplyOverrides(std::string_view List, std::string &OutError);
+    };
+
+    P_MWCS_CORE_API void LintSpecPerformance(const FWidgetSpec &Spec, const FPerfLintOptions &Options, std::vector<FDiagnostic> &OutDiagnostics);
+
+    // Widget types FMWCS_WidgetBuilder can construct (case-insensitive, like FName).
+    P_MWCS_CORE_API bool IsSupportedWidgetType(std::string_view Type);
+    P_MWCS_CORE_API bool IsPanelWidgetType(std::string_view Type);
+    P_MWCS_CORE_API bool IsContentWidgetType(std::string_view Type);
+} // namespace MWCS_Core
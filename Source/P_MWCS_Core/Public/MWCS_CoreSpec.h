@@ -0,0 +1,118 @@
+#pragma once
+
+// Engine-free spec model and parser. ParseSpec reports the same codes, messages and order as
+// FMWCS_SpecParser::ParseSpecJson, which takes its diagnostics from here.
+
+#include "MWCS_CoreJson.h"
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace MWCS_Core
+{
+    // Same order as EMWCS_IssueSeverity.
+    enum class ESeverity : uint8_t
+    {
+        Info,
+        Warning,
+        Error
+    };
+
+    struct FDiagnostic
+    {
+        ESeverity Severity = ESeverity::Info;
+        std::string Code;    // e.g. "Spec.MissingVersion"
+        std::string Message;
+    };
+
+    P_MWCS_CORE_API const char *SeverityToString(ESeverity Severity);
+
+    // Identifiers (Name, Type, binding names) keep their spelling; compare them with EqualsIgnoreCase, as FName does.
+    // Slot and Properties metadata stay in the JSON: they map onto UMG types and are read by the editor parser only.
+    struct FHierarchyNode
+    {
+        std::string Name; // empty = NAME_None
+        std::string Type;
+        bool bIsVariable = true;
+        bool bHasIsVariable = false; // IsVariable was written in the spec rather than defaulted
+        std::string Text;
+        std::string WidgetClassPath;
+        int32_t FontSize = 0;
+        std::string Justification;
+        std::vector<FHierarchyNode> Children;
+    };
+
+    enum class EPreviewSizeMode : uint8_t
+    {
+        FillScreen,
+        Desired,
+        DesiredOnScreen,
+        Custom,
+    };
+
+    struct FDesignerPreview
+    {
+        EPreviewSizeMode SizeMode = EPreviewSizeMode::FillScreen;
+        float CustomWidth = 0.0f;
+        float CustomHeight = 0.0f;
+        int32_t ZoomLevel = 14;
+        bool bShowGrid = true;
+    };
+
+    struct FBindings
+    {
+        std::vector<std::string> Required;
+        std::vector<std::string> Optional;
+        std::vector<std::pair<std::string, std::string>> Types; // name -> type hint, unique by name
+    };
+
+    struct FDesignEntry
+    {
+        std::string Name;
+        FJsonNode Properties; // "Properties" sub-object already unwrapped
+    };
+
+    struct FWidgetSpec
+    {
+        std::string BlueprintName;
+        std::string ParentClassPath;
+        std::string Version;
+        bool bIsToolEUW = false;
+        std::string SpecHash;
+        FDesignerPreview DesignerPreview;
+        FHierarchyNode HierarchyRoot;
+        FBindings Bindings;
+        std::vector<FDesignEntry> Design;
+        std::vector<std::string> Dependencies;
+    };
+
+    struct FSpecParseOptions
+    {
+        // UMWCS_Settings::DesignerZoomLevelMin/Max.
+        int32_t ZoomLevelMin = 0;
+        int32_t ZoomLevelMax = 20;
+
+        // UMWCS_Settings::MaxSpecHierarchyDepth/MaxSpecWidgets/MaxSpecStringBytes. Exceeding one is a Spec.Limit.* error.
+        // The root widget is depth 1. Json.MaxNesting is raised to fit MaxHierarchyDepth (two levels per widget).
+        int32_t MaxHierarchyDepth = 100;
+        int32_t MaxWidgets = 100000;
+        FJsonLimits Json;
+
+        P_MWCS_CORE_API FJsonLimits GetJsonLimits() const;
+    };
+
+    // Spec.InvalidJson for syntax errors; Spec.Limit.DocumentSize, Spec.Limit.JsonNesting or Spec.Limit.StringLength
+    // when the document is over FJsonLimits.
+    P_MWCS_CORE_API FDiagnostic MakeJsonErrorDiagnostic(const FJsonError &Error);
+
+    // Appends diagnostics; returns false on any error (the spec is then incomplete).
+    P_MWCS_CORE_API bool ParseSpec(std::string_view Json, FWidgetSpec &OutSpec, std::vector<FDiagnostic> &OutDiagnostics, const FSpecParseOptions &Options = FSpecParseOptions());
+    P_MWCS_CORE_API bool ParseSpec(const FJsonNode &Root, FWidgetSpec &OutSpec, std::vector<FDiagnostic> &OutDiagnostics, const FSpecParseOptions &Options = FSpecParseOptions());
+
+    // Splits a spec file the way FMWCS_FileSpecProvider does: one spec object, an array of specs, or { "Specs": [...] }.
+    // Adds Spec.InvalidJson, Spec.Limit.* and SpecFile.UnsupportedShape errors.
+    P_MWCS_CORE_API void SplitSpecFile(std::string_view Text, std::vector<FJsonNode> &OutSpecs, std::vector<FDiagnostic> &OutDiagnostics, const FSpecParseOptions &Options = FSpecParseOptions());
+} // namespace MWCS_Core
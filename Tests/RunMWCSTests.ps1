@@ -17,7 +17,9 @@ Which tests to run:
 - All: All test suites
 - Creation: Widget creation tests only
 - Extraction: Widget extraction tests only
-- RoundTrip: Full create->extract->validate cycle
+- RoundTrip: Build, extract and re-parse every Tests/TestSpecs spec (MWCS_RoundTrip)
+- Automation: MWCS.Parser/Builder/Validator/Generator automation tests
+- Benchmark: MWCS.Benchmark automation tests (not part of All)
 
 .EXAMPLE
 # Auto-detect, run all tests
@@ -33,7 +35,7 @@ Which tests to run:
 param(
     [string]$ProjectPath = $null,
     [string]$UEPath = $null,
-    [ValidateSet('All', 'Creation', 'Extraction', 'RoundTrip')]
+    [ValidateSet('All', 'Creation', 'Extraction', 'RoundTrip', 'Automation', 'Benchmark')]
     [string]$TestSuite = 'All'
 )
 
@@ -168,28 +170,43 @@ if ($TestSuite -eq 'All' -or $TestSuite -eq 'RoundTrip') {
     Write-TestLog "Running Round-Trip Tests..." -Level Info
     Write-TestLog "════════════════════════════════════════════════════════════════" -Level Info
     
-    # Round-trip: Create -> Validate
-    $rtCreateResult = Invoke-MWCSCreateWidgets -ProjectFile $ProjectFile -UEPath $UEPath -Mode Preserve
-    if ($rtCreateResult -eq 0) {
-        $rtValidateResult = Invoke-MWCSValidateWidgets -ProjectFile $ProjectFile -UEPath $UEPath
-        if ($rtValidateResult -eq 0) {
-            Write-TestLog "Round-Trip Tests PASSED" -Level Success
-            $testResults += "RoundTrip: PASS"
-        }
-        else {
-            Write-TestLog "Round-Trip Tests FAILED (validation)" -Level Error
-            $testResults += "RoundTrip: FAIL"
-            $allPassed = $false
-        }
+    # Round-trip: build -> extract -> re-parse -> compare, in one editor process
+    $rtResult = Invoke-MWCSRoundTrip -ProjectFile $ProjectFile -UEPath $UEPath
+    if ($rtResult -eq 0) {
+        Write-TestLog "Round-Trip Tests PASSED" -Level Success
+        $testResults += "RoundTrip: PASS"
     }
     else {
-        Write-TestLog "Round-Trip Tests FAILED (creation)" -Level Error
+        Write-TestLog "Round-Trip Tests FAILED" -Level Error
         $testResults += "RoundTrip: FAIL"
         $allPassed = $false
     }
     Write-Host ""
 }
 
+# Test 4: Automation (C++ unit tests) and benchmarks
+foreach ($suite in @('Automation', 'Benchmark')) {
+    if (!($TestSuite -eq $suite -or ($TestSuite -eq 'All' -and $suite -eq 'Automation'))) {
+        continue
+    }
+    Write-TestLog "════════════════════════════════════════════════════════════════" -Level Info
+    Write-TestLog "Running $suite Tests..." -Level Info
+    Write-TestLog "════════════════════════════════════════════════════════════════" -Level Info
+    
+    $filter = if ($suite -eq 'Benchmark') { 'MWCS.Benchmark' } else { 'MWCS.Parser+MWCS.Builder+MWCS.Validator+MWCS.Generator+MWCS.Core' }
+    $autoResult = Invoke-MWCSAutomationTests -ProjectFile $ProjectFile -UEPath $UEPath -Filter $filter
+    if ($autoResult -eq 0) {
+        Write-TestLog "$suite Tests PASSED" -Level Success
+        $testResults += "${suite}: PASS"
+    }
+    else {
+        Write-TestLog "$suite Tests FAILED" -Level Error
+        $testResults += "${suite}: FAIL"
+        $allPassed = $false
+    }
+    Write-Host ""
+}
+
 # ============================================
 # SUMMARY & EXIT
 # ============================================
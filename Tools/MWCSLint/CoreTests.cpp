@@ -0,0 +1,389 @@
+// Tests for the engine-free core. The editor-side parity test (MWCS.Core.MatchesSpecParser) checks the same
+// behaviour against FMWCS_SpecParser itself.
+
+#include "MWCS_CoreCanonical.h"
+#include "MWCS_CoreLint.h"
+#include "MWCS_CoreSpec.h"
+
+#include <cstdio>
+#include <string>
+#include <vector>
+
+using namespace MWCS_Core;
+
+static int GFailures = 0;
+
+#define MWCS_EXPECT(Condition, What)                                                \
+    do                                                                              \
+    {                                                                               \
+        if (!(Condition))                                                           \
+        {                                                                           \
+            std::fprintf(stderr, "%s:%d: FAILED: %s\n", __FILE__, __LINE__, What); \
+            ++GFailures;                                                            \
+        }                                                                           \
+    } while (0)
+
+static std::vector<std::string> Codes(const std::vector<FDiagnostic> &Diagnostics)
+{
+    std::vector<std::string> Out;
+    for (const FDiagnostic &Diagnostic : Diagnostics)
+    {
+        Out.push_back(Diagnostic.Code);
+    }
+    return Out;
+}
+
+static bool HasCode(const std::vector<FDiagnostic> &Diagnostics, const std::string &Code)
+{
+    for (const FDiagnostic &Diagnostic : Diagnostics)
+    {
+        if (Diagnostic.Code == Code)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+static void TestJsonReader()
+{
+    FJsonNode Root;
+    MWCS_EXPECT(ParseJson(R"( {"a": [1, 2.5, -3e2, true, null], "b": "xé😀\n"} )", Root), "valid document parses");
+    MWCS_EXPECT(Root.Find("A") && Root.Find("A")->Array.size() == 5, "lookups ignore case");
+    MWCS_EXPECT(Root.Find("a")->Array[2].Number == -300.0, "exponent");
+    MWCS_EXPECT(Root.Find("b")->String == "x\xC3\xA9\xF0\x9F\x98\x80\n", "escapes decode to UTF-8");
+
+    MWCS_EXPECT(!ParseJson("{\"a\": 1,}", Root), "trailing comma rejected");
+    MWCS_EXPECT(!ParseJson("{\"a\": 1} x", Root), "trailing input rejected");
+    MWCS_EXPECT(!ParseJson("", Root), "empty input rejected");
+    MWCS_EXPECT(!ParseJson("[01]", Root), "leading zero rejected");
+
+    // FJsonObject keys are case-insensitive: the later spelling and value replace the earlier one in place.
+    MWCS_EXPECT(ParseJson(R"({"Name": 1, "b": 2, "name": 3})", Root), "duplicates parse");
+    MWCS_EXPECT(Root.Object.size() == 2 && Root.Object[0].Key == "name" && Root.Object[0].Value.Number == 3.0, "duplicate collapsed in place");
+
+    std::string Text;
+    double Number = 0.0;
+    bool bValue = false;
+    MWCS_EXPECT(ParseJson(R"({"n": 1, "f": 1.5, "t": true, "s": "12.5", "bad": "1e3", "yes": "Yes", "o": {}})", Root), "conversions parse");
+    MWCS_EXPECT(Root.TryGetStringField("n", Text) && Text == "1", "number as string (SanitizeFloat)");
+    MWCS_EXPECT(Root.TryGetStringField("f", Text) && Text == "1.5", "fraction as string");
+    MWCS_EXPECT(Root.TryGetStringField("t", Text) && Text == "true", "bool as string");
+    MWCS_EXPECT(Root.TryGetNumberField("s", Number) && Number == 12.5, "numeric string as number");
+    MWCS_EXPECT(!Root.TryGetNumberField("bad", Number), "exponent string is not FString::IsNumeric");
+    MWCS_EXPECT(Root.TryGetNumberField("t", Number) && Number == 1.0, "bool as number");
+    MWCS_EXPECT(Root.TryGetBoolField("yes", bValue) && bValue, "FString::ToBool");
+    MWCS_EXPECT(!Root.TryGetStringField("o", Text), "object is not a string");
+    MWCS_EXPECT(!Root.TryGetObjectField("n") && Root.TryGetObjectField("o"), "typed object lookup");
+}
+
+static void TestCanonical()
+{
+    MWCS_EXPECT(FormatNumber(0.0) == "0", "zero");
+    MWCS_EXPECT(FormatNumber(-0.0000004) == "0", "near zero");
+    MWCS_EXPECT(FormatNumber(42.0000001) == "42", "near integer");
+    MWCS_EXPECT(FormatNumber(0.1) == "0.1", "fraction");
+    MWCS_EXPECT(FormatNumber(-2.25) == "-2.25", "negative fraction");
+    MWCS_EXPECT(FormatNumber(1.0 / 3.0) == "0.333333", "six decimals");
+    MWCS_EXPECT(FormatNumber(1e15) == "1000000000000000", "large values use %.6f");
+    MWCS_EXPECT(FormatNumber(1.0 / 0.0) == "0", "non-finite");
+
+    MWCS_EXPECT(QuoteString("a\"b\\c\n\x01/") == "\"a\\\"b\\\\c\\n\\u0001/\"", "escapes");
+
+    std::string Canonical;
+    MWCS_EXPECT(CanonicalizeText(R"({"b": [1.50, {}, []], "a": {"z": true, "B": null, "a": "x"}})", Canonical, false), "canonicalizes");
+    MWCS_EXPECT(Canonical == R"({"a":{"B":null,"a":"x","z":true},"b":[1.5,{},[]]})", "sorted, minified");
+
+    MWCS_EXPECT(CanonicalizeText(R"({"b": [1], "a": {}})", Canonical, true), "pretty canonicalizes");
+    MWCS_EXPECT(Canonical == "{\n\t\"a\": {},\n\t\"b\": [\n\t\t1\n\t]\n}", "tab indent, empty containers inline");
+
+    MWCS_EXPECT(Sha1Hex("") == "DA39A3EE5E6B4B0D3255BFEF95601890AFD80709", "SHA-1 of empty input");
+    MWCS_EXPECT(Sha1Hex("abc") == "A9993E364706816ABA3E25717850C26C9CD0D89D", "SHA-1 of abc");
+    MWCS_EXPECT(Sha1Hex(std::string(1000, 'a')) == "291E9A6C66994949B57BA5E650361E98FC36B1BA", "SHA-1 across blocks");
+
+    FJsonNode A;
+    FJsonNode B;
+    ParseJson(R"({"Version": "1", "Hierarchy": {"Type": "CanvasPanel"}})", A);
+    ParseJson("{\n  \"Hierarchy\" : { \"Type\" : \"CanvasPanel\" },\n  \"Version\" : \"1\"\n}", B);
+    MWCS_EXPECT(SpecHash(A) == SpecHash(B), "whitespace and key order do not change the hash");
+}
+
+static const char *const GValidSpec = R"({
+    "BlueprintName": "WBP_Core",
+    "ParentClass": "/Script/UMG.UserWidget",
+    "Version": 2,
+    "DesignerPreview": { "SizeMode": "Custom", "CustomSize": { "X": 800, "Y": 600 }, "ZoomLevel": "25" },
+    "Hierarchy": { "Root": {
+        "Type": "CanvasPanel", "Name": "Root",
+        "Children": [
+            { "Type": "Button", "Name": "Play", "Children": [ { "Type": "TextBlock", "Name": "PlayLabel", "Text": "Play", "FontSize": 24.9 } ] },
+            { "Name": "Untyped" },
+            { "Type": "UserWidget", "Name": "Card", "WidgetClass": "/Game/UI/WBP_Card.WBP_Card_C" }
+        ]
+    } },
+    "Bindings": { "Required": ["Play", { "Name": "Card", "Type": "UWBP_Card" }], "Optional": [] },
+    "Design": { "PlayLabel": { "Properties": { "Font": { "Size": 24 } } }, "Play": { "IsFocusable": true }, "": {}, "Skip": 3 },
+    "Dependencies": ["/Game/UI/WBP_Card", "", null]
+})";
+
+static void TestParseSpec()
+{
+    FWidgetSpec Spec;
+    std::vector<FDiagnostic> Diagnostics;
+    MWCS_EXPECT(ParseSpec(GValidSpec, Spec, Diagnostics), "valid spec parses");
+    MWCS_EXPECT(Codes(Diagnostics) == std::vector<std::string>{"DesignerPreview.ZoomOutOfRange"}, "only the zoom warning");
+    MWCS_EXPECT(!Diagnostics.empty() && Diagnostics[0].Message == "ZoomLevel 25 clamped to [0, 20].", "zoom message");
+    MWCS_EXPECT(Spec.DesignerPreview.ZoomLevel == 20, "zoom clamped");
+    MWCS_EXPECT(Spec.Version == "2", "numeric Version reads as a string");
+    MWCS_EXPECT(Spec.HierarchyRoot.Children.size() == 2, "untyped child skipped");
+    MWCS_EXPECT(Spec.HierarchyRoot.Children[0].Children[0].FontSize == 24, "font size truncates");
+    MWCS_EXPECT(Spec.Bindings.Required.size() == 2 && Spec.Bindings.Types.size() == 1, "bindings and type hints");
+    MWCS_EXPECT(Spec.Design.size() == 2 && Spec.Design[0].Name == "PlayLabel" && Spec.Design[0].Properties.Find("Font"), "design entries, Properties unwrapped");
+    MWCS_EXPECT((Spec.Dependencies == std::vector<std::string>{"/Game/UI/WBP_Card"}), "dependencies");
+    MWCS_EXPECT(Spec.SpecHash.size() == 40, "hash recorded");
+
+    FSpecParseOptions Wide;
+    Wide.ZoomLevelMax = 30;
+    Diagnostics.clear();
+    MWCS_EXPECT(ParseSpec(GValidSpec, Spec, Diagnostics, Wide) && Diagnostics.empty(), "zoom range comes from the options");
+
+    struct FCase
+    {
+        const char *Json;
+        std::vector<std::string> Codes;
+        bool bParses;
+    };
+    const FCase Cases[] = {
+        {R"({"BlueprintName": "WBP_X",)", {"Spec.InvalidJson"}, false},
+        {R"([])", {"Spec.InvalidJson"}, false},
+        {R"({"ParentClass":"/Script/UMG.UserWidget","Version":"1","Hierarchy":{"Type":"CanvasPanel"}})", {"Spec.MissingBlueprintName"}, false},
+        {R"({"BlueprintName":"WBP_X","Version":"1","Hierarchy":{"Type":"CanvasPanel"}})", {"Spec.MissingParentClass"}, false},
+        {R"({"BlueprintName":"WBP_X","ParentClass":"P","Hierarchy":{"Type":"CanvasPanel"}})", {"Spec.MissingVersion"}, false},
+        {R"({"BlueprintName":"WBP_X","ParentClass":"P","Version":null,"Hierarchy":{"Type":"CanvasPanel"}})", {"Spec.MissingVersion"}, false},
+        {R"({"BlueprintName":"WBP_X","ParentClass":"P","Version":"1","Hierarchy":[]})", {"Spec.MissingHierarchy"}, false},
+        {R"({"BlueprintName":"WBP_X","ParentClass":"P","Version":"1","Hierarchy":{"Root":{"Name":"NoType"}}})", {"Spec.MissingBindings", "Spec.InvalidHierarchy"}, false},
+        {R"({"BlueprintName":"WBP_X","ParentClass":"P","Version":"1","Hierarchy":{"Type":"CanvasPanel"},"DesignerPreview":{"SizeMode":"custom","ZoomLevel":-3}})",
+         {"Spec.MissingBindings", "DesignerPreview.ZoomOutOfRange", "DesignerPreview.InvalidCustomSize"}, false},
+        {R"({"BlueprintName":"WBP_X","ParentClass":"P","Version":"1","Hierarchy":{"Root":"Text","Type":"CanvasPanel"},"Bindings":{}})", {}, true},
+    };
+    for (const FCase &Case : Cases)
+    {
+        FWidgetSpec CaseSpec;
+        std::vector<FDiagnostic> CaseDiagnostics;
+        const bool bParsed = ParseSpec(Case.Json, CaseSpec, CaseDiagnostics);
+        MWCS_EXPECT(bParsed == Case.bParses, Case.Json);
+        MWCS_EXPECT(Codes(CaseDiagnostics) == Case.Codes, Case.Json);
+    }
+}
+
+static void TestSplitSpecFile()
+{
+    std::vector<FJsonNode> Specs;
+    std::vector<FDiagnostic> Diagnostics;
+    SplitSpecFile(R"({"BlueprintName": "A"})", Specs, Diagnostics);
+    MWCS_EXPECT(Specs.size() == 1 && Diagnostics.empty(), "single object");
+
+    Specs.clear();
+    SplitSpecFile(R"({"Specs": [{"BlueprintName": "A"}, 3, {"BlueprintName": "B"}]})", Specs, Diagnostics);
+    MWCS_EXPECT(Specs.size() == 2, "Specs array");
+    MWCS_EXPECT(Diagnostics.size() == 1 && Diagnostics[0].Code == "SpecFile.UnsupportedShape" && Diagnostics[0].Message == "Entry 1 is not a spec object.", "bad entry");
+
+    Specs.clear();
+    Diagnostics.clear();
+    SplitSpecFile(R"([{"BlueprintName": "A"}])", Specs, Diagnostics);
+    MWCS_EXPECT(Specs.size() == 1 && Diagnostics.empty(), "top-level array");
+
+    SplitSpecFile("\"text\"", Specs, Diagnostics);
+    MWCS_EXPECT(HasCode(Diagnostics, "SpecFile.UnsupportedShape"), "scalar root");
+    SplitSpecFile("{", Specs, Diagnostics);
+    MWCS_EXPECT(HasCode(Diagnostics, "Spec.InvalidJson"), "invalid file");
+}
+
+// Pathological inputs stop at a hard limit with a Spec.Limit.* error instead of exhausting the stack or memory.
+static void TestLimits()
+{
+    FJsonNode Root;
+    FJsonError Error;
+    const std::string DeepArray = std::string(100000, '[') + std::string(100000, ']');
+    MWCS_EXPECT(!ParseJson(DeepArray, Root, &Error) && Error.Kind == EJsonError::NestingTooDeep && Error.Offset == 256, "deep nesting stops at the limit");
+    MWCS_EXPECT(!CheckJsonLimits(DeepArray, FJsonLimits(), &Error) && Error.Kind == EJsonError::NestingTooDeep && Error.Offset == 256, "scan agrees on nesting");
+    MWCS_EXPECT(ParseJson(std::string(256, '[') + std::string(256, ']'), Root) && CheckJsonLimits(std::string(256, '[') + std::string(256, ']')), "nesting at the limit");
+
+    FJsonLimits Small;
+    Small.MaxStringBytes = 4;
+    MWCS_EXPECT(ParseJson(R"(["abcd", "\n\t"])", Root, nullptr, Small) && CheckJsonLimits(R"(["abcd", "\n\t"])", Small), "strings at the limit");
+    MWCS_EXPECT(!ParseJson(R"(["abcde"])", Root, &Error, Small) && Error.Kind == EJsonError::StringTooLong, "long string rejected");
+    MWCS_EXPECT(!ParseJson(R"({"abcde": 1})", Root, &Error, Small) && Error.Kind == EJsonError::StringTooLong, "long key rejected");
+    MWCS_EXPECT(!ParseJson(R"(["ab\u00e9"])", Root, &Error, Small) && Error.Kind == EJsonError::StringTooLong, "escapes count raw bytes");
+    MWCS_EXPECT(!CheckJsonLimits(R"(["ab\u00e9"])", Small, &Error) && Error.Kind == EJsonError::StringTooLong, "scan counts raw bytes");
+    MWCS_EXPECT(CheckJsonLimits(R"(["[[[[", "\"{{{{"])", FJsonLimits{1024, 1, 8}), "brackets inside strings do not nest");
+
+    Small.MaxDocumentBytes = 8;
+    MWCS_EXPECT(!ParseJson("[1, 2, 3, 4]", Root, &Error, Small) && Error.Kind == EJsonError::DocumentTooLarge, "document size");
+    MWCS_EXPECT(!ParseJson("[1, 2", Root, &Error) && Error.Kind == EJsonError::Syntax, "syntax errors keep their kind");
+
+    auto NestedSpec = [](int Depth)
+    {
+        std::string Json = R"({"BlueprintName":"WBP_Deep","ParentClass":"P","Version":"1","Bindings":{},"Hierarchy":)";
+        for (int Level = 0; Level < Depth; ++Level)
+        {
+            Json += Level + 1 < Depth ? R"({"Type":"Border","Children":[)" : R"({"Type":"Spacer")";
+        }
+        for (int Level = 0; Level < Depth; ++Level)
+        {
+            Json += Level > 0 ? "]}" : "}";
+        }
+        return Json + "}";
+    };
+    auto ParseCodes = [](const std::string &Json, const FSpecParseOptions &Options)
+    {
+        FWidgetSpec Spec;
+        std::vector<FDiagnostic> Diagnostics;
+        ParseSpec(Json, Spec, Diagnostics, Options);
+        return Codes(Diagnostics);
+    };
+
+    FSpecParseOptions Options;
+    MWCS_EXPECT(ParseCodes(NestedSpec(100), Options).empty(), "hierarchy at the depth limit");
+    MWCS_EXPECT(ParseCodes(NestedSpec(101), Options) == std::vector<std::string>{"Spec.Limit.HierarchyDepth"}, "hierarchy over the depth limit");
+    MWCS_EXPECT(ParseCodes(NestedSpec(5000), Options) == std::vector<std::string>{"Spec.Limit.JsonNesting"}, "far deeper input stops in the reader");
+
+    Options.MaxHierarchyDepth = 300;
+    MWCS_EXPECT(ParseCodes(NestedSpec(300), Options).empty(), "JSON nesting follows the hierarchy depth");
+
+    std::string Wide = R"({"BlueprintName":"WBP_Wide","ParentClass":"P","Version":"1","Bindings":{},"Hierarchy":{"Type":"VerticalBox","Children":[)";
+    for (int Index = 0; Index < 10; ++Index)
+    {
+        Wide += Index > 0 ? R"(,{"Type":"Spacer"})" : R"({"Type":"Spacer"})";
+    }
+    Wide += "]}}";
+    Options.MaxWidgets = 11;
+    MWCS_EXPECT(ParseCodes(Wide, Options).empty(), "widget count at the limit");
+    Options.MaxWidgets = 10;
+    const std::vector<std::string> WidgetCodes = ParseCodes(Wide, Options);
+    MWCS_EXPECT(WidgetCodes == std::vector<std::string>{"Spec.Limit.WidgetCount"}, "widget count over the limit");
+
+    Options = FSpecParseOptions();
+    Options.Json.MaxStringBytes = 16;
+    FWidgetSpec Spec;
+    std::vector<FDiagnostic> Diagnostics;
+    MWCS_EXPECT(!ParseSpec(R"({"BlueprintName":"WBP_0123456789ABCDEF"})", Spec, Diagnostics, Options), "long string fails the spec");
+    MWCS_EXPECT(Diagnostics.size() == 1 && Diagnostics[0].Code == "Spec.Limit.StringLength" && Diagnostics[0].Message == "JSON string exceeds the 16-byte limit at offset 35.",
+                "string limit message");
+
+    std::vector<FJsonNode> Specs;
+    Diagnostics.clear();
+    SplitSpecFile(DeepArray, Specs, Diagnostics);
+    MWCS_EXPECT(Specs.empty() && HasCode(Diagnostics, "Spec.Limit.JsonNesting"), "spec files are limited too");
+}
+
+static void TestLint()
+{
+    FWidgetSpec Spec;
+    std::vector<FDiagnostic> Diagnostics;
+    MWCS_EXPECT(ParseSpec(GValidSpec, Spec, Diagnostics), "valid spec parses");
+    Diagnostics.clear();
+    LintSpec(Spec, Diagnostics);
+    MWCS_EXPECT(Diagnostics.empty(), "valid spec lints clean");
+
+    const char *const Dirty = R"({
+        "BlueprintName": "WBP_Dirty", "ParentClass": "P", "Version": "1",
+        "Hierarchy": { "Type": "VerticalBox", "Name": "Root", "Children": [
+            { "Type": "TextBlock", "Name": "Label", "Children": [ { "Type": "Image", "Name": "Icon" } ] },
+            { "Type": "Border", "Name": "Frame", "Children": [ { "Type": "Spacer", "Name": "A" }, { "Type": "Spacer", "Name": "B" } ] },
+            { "Type": "textblock", "Name": "label" },
+            { "Type": "Slider", "Name": "Volume" },
+            { "Type": "UserWidget", "Name": "Card" },
+            { "Type": "Image" }
+        ] },
+        "Bindings": { "Required": ["Label", "Missing"] },
+        "Design": { "Ghost": { "Color": 1 } },
+        "Dependencies": ["/Game/UI/T_Icon.T_Icon", "Game/NoSlash", "/Game/With Space"]
+    })";
+    MWCS_EXPECT(ParseSpec(Dirty, Spec, Diagnostics), "dirty spec parses");
+    Diagnostics.clear();
+    LintSpec(Spec, Diagnostics);
+    const std::vector<std::string> Expected = {
+        "Lint.ChildrenNotAllowed",        // Label has a child
+        "Lint.ChildrenNotAllowed",        // Frame has two
+        "Lint.DuplicateName",             // label (FName compare)
+        "Lint.UnknownType",               // Slider
+        "Lint.UserWidget.MissingClass",   // Card
+        "Lint.UnnamedWidget",             // Image
+        "Lint.Binding.NotInHierarchy",    // Missing
+        "Lint.Design.UnknownWidget",      // Ghost
+        "Lint.Dependency.InvalidPath",    // Game/NoSlash
+        "Lint.Dependency.InvalidPath",    // With Space
+    };
+    MWCS_EXPECT(Codes(Diagnostics) == Expected, "lint codes in order");
+
+    MWCS_EXPECT(IsSupportedWidgetType("throbber") && !IsSupportedWidgetType("Slider"), "type table");
+}
+
+static void TestPerfLint()
+{
+    const char *const Json = R"({
+        "BlueprintName": "WBP_Heavy", "ParentClass": "P", "Version": "1",
+        "Hierarchy": { "Type": "CanvasPanel", "Name": "Root", "IsVariable": false, "Children": [
+            { "Type": "Image", "Name": "Bg", "IsVariable": false },
+            { "Type": "Border", "Name": "Frame", "IsVariable": false, "Children": [
+                { "Type": "VerticalBox", "Name": "Column", "IsVariable": false, "Children": [
+                    { "Type": "TextBlock", "Name": "Title", "IsVariable": true }, { "Type": "Image", "Name": "Icon" } ] } ] },
+            { "Type": "Button", "Name": "Ok", "IsVariable": false }
+        ] },
+        "Bindings": { "Optional": ["Ok"] },
+        "Design": { "Bg": { "Visibility": "HitTestInvisible" }, "Frame": { "Visibility": "visible" } }
+    })";
+    FWidgetSpec Spec;
+    std::vector<FDiagnostic> Diagnostics;
+    MWCS_EXPECT(ParseSpec(Json, Spec, Diagnostics), "heavy spec parses");
+    Diagnostics.clear();
+
+    LintSpecPerformance(Spec, FPerfLintOptions(), Diagnostics);
+    MWCS_EXPECT(Codes(Diagnostics) == std::vector<std::string>({"Perf.HitTestable", "Perf.HitTestable"}), "defaults: only Frame and Icon");
+    MWCS_EXPECT(!Diagnostics.empty() && Diagnostics[0].Severity == ESeverity::Info, "HitTestable defaults to Info");
+
+    FPerfLintOptions Tight;
+    Tight.Depth.Budget = 3;
+    Tight.WidgetCount.Budget = 6;
+    Tight.CanvasChildren.Budget = 2;
+    Tight.CanvasChildren.Severity = ESeverity::Error;
+    Tight.VariableCount.Budget = 1;
+    Tight.Find("hittestable")->bEnabled = false;
+    MWCS_EXPECT(Tight.Find("Unknown") == nullptr, "unknown rule");
+    Diagnostics.clear();
+    LintSpecPerformance(Spec, Tight, Diagnostics);
+    const std::vector<std::string> Expected = {"Perf.CanvasChildren", "Perf.Depth", "Perf.WidgetCount", "Perf.VariableCount"};
+    MWCS_EXPECT(Codes(Diagnostics) == Expected, "budget codes in order");
+    MWCS_EXPECT(Diagnostics.size() == 4 && Diagnostics[0].Severity == ESeverity::Error && Diagnostics[1].Severity == ESeverity::Warning, "per-rule severity");
+    MWCS_EXPECT(Diagnostics.size() == 4 && Diagnostics[1].Message.find("4 widgets deep at 'Title'") != std::string::npos, "deepest widget named");
+    // Title (explicit IsVariable) and Ok through Bindings; Icon only has the default IsVariable and is not counted.
+    MWCS_EXPECT(Diagnostics.size() == 4 && Diagnostics[3].Message.find("2 widgets are variables") == 0, "variables counted");
+
+    Tight.Depth.Budget = 4;
+    Tight.WidgetCount.Budget = 7;
+    Tight.CanvasChildren.Budget = 3;
+    Tight.VariableCount.Budget = 2;
+    Diagnostics.clear();
+    LintSpecPerformance(Spec, Tight, Diagnostics);
+    MWCS_EXPECT(Diagnostics.empty(), "budgets are inclusive");
+}
+
+int main()
+{
+    TestJsonReader();
+    TestCanonical();
+    TestParseSpec();
+    TestSplitSpecFile();
+    TestLimits();
+    TestLint();
+    TestPerfLint();
+
+    if (GFailures > 0)
+    {
+        std::fprintf(stderr, "%d failure(s)\n", GFailures);
+        return 1;
+    }
+    std::printf("MWCS core tests passed\n");
+    return 0;
+}
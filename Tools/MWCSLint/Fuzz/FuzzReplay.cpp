@@ -0,0 +1,65 @@
+// Replays inputs through LLVMFuzzerTestOneInput for toolchains without libFuzzer (and as a ctest over the seed corpus).
+//
+//   mwcs_fuzz_replay <file|dir>...
+//
+// Directories are searched recursively; every regular file is one input. Exit code 64 on bad arguments or unreadable
+// inputs; a failed check aborts.
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t *Data, size_t Size);
+
+int main(int Argc, char **Argv)
+{
+    if (Argc < 2)
+    {
+        std::fprintf(stderr, "usage: mwcs_fuzz_replay <file|dir>...\n");
+        return 64;
+    }
+
+    std::vector<fs::path> Files;
+    for (int Index = 1; Index < Argc; ++Index)
+    {
+        std::error_code Error;
+        if (fs::is_directory(Argv[Index], Error))
+        {
+            for (fs::recursive_directory_iterator It(Argv[Index], Error), End; !Error && It != End; It.increment(Error))
+            {
+                if (It->is_regular_file(Error))
+                {
+                    Files.push_back(It->path());
+                }
+            }
+        }
+        else if (fs::is_regular_file(Argv[Index], Error))
+        {
+            Files.emplace_back(Argv[Index]);
+        }
+        else
+        {
+            std::fprintf(stderr, "mwcs_fuzz_replay: cannot read %s\n", Argv[Index]);
+            return 64;
+        }
+    }
+    std::sort(Files.begin(), Files.end());
+
+    for (const fs::path &File : Files)
+    {
+        std::ifstream Stream(File, std::ios::binary);
+        const std::string Input((std::istreambuf_iterator<char>(Stream)), std::istreambuf_iterator<char>());
+        std::printf("%s\n", File.generic_string().c_str());
+        std::fflush(stdout);
+        LLVMFuzzerTestOneInput(reinterpret_cast<const uint8_t *>(Input.data()), Input.size());
+    }
+    std::printf("Replayed %zu input(s)\n", Files.size());
+    return 0;
+}
@@ -0,0 +1,78 @@
+// libFuzzer target for the spec parser. MWCS_Core::ParseSpec runs first inside FMWCS_SpecParser::ParseSpecJson and
+// rejects anything over the parse limits before the engine reader sees it, so fuzzing the core covers the editor path.
+//
+//   cmake -S Tools/MWCSLint -B Build/MWCSFuzz -DCMAKE_CXX_COMPILER=clang++ -DMWCS_BUILD_FUZZER=ON
+//   cmake --build Build/MWCSFuzz --target mwcs_fuzz_spec_parser
+//   Build/MWCSFuzz/mwcs_fuzz_spec_parser -dict=Tools/MWCSLint/Fuzz/spec.dict Build/MWCSFuzz/Corpus Tests/TestSpecs Tools/MWCSLint/Fuzz/Corpus
+//
+// Without -DMWCS_BUILD_FUZZER the same entry point is linked with FuzzReplay.cpp, which replays files and directories
+// once (ctest MWCSFuzz.SeedCorpus). Crashes, sanitizer reports and failed checks below are findings.
+
+#include "MWCS_CoreCanonical.h"
+#include "MWCS_CoreLint.h"
+#include "MWCS_CoreSpec.h"
+
+#include <climits>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace MWCS_Core;
+
+namespace
+{
+    void Check(bool bOk, const char *Expression, int Line)
+    {
+        if (!bOk)
+        {
+            std::fprintf(stderr, "FuzzSpecParser.cpp:%d: check failed: %s\n", Line, Expression);
+            std::abort();
+        }
+    }
+} // namespace
+
+#define MWCS_FUZZ_CHECK(Expr) Check((Expr), #Expr, __LINE__)
+
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t *Data, size_t Size)
+{
+    const std::string_view Text(reinterpret_cast<const char *>(Data), Size);
+
+    // The one-pass scan guards TJsonReader in FMWCS_FileSpecProvider: it must agree with the reader on every limit.
+    FJsonNode Root;
+    FJsonError Error;
+    const bool bParsed = ParseJson(Text, Root, &Error);
+    const bool bWithinLimits = CheckJsonLimits(Text);
+    MWCS_FUZZ_CHECK(!bParsed || bWithinLimits);
+    MWCS_FUZZ_CHECK(bParsed || Error.Kind == EJsonError::Syntax || !bWithinLimits);
+
+    if (bParsed)
+    {
+        // Canonical form is a fixed point: SpecHash must not depend on how the document was written. Escaping can grow
+        // strings past the default cap, so the re-read is only limited in depth (already proven by the first read).
+        const std::string Canonical = Canonicalize(Root, /*bPretty*/ false);
+        FJsonNode Reparsed;
+        MWCS_FUZZ_CHECK(ParseJson(Canonical, Reparsed, nullptr, FJsonLimits{SIZE_MAX, INT_MAX, SIZE_MAX}));
+        MWCS_FUZZ_CHECK(Canonicalize(Reparsed, /*bPretty*/ false) == Canonical);
+    }
+
+    std::vector<FJsonNode> Specs;
+    std::vector<FDiagnostic> Diagnostics;
+    SplitSpecFile(Text, Specs, Diagnostics);
+    for (const FJsonNode &SpecJson : Specs)
+    {
+        FWidgetSpec Spec;
+        if (ParseSpec(SpecJson, Spec, Diagnostics))
+        {
+            MWCS_FUZZ_CHECK(Spec.SpecHash.size() == 40);
+            LintSpec(Spec, Diagnostics);
+        }
+    }
+    for (const FDiagnostic &Diagnostic : Diagnostics)
+    {
+        MWCS_FUZZ_CHECK(!Diagnostic.Code.empty() && !Diagnostic.Message.empty());
+    }
+    return 0;
+}
@@ -0,0 +1,321 @@
+// mwcslint: lints MWCS spec files without the editor, with the same diagnostics as FMWCS_SpecParser.
+//
+//   mwcslint [-FailOnErrors] [-FailOnWarnings] [-NoLint] [-ZoomMin=N] [-ZoomMax=N] [-MaxDepth=N] [-MaxWidgets=N]
+//            [-MaxStringBytes=N] [-Perf] [-PerfRules=Rule:Budget:Severity,...] [-Out=report.json] <file|dir>...
+//
+// Directories are searched recursively for *.json, and files are split like FMWCS_FileSpecProvider does.
+// -Perf adds the Perf.* runtime-cost rules (MWCS_LintWidgets); -PerfRules= implies it.
+// Lines match the commandlet log ("MWCS[Code] Context | Message"); -Out writes an MWCS report JSON.
+// Exit code: 1 with -FailOnErrors and errors, 2 with -FailOnWarnings and warnings, 64 on bad arguments.
+
+#include "MWCS_CoreCanonical.h"
+#include "MWCS_CoreLint.h"
+#include "MWCS_CoreSpec.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace fs = std::filesystem;
+using namespace MWCS_Core;
+
+namespace
+{
+    struct FIssue
+    {
+        ESeverity Severity;
+        std::string Code;
+        std::string Message;
+        std::string Context;
+    };
+
+    struct FOptions
+    {
+        bool bFailOnErrors = false;
+        bool bFailOnWarnings = false;
+        bool bLint = true;
+        bool bPerf = false;
+        FSpecParseOptions Parse;
+        FPerfLintOptions Perf;
+        std::string OutPath;
+        std::vector<std::string> Inputs;
+    };
+
+    bool StartsWithIgnoreCase(const std::string &Text, const char *Prefix)
+    {
+        const size_t Len = std::strlen(Prefix);
+        return Text.size() >= Len && EqualsIgnoreCase(std::string_view(Text).substr(0, Len), Prefix);
+    }
+
+    bool ParseArgs(int Argc, char **Argv, FOptions &Out)
+    {
+        for (int Index = 1; Index < Argc; ++Index)
+        {
+            const std::string Arg = Argv[Index];
+            if (EqualsIgnoreCase(Arg, "-FailOnErrors"))
+                Out.bFailOnErrors = true;
+            else if (EqualsIgnoreCase(Arg, "-FailOnWarnings"))
+                Out.bFailOnWarnings = true;
+            else if (EqualsIgnoreCase(Arg, "-NoLint"))
+                Out.bLint = false;
+            else if (StartsWithIgnoreCase(Arg, "-ZoomMin="))
+                Out.Parse.ZoomLevelMin = std::atoi(Arg.c_str() + 9);
+            else if (StartsWithIgnoreCase(Arg, "-ZoomMax="))
+                Out.Parse.ZoomLevelMax = std::atoi(Arg.c_str() + 9);
+            else if (StartsWithIgnoreCase(Arg, "-MaxDepth="))
+                Out.Parse.MaxHierarchyDepth = std::max(1, std::atoi(Arg.c_str() + 10));
+            else if (StartsWithIgnoreCase(Arg, "-MaxWidgets="))
+                Out.Parse.MaxWidgets = std::max(1, std::atoi(Arg.c_str() + 12));
+            else if (StartsWithIgnoreCase(Arg, "-MaxStringBytes="))
+                Out.Parse.Json.MaxStringBytes = static_cast<size_t>(std::max(1, std::atoi(Arg.c_str() + 16)));
+            else if (EqualsIgnoreCase(Arg, "-Perf"))
+                Out.bPerf = true;
+            else if (StartsWithIgnoreCase(Arg, "-PerfRules="))
+            {
+                std::string Error;
+                if (!Out.Perf.ApplyOverrides(std::string_view(Arg).substr(11), Error))
+                {
+                    std::fprintf(stderr, "mwcslint: -PerfRules: %s\n", Error.c_str());
+                    return false;
+                }
+                Out.bPerf = true;
+            }
+            else if (StartsWithIgnoreCase(Arg, "-Out="))
+                Out.OutPath = Arg.substr(5);
+            else if (!Arg.empty() && Arg[0] == '-')
+            {
+                std::fprintf(stderr, "mwcslint: unknown option %s\n", Arg.c_str());
+                return false;
+            }
+            else
+                Out.Inputs.push_back(Arg);
+        }
+        if (Out.Inputs.empty())
+        {
+            std::fprintf(stderr, "usage: mwcslint [-FailOnErrors] [-FailOnWarnings] [-NoLint] [-ZoomMin=N] [-ZoomMax=N] [-MaxDepth=N] [-MaxWidgets=N] [-MaxStringBytes=N] [-Perf] [-PerfRules=Rule:Budget:Severity,...] [-Out=report.json] <file|dir>...\n");
+            return false;
+        }
+        return true;
+    }
+
+    // FMWCS_FileSpecProvider::NormalizePath: absolute, forward slashes, no . or .. segments.
+    std::string NormalizePath(const fs::path &Path)
+    {
+        std::error_code Error;
+        const fs::path Absolute = fs::absolute(Path, Error);
+        return (Error ? Path : Absolute).lexically_normal().generic_string();
+    }
+
+    bool LessIgnoreCase(const std::string &A, const std::string &B)
+    {
+        return std::lexicographical_compare(A.begin(), A.end(), B.begin(), B.end(), [](char X, char Y)
+                                            { return std::tolower(static_cast<unsigned char>(X)) < std::tolower(static_cast<unsigned char>(Y)); });
+    }
+
+    void CollectFiles(const std::vector<std::string> &Inputs, std::vector<std::string> &OutFiles, std::vector<FIssue> &OutIssues)
+    {
+        for (const std::string &Input : Inputs)
+        {
+            std::error_code Error;
+            if (fs::is_directory(Input, Error))
+            {
+                for (fs::recursive_directory_iterator It(Input, Error), End; !Error && It != End; It.increment(Error))
+                {
+                    if (It->is_regular_file(Error) && EqualsIgnoreCase(It->path().extension().string(), ".json"))
+                    {
+                        OutFiles.push_back(NormalizePath(It->path()));
+                    }
+                }
+            }
+            else if (fs::exists(Input, Error))
+            {
+                OutFiles.push_back(NormalizePath(Input));
+            }
+            else
+            {
+                OutIssues.push_back(FIssue{ESeverity::Error, "SpecFile.ReadFailed", "Failed to read spec file.", NormalizePath(Input)});
+            }
+        }
+        // Deterministic order regardless of file system enumeration (FString sorts case-insensitively).
+        std::sort(OutFiles.begin(), OutFiles.end(), LessIgnoreCase);
+        OutFiles.erase(std::unique(OutFiles.begin(), OutFiles.end()), OutFiles.end());
+    }
+
+    bool ReadFile(const std::string &Path, std::string &Out)
+    {
+        std::ifstream Stream(Path, std::ios::binary);
+        if (!Stream)
+        {
+            return false;
+        }
+        std::ostringstream Buffer;
+        Buffer << Stream.rdbuf();
+        Out = Buffer.str();
+        // FFileHelper::LoadFileToString drops the UTF-8 byte order mark.
+        if (Out.size() >= 3 && static_cast<unsigned char>(Out[0]) == 0xEF && static_cast<unsigned char>(Out[1]) == 0xBB && static_cast<unsigned char>(Out[2]) == 0xBF)
+        {
+            Out.erase(0, 3);
+        }
+        return true;
+    }
+
+    struct FFileResult
+    {
+        int SpecsProcessed = 0;
+        std::vector<FIssue> Issues;
+    };
+
+    void LintFile(const std::string &File, const FOptions &Options, FFileResult &Out)
+    {
+        std::vector<FDiagnostic> Diagnostics;
+        auto Emit = [&Out, &Diagnostics, &File]()
+        {
+            for (FDiagnostic &Diagnostic : Diagnostics)
+            {
+                Out.Issues.push_back(FIssue{Diagnostic.Severity, std::move(Diagnostic.Code), std::move(Diagnostic.Message), File});
+            }
+            Diagnostics.clear();
+        };
+
+        std::string Text;
+        if (!ReadFile(File, Text))
+        {
+            Out.Issues.push_back(FIssue{ESeverity::Error, "SpecFile.ReadFailed", "Failed to read spec file.", File});
+            return;
+        }
+
+        std::vector<FJsonNode> Specs;
+        SplitSpecFile(Text, Specs, Diagnostics, Options.Parse);
+        Emit();
+
+        for (const FJsonNode &SpecJson : Specs)
+        {
+            FWidgetSpec Spec;
+            if (ParseSpec(SpecJson, Spec, Diagnostics, Options.Parse))
+            {
+                ++Out.SpecsProcessed;
+                if (Options.bLint)
+                {
+                    LintSpec(Spec, Diagnostics);
+                }
+                if (Options.bPerf)
+                {
+                    LintSpecPerformance(Spec, Options.Perf, Diagnostics);
+                }
+            }
+            Emit();
+        }
+    }
+
+    void WriteReport(const std::string &Path, int SpecsProcessed, int Errors, int Warnings, const std::vector<FIssue> &Issues)
+    {
+        // Same fields and order as MWCS_ReportJson::ToJsonString.
+        std::string Json = "{\n";
+        Json += "\t\"SpecsProcessed\": " + std::to_string(SpecsProcessed) + ",\n";
+        Json += "\t\"AssetsCreated\": 0,\n\t\"AssetsRepaired\": 0,\n\t\"AssetsRecreated\": 0,\n";
+        Json += "\t\"Errors\": " + std::to_string(Errors) + ",\n";
+        Json += "\t\"Warnings\": " + std::to_string(Warnings) + ",\n";
+        Json += "\t\"Issues\": [";
+        for (size_t Index = 0; Index < Issues.size(); ++Index)
+        {
+            const FIssue &Issue = Issues[Index];
+            Json += Index > 0 ? ",\n" : "\n";
+            Json += "\t\t{\n";
+            Json += std::string("\t\t\t\"Severity\": ") + QuoteString(SeverityToString(Issue.Severity)) + ",\n";
+            Json += "\t\t\t\"Code\": " + QuoteString(Issue.Code) + ",\n";
+            Json += "\t\t\t\"Message\": " + QuoteString(Issue.Message) + ",\n";
+            Json += "\t\t\t\"Context\": " + QuoteString(Issue.Context) + "\n";
+            Json += "\t\t}";
+        }
+        Json += Issues.empty() ? "]\n}" : "\n\t]\n}";
+
+        std::ofstream Stream(Path, std::ios::binary);
+        Stream << Json;
+        if (!Stream)
+        {
+            std::fprintf(stderr, "mwcslint: failed to write %s\n", Path.c_str());
+        }
+    }
+} // namespace
+
+int main(int Argc, char **Argv)
+{
+    FOptions Options;
+    if (!ParseArgs(Argc, Argv, Options))
+    {
+        return 64;
+    }
+
+    const auto Start = std::chrono::steady_clock::now();
+
+    std::vector<FIssue> Issues;
+    std::vector<std::string> Files;
+    CollectFiles(Options.Inputs, Files, Issues);
+
+    // Files are independent: lint them on all cores and merge the results in file order.
+    std::vector<FFileResult> Results(Files.size());
+    std::atomic<size_t> NextFile{0};
+    auto Worker = [&]()
+    {
+        for (size_t Index = NextFile++; Index < Files.size(); Index = NextFile++)
+        {
+            LintFile(Files[Index], Options, Results[Index]);
+        }
+    };
+    const size_t NumThreads = std::min<size_t>(std::max(1u, std::thread::hardware_concurrency()), Files.size());
+    std::vector<std::thread> Threads;
+    for (size_t Index = 1; Index < NumThreads; ++Index)
+    {
+        Threads.emplace_back(Worker);
+    }
+    Worker();
+    for (std::thread &Thread : Threads)
+    {
+        Thread.join();
+    }
+
+    int SpecsProcessed = 0;
+    for (FFileResult &Result : Results)
+    {
+        SpecsProcessed += Result.SpecsProcessed;
+        std::move(Result.Issues.begin(), Result.Issues.end(), std::back_inserter(Issues));
+    }
+
+    int Errors = 0;
+    int Warnings = 0;
+    for (const FIssue &Issue : Issues)
+    {
+        Errors += Issue.Severity == ESeverity::Error ? 1 : 0;
+        Warnings += Issue.Severity == ESeverity::Warning ? 1 : 0;
+        std::printf("%s: MWCS[%s] %s | %s\n", SeverityToString(Issue.Severity), Issue.Code.c_str(), Issue.Context.c_str(), Issue.Message.c_str());
+    }
+
+    const double ElapsedMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - Start).count();
+    std::printf("MWCS Lint: %d error(s), %d warning(s); Files=%zu, SpecsProcessed=%d in %.1f ms\n", Errors, Warnings, Files.size(), SpecsProcessed, ElapsedMs);
+
+    if (!Options.OutPath.empty())
+    {
+        WriteReport(Options.OutPath, SpecsProcessed, Errors, Warnings, Issues);
+    }
+
+    if (Options.bFailOnErrors && Errors > 0)
+    {
+        return 1;
+    }
+    if (Options.bFailOnWarnings && Warnings > 0)
+    {
+        return 2;
+    }
+    return 0;
+}
@@ -0,0 +1,102 @@
+<#
+.SYNOPSIS
+Send one request to a running MWCS_Server commandlet and exit with its exit code.
+
+.DESCRIPTION
+Standalone client for CI steps and git hooks: needs nothing but PowerShell, not the Tests modules.
+Issues are printed as they arrive, errors and warnings on stderr. The process exits with the EXIT code the server
+returns, which means the same as the equivalent commandlet's exit code (0, 1 -FailOnErrors, 2 -FailOnWarnings,
+3 -FailOnChanges). Exit codes of its own:
+- 10: no server is listening on the port (start one with -run=MWCS_Server)
+- 11: the connection closed before the server sent an EXIT line (the server crashed or was stopped mid-request)
+
+.PARAMETER Command
+Server command: validate, create, build, plan, extract, ping, shutdown.
+
+.PARAMETER Arguments
+Commandlet-style flags forwarded verbatim (e.g. "-Mode=Repair -Only=WBP_HUD* -FailOnErrors").
+
+.PARAMETER Port
+Loopback port the server listens on (default 47110).
+
+.PARAMETER ReportOut
+Optional path to write the returned report JSON to.
+
+.EXAMPLE
+.\Tools\MWCSServer\MWCSClient.ps1 -Command validate -Arguments "-FailOnErrors"
+#>
+
+param(
+    [Parameter(Mandatory = $true)]
+    [ValidateSet('validate', 'create', 'build', 'plan', 'extract', 'ping', 'shutdown')]
+    [string]$Command,
+
+    [string]$Arguments = '',
+
+    [int]$Port = 47110,
+
+    [string]$ReportOut
+)
+
+$ExitUnreachable = 10
+$ExitNoExitLine = 11
+
+$client = New-Object System.Net.Sockets.TcpClient
+try {
+    $client.Connect('127.0.0.1', $Port)
+}
+catch {
+    [Console]::Error.WriteLine("MWCS_Server is not reachable on 127.0.0.1:${Port}: $($_.Exception.Message)")
+    $client.Close()
+    exit $ExitUnreachable
+}
+
+$exitCode = $ExitNoExitLine
+try {
+    $stream = $client.GetStream()
+    $encoding = New-Object System.Text.UTF8Encoding($false)
+
+    $request = $encoding.GetBytes(("$Command $Arguments").Trim() + "`n")
+    $stream.Write($request, 0, $request.Length)
+
+    $reader = New-Object System.IO.StreamReader($stream, $encoding)
+    while ($null -ne ($line = $reader.ReadLine())) {
+        if ($line.StartsWith('ISSUE ')) {
+            $parts = $line.Substring(6).Split(' ', 2)
+            if ($parts[0] -eq 'Error' -or $parts[0] -eq 'Warning') {
+                [Console]::Error.WriteLine("$($parts[0]): $($parts[1])")
+            }
+            else {
+                [Console]::Out.WriteLine("$($parts[0]): $($parts[1])")
+            }
+        }
+        elseif ($line.StartsWith('REPORT ')) {
+            $length = [int]$line.Substring(7)
+            $buffer = New-Object char[] $length
+            $read = 0
+            while ($read -lt $length) {
+                $chunk = $reader.Read($buffer, $read, $length - $read)
+                if ($chunk -le 0) { break }
+                $read += $chunk
+            }
+            if ($ReportOut) {
+                [System.IO.File]::WriteAllText($ReportOut, (New-Object string($buffer, 0, $read)), $encoding)
+            }
+        }
+        elseif ($line.StartsWith('EXIT ')) {
+            $exitCode = [int]$line.Substring(5)
+            break
+        }
+    }
+}
+catch {
+    [Console]::Error.WriteLine("MWCS_Server request '$Command' failed: $($_.Exception.Message)")
+}
+finally {
+    $client.Close()
+}
+
+if ($exitCode -eq $ExitNoExitLine) {
+    [Console]::Error.WriteLine("MWCS_Server closed the connection without an exit code.")
+}
+exit $exitCode